@@ -0,0 +1,285 @@
+/**
+ * file: accuracy_tiers.h
+ * type: C++ (header file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+#ifndef ACCURACY_TIERS_H
+#define ACCURACY_TIERS_H
+
+/** preprocessing directives */
+#include <bit> // std::bit_cast
+#include <cstdint> // std::uint64_t
+#include <cmath> // std::fabs, std::copysign
+#include "exponential_kernels.h" // exponentialKernel, exponentialScale, logarithmKernel, logarithmTwoPartKernel, WHOLE_NUMBER_SHIFTER, LN_2_HIGH, LN_2_LOW, LN_2
+#include "trigonometric_batch.h" // reciprocalWithoutDivision, reduceByPiOverTwo, reducedSine, reducedCosine, selectedBy, negatedIf, magnitudeAbove
+#include "double_double.h" // twoProduct
+#define INVERSE_LN_2 1.4426950408889634 // constant which represents 1 / ln(2) (rounded to the nearest double)
+#define SQUARE_ROOT_OF_ONE_HALF_BITS 0x3FE6A09E667F3BCDULL // constant which represents the bits of sqrt(0.5) (the lower end of the interval to which tieredLn reduces x)
+#define PI_OVER_TWO 1.5707963267948966 // constant which represents Pi / 2 (rounded to the nearest double)
+
+/**
+ * Define an enumerated type named AccuracyTier whose values select how many bits of the result the tiered kernels below compute:
+ *
+ * ACCURACY_APPROXIMATE: a relative error below 2 ^ -12 (about 3.6 decimal digits) from the shortest polynomials,
+ * ACCURACY_MEDIUM: a relative error below 2 ^ -24 (about 7.2 decimal digits, i.e. the precision of a float),
+ * ACCURACY_FULL: the table-driven double kernels (to within about one unit in the last place of a double).
+ */
+enum AccuracyTier { ACCURACY_APPROXIMATE, ACCURACY_MEDIUM, ACCURACY_FULL };
+
+/** function prototypes */
+template <int N> inline double hornerPolynomial(const double (& coefficients)[N], double u);
+inline double reducedBySquareRootOfTwo(double x, double & k);
+inline double scaledByPowerOfTwo(double shifted, double p);
+template <AccuracyTier tier> inline double tieredLn(double x);
+template <AccuracyTier tier> inline double tieredPowerOfEToX(double x);
+template <AccuracyTier tier> inline double tieredPower(double base, double exponent);
+template <AccuracyTier tier> inline double tieredSine(double x);
+template <AccuracyTier tier> inline double tieredCosine(double x);
+template <AccuracyTier tier> inline double tieredArctangent(double x);
+template <AccuracyTier tier> inline double tieredLogarithm(double x, double logarithmic_base);
+
+/**
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ *
+ * The tiered kernels below compute ln, e ^ x, power, sine, cosine, arctangent, and logarithm at the accuracy which their template argument
+ * selects, so that a caller with a time budget (e.g. a soft real-time loop) trades digits for latency explicitly and per call:
+ *
+ * double y = tieredSine<ACCURACY_APPROXIMATE>(x); // fewer digits than tieredSine<ACCURACY_FULL>(x), in less time per element of a loop (see benchmark_math_kernels)
+ *
+ * The approximate and medium tiers reduce the argument with bit operations and a few multiplications (as the float ln of logarithm.h does)
+ * and then evaluate one short minimax polynomial (fitted to the relative error on the reduced interval), so they read no table. The full tier
+ * calls the kernels of exponential_kernels.h and trigonometric_batch.h.
+ *
+ * Like those kernels, the tiered kernels contain no branch (the tier is resolved by the compiler) and do not check their arguments: the caller
+ * keeps each argument in the documented range. A loop which calls them for each element of an array is vectorized by the compiler.
+ *
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * The coefficients of the polynomials P for which ln(1 + f) ≈ f * P(f) on [sqrt(0.5) - 1, sqrt(2) - 1]
+ * (whose relative errors are below 5.1e-5 and 2.7e-8).
+ */
+inline constexpr double APPROXIMATE_LN_P[5] = { 9.99966181236562335e-01, -4.99450648730773383e-01, 3.36388850864830558e-01, -2.70945973733115242e-01, 1.76580458980223509e-01 };
+inline constexpr double MEDIUM_LN_P[9] = { 9.99999974189588192e-01, -4.99999879641959244e-01, 3.33341856260602420e-01, -2.50020740675464259e-01, 1.99568335464047369e-01, -1.65623931148314057e-01, 1.49522667639002682e-01, -1.43668428021435368e-01, 8.72235501812887309e-02 };
+
+/**
+ * The coefficients of the polynomials P for which e ^ r ≈ P(r) on [-ln(2) / 2, ln(2) / 2] (whose relative errors are below 7.5e-5 and 1.9e-9).
+ */
+inline constexpr double APPROXIMATE_EXPONENTIAL_P[4] = { 9.99928073556715979e-01, 1.00016418625518844e+00, 5.04963263887116875e-01, 1.65668417911234267e-01 };
+inline constexpr double MEDIUM_EXPONENTIAL_P[7] = { 1.00000000055416738e+00, 1.00000003632319467e+00, 4.99999920798035624e-01, 1.66664201698612180e-01, 4.16682255724262832e-02, 8.37481580354900584e-03, 1.38368458295956391e-03 };
+
+/**
+ * The coefficients of the polynomials S and C for which sin(r) ≈ r * S(r ^ 2) and cos(r) ≈ C(r ^ 2) on [-Pi / 4, Pi / 4]
+ * (whose relative errors are below 1.6e-6 and 3.3e-9 for S and below 1.2e-5 and 3.3e-8 for C).
+ */
+inline constexpr double APPROXIMATE_SINE_S[3] = { 9.99998492887215207e-01, -1.66623823089517065e-01, 8.15005655538854692e-03 };
+inline constexpr double MEDIUM_SINE_S[4] = { 9.99999996761797849e-01, -1.66666502242393683e-01, 8.33201645305424107e-03, -1.95018220126417374e-04 };
+inline constexpr double APPROXIMATE_COSINE_C[3] = { 9.99988216920785100e-01, -4.99685484723128182e-01, 4.03622939312541160e-02 };
+inline constexpr double MEDIUM_COSINE_C[4] = { 9.99999967386285382e-01, -4.99998424342097347e-01, 4.16544195616279436e-02, -1.35794040782959624e-03 };
+
+/**
+ * The coefficients of the polynomials A for which atan(t) ≈ t * A(t ^ 2) on [0, 1] (whose relative errors are below 2.2e-4 and 1.6e-8).
+ */
+inline constexpr double APPROXIMATE_ARCTANGENT_A[4] = { 9.99787846970935812e-01, -3.25808437513219251e-01, 1.55578725273223695e-01, -4.43265948795919032e-02 };
+inline constexpr double MEDIUM_ARCTANGENT_A[9] = { 9.99999984765730598e-01, -3.33330733445261207e-01, 1.99926193805392255e-01, -1.42036443770427345e-01, 1.06409336720674763e-01, -7.50429378203160552e-02, 4.26915102919510348e-02, -1.60686234162971883e-02, 2.84988823088540549e-03 };
+
+/**
+ * The reduction and the polynomial of the full arctangent (from fdlibm): |x| is in one of the intervals [0, 7 / 16), [7 / 16, 11 / 16),
+ * [11 / 16, 19 / 16), [19 / 16, 39 / 16), and [39 / 16, infinity), whose index i selects c = ARCTANGENT_C[i] and s = ARCTANGENT_S[i], and
+ *
+ * atan(|x|) = atan(c / s) + atan(u)    where u = (s * |x| - c) / (c * |x| + s)
+ *
+ * (i.e. c / s = 0, 0.5, 1, 1.5, and infinity, whose arctangents are stored in two parts), and |u| <= 7 / 16. atan(u) = u - u * T(u ^ 2)
+ * where the polynomial T has 11 coefficients (whose relative error is below 2 ^ -58).
+ */
+inline constexpr double ARCTANGENT_C[5] = { 0.0, 0.5, 1.0, 1.5, 1.0 };
+inline constexpr double ARCTANGENT_S[5] = { 1.0, 1.0, 1.0, 1.0, 0.0 };
+inline constexpr double ARCTANGENT_HIGH[5] = { 0.0, 4.63647609000806093515e-01, 7.85398163397448278999e-01, 9.82793723247329054082e-01, 1.57079632679489655800e+00 };
+inline constexpr double ARCTANGENT_LOW[5] = { 0.0, 2.26987774529616870924e-17, 3.06161699786838301793e-17, 1.39033110312309984516e-17, 6.12323399573676603587e-17 };
+inline constexpr double ARCTANGENT_T[11] = { 3.33333333333329318027e-01, -1.99999999998764832476e-01, 1.42857142725034663711e-01, -1.11111104054623557880e-01, 9.09088713343650656196e-02, -7.69187620504482999495e-02, 6.66107313738753120669e-02, -5.83357013379057348645e-02, 4.97687799461593236017e-02, -3.65315727442169155270e-02, 1.62858201153657823623e-02 };
+
+/**
+ * Return coefficients[0] + coefficients[1] * u + ... + coefficients[N - 1] * u ^ (N - 1) (with Horner's rule, which the compiler unrolls).
+ */
+template <int N> inline double hornerPolynomial(const double (& coefficients)[N], double u)
+{
+    double sum = coefficients[N - 1];
+    for (int i = N - 2; i >= 0; i -= 1) sum = sum * u + coefficients[i];
+    return sum;
+}
+
+/**
+ * Split a positive normal double x into 2 ^ k * m (where m is in [sqrt(0.5), sqrt(2))), store k in k, and return f = m - 1 (which is exact).
+ *
+ * m and k are read from the bits of x (as in the float ln of logarithm.h and in logarithmReduction), so ln(x) = k * ln(2) + ln(1 + f)
+ * where |f| < 0.415 and ln(x) keeps its relative accuracy for x close to 1 (where k = 0).
+ */
+inline double reducedBySquareRootOfTwo(double x, double & k)
+{
+    std::uint64_t bits = std::bit_cast<std::uint64_t>(x);
+    std::uint64_t offset_bits = bits - SQUARE_ROOT_OF_ONE_HALF_BITS;
+    double m = std::bit_cast<double>(bits - (offset_bits & 0xFFF0000000000000ULL));
+    k = std::bit_cast<double>(std::bit_cast<std::uint64_t>(WHOLE_NUMBER_SHIFTER) + ((offset_bits + 0x3FF0000000000000ULL) >> 52)) - (WHOLE_NUMBER_SHIFTER + 1023);
+    return m - 1.0;
+}
+
+/**
+ * Return 2 ^ n * p, where n is stored in the low bits of shifted = n + WHOLE_NUMBER_SHIFTER (by adding n to the exponent field of p with an
+ * integer addition). 2 ^ n * p is assumed to be a normal double.
+ */
+inline double scaledByPowerOfTwo(double shifted, double p)
+{
+    return std::bit_cast<double>(std::bit_cast<std::uint64_t>(p) + (std::bit_cast<std::uint64_t>(shifted) << 52));
+}
+
+/**
+ * Return ln(x) for a positive normal double x.
+ *
+ * ln(x) = k * ln(2) + f * P(f) (see reducedBySquareRootOfTwo) in the approximate and medium tiers, and logarithmKernel(x) in the full tier.
+ */
+template <AccuracyTier tier> inline double tieredLn(double x)
+{
+    if constexpr (tier == ACCURACY_FULL) return logarithmKernel(x);
+    double k = 0.0;
+    double f = reducedBySquareRootOfTwo(x, k);
+    if constexpr (tier == ACCURACY_MEDIUM) return k * LN_2 + f * hornerPolynomial(MEDIUM_LN_P, f);
+    return k * LN_2 + f * hornerPolynomial(APPROXIMATE_LN_P, f);
+}
+
+/**
+ * Return e ^ x for |x| <= MAXIMUM_EXPONENTIAL_KERNEL_x.
+ *
+ * e ^ x = 2 ^ n * P(r) where n is the whole number nearest to x / ln(2) and r = x - n * ln(2) is in [-ln(2) / 2, ln(2) / 2] in the approximate
+ * and medium tiers, and exponentialKernel(x) (whose table has 128 values of 2 ^ (j / 128)) in the full tier.
+ */
+template <AccuracyTier tier> inline double tieredPowerOfEToX(double x)
+{
+    if constexpr (tier == ACCURACY_FULL) return exponentialKernel(x);
+    double shifted = x * INVERSE_LN_2 + WHOLE_NUMBER_SHIFTER;
+    double n = shifted - WHOLE_NUMBER_SHIFTER;
+    double r = (x - n * LN_2_HIGH) - n * LN_2_LOW;
+    if constexpr (tier == ACCURACY_MEDIUM) return scaledByPowerOfTwo(shifted, hornerPolynomial(MEDIUM_EXPONENTIAL_P, r));
+    return scaledByPowerOfTwo(shifted, hornerPolynomial(APPROXIMATE_EXPONENTIAL_P, r));
+}
+
+/**
+ * Return base ^ exponent = e ^ (exponent * ln(base)) for a positive normal double base and |exponent * ln(base)| <= MAXIMUM_EXPONENTIAL_KERNEL_x.
+ *
+ * In the approximate and medium tiers, the absolute error of exponent * ln(base) becomes a relative error of the result, so the relative error
+ * is about (1 + |exponent * ln(base)|) times that of the tier. In the full tier, ln(base) is computed in two parts by logarithmTwoPartKernel and
+ * multiplied by exponent with twoProduct, so that the result stays within about one unit in the last place (and within two where it is close
+ * to the largest or the smallest double, where the rounding error of a one-part exponent * ln(base) alone would be about 700 units in the last place).
+ */
+template <AccuracyTier tier> inline double tieredPower(double base, double exponent)
+{
+    if constexpr (tier != ACCURACY_FULL) return tieredPowerOfEToX<tier>(exponent * tieredLn<tier>(base));
+    double ln_low = 0.0, product_error = 0.0, correction = 0.0;
+    double ln_high = logarithmTwoPartKernel(base, ln_low);
+    double product = twoProduct(exponent, ln_high, product_error);
+    double scale = exponentialScale(product, correction);
+    // e ^ (product + product_low) = scale * (1 + correction) * (1 + product_low) to first order in product_low.
+    double product_low = product_error + exponent * ln_low;
+    return scale + scale * (correction + product_low);
+}
+
+/**
+ * Return sin(x) for x in [(-1 * MAXIMUM_x), MAXIMUM_x].
+ *
+ * x = n * (Pi / 2) + r is reduced with the two-part Pi / 2 of sineAndCosine in the approximate and medium tiers (so the error is about
+ * 1e-21 * |x| absolute instead of relative where sin(x) is that close to zero) and with the four-part Pi / 2 of reduceByPiOverTwo in the full
+ * tier. sin(r) and cos(r) are both computed and the quadrant n modulo 4 selects one of them and its sign (without a branch).
+ */
+template <AccuracyTier tier> inline double tieredSine(double x)
+{
+    double sine_of_r = 0.0, cosine_of_r = 0.0;
+    std::uint64_t quadrant = 0;
+    if constexpr (tier == ACCURACY_FULL)
+    {
+        double r_low = 0.0;
+        double r = reduceByPiOverTwo(x, r_low, quadrant);
+        sine_of_r = reducedSine(r, r_low);
+        cosine_of_r = reducedCosine(r, r_low);
+    }
+    else
+    {
+        double shifted = x * TWO_OVER_PI + WHOLE_NUMBER_SHIFTER;
+        quadrant = std::bit_cast<std::uint64_t>(shifted) & 3;
+        double n = shifted - WHOLE_NUMBER_SHIFTER;
+        double r = (x - n * PI_OVER_TWO_HIGH) - n * PI_OVER_TWO_LOW, z = r * r;
+        sine_of_r = r * ((tier == ACCURACY_MEDIUM) ? hornerPolynomial(MEDIUM_SINE_S, z) : hornerPolynomial(APPROXIMATE_SINE_S, z));
+        cosine_of_r = (tier == ACCURACY_MEDIUM) ? hornerPolynomial(MEDIUM_COSINE_C, z) : hornerPolynomial(APPROXIMATE_COSINE_C, z);
+    }
+    return negatedIf(quadrant >> 1, selectedBy(quadrant & 1, cosine_of_r, sine_of_r));
+}
+
+/**
+ * Return cos(x) for x in [(-1 * MAXIMUM_x), MAXIMUM_x] (cos(x) = cos(r), -sin(r), -cos(r), sin(r) for n modulo 4 = 0, 1, 2, 3; see tieredSine).
+ */
+template <AccuracyTier tier> inline double tieredCosine(double x)
+{
+    double sine_of_r = 0.0, cosine_of_r = 0.0;
+    std::uint64_t quadrant = 0;
+    if constexpr (tier == ACCURACY_FULL)
+    {
+        double r_low = 0.0;
+        double r = reduceByPiOverTwo(x, r_low, quadrant);
+        sine_of_r = reducedSine(r, r_low);
+        cosine_of_r = reducedCosine(r, r_low);
+    }
+    else
+    {
+        double shifted = x * TWO_OVER_PI + WHOLE_NUMBER_SHIFTER;
+        quadrant = std::bit_cast<std::uint64_t>(shifted) & 3;
+        double n = shifted - WHOLE_NUMBER_SHIFTER;
+        double r = (x - n * PI_OVER_TWO_HIGH) - n * PI_OVER_TWO_LOW, z = r * r;
+        sine_of_r = r * ((tier == ACCURACY_MEDIUM) ? hornerPolynomial(MEDIUM_SINE_S, z) : hornerPolynomial(APPROXIMATE_SINE_S, z));
+        cosine_of_r = (tier == ACCURACY_MEDIUM) ? hornerPolynomial(MEDIUM_COSINE_C, z) : hornerPolynomial(APPROXIMATE_COSINE_C, z);
+    }
+    return negatedIf(((quadrant + 1) >> 1) & 1, selectedBy(quadrant & 1, sine_of_r, cosine_of_r));
+}
+
+/**
+ * Return atan(x) for every finite x.
+ *
+ * In the approximate and medium tiers, atan(|x|) = t * A(t ^ 2) for |x| <= 1 (with t = |x|) and Pi / 2 - t * A(t ^ 2) for |x| > 1 (with t = 1 / |x|,
+ * computed by reciprocalWithoutDivision). The full tier uses the five intervals of ARCTANGENT_C (so that |u| <= 7 / 16 and the rounding errors of
+ * u are small next to atan(c / s)). Both reciprocals are computed and one of them is selected, so that the loop which calls this function has no branch.
+ */
+template <AccuracyTier tier> inline double tieredArctangent(double x)
+{
+    double a = std::fabs(x);
+    if constexpr (tier == ACCURACY_FULL)
+    {
+        std::uint64_t i = magnitudeAbove(a, 0.4375) + magnitudeAbove(a, 0.6875) + magnitudeAbove(a, 1.1875) + magnitudeAbove(a, 2.4375);
+        double u = (ARCTANGENT_S[i] * a - ARCTANGENT_C[i]) * reciprocalWithoutDivision(ARCTANGENT_C[i] * a + ARCTANGENT_S[i]);
+        double z = u * u;
+        return std::copysign(ARCTANGENT_HIGH[i] - ((u * z * hornerPolynomial(ARCTANGENT_T, z) - ARCTANGENT_LOW[i]) - u), x);
+    }
+    std::uint64_t above_one = magnitudeAbove(a, 1.0);
+    double t = selectedBy(above_one, reciprocalWithoutDivision(a), a), z = t * t;
+    double p = t * ((tier == ACCURACY_MEDIUM) ? hornerPolynomial(MEDIUM_ARCTANGENT_A, z) : hornerPolynomial(APPROXIMATE_ARCTANGENT_A, z));
+    return std::copysign(selectedBy(above_one, PI_OVER_TWO - p, p), x);
+}
+
+/**
+ * Return log_b(x) = ln(x) / ln(b) (where b is logarithmic_base) for positive normal doubles x and b (with b other than 1).
+ *
+ * In the approximate and medium tiers, the relative error is at most about twice that of tieredLn. In the full tier, both logarithms are
+ * computed in two parts and divided as double-double numbers, so that the quotient is rounded once (to within about one unit in the last place).
+ */
+template <AccuracyTier tier> inline double tieredLogarithm(double x, double logarithmic_base)
+{
+    if constexpr (tier != ACCURACY_FULL) return tieredLn<tier>(x) / tieredLn<tier>(logarithmic_base);
+    double x_low = 0.0, base_low = 0.0, product_error = 0.0;
+    double x_high = logarithmTwoPartKernel(x, x_low);
+    double base_high = logarithmTwoPartKernel(logarithmic_base, base_low);
+    double quotient = x_high / base_high;
+    double product = twoProduct(quotient, base_high, product_error);
+    return quotient + ((((x_high - product) - product_error) + x_low) - quotient * base_low) / base_high;
+}
+
+#endif // ACCURACY_TIERS_H
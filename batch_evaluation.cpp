@@ -0,0 +1,383 @@
+/**
+ * file: batch_evaluation.cpp
+ * type: C++ (source file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+/** preprocessing directives */
+#include <iostream> // standard output (std::cout)
+#include <charconv> // std::from_chars
+#include <cstdio> // std::fopen, std::fread, std::fwrite, std::fclose, std::setvbuf
+#include <cstdlib> // std::aligned_alloc, std::free
+#include <cstring> // std::memchr
+#include <vector> // std::vector
+#include "batch_evaluation.h" // BatchInput, BatchKernel, function prototypes
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h> // open
+#include <sys/mman.h> // mmap, madvise, munmap
+#include <sys/stat.h> // fstat
+#include <unistd.h> // close
+#define BATCH_INPUT_HAS_MMAP 1
+#endif
+#define CACHE_LINE_SIZE 64 // constant which represents the number of bytes in one cache line
+#define PAGE_SIZE_BYTES 4096 // constant which represents the number of bytes in one memory page
+#define BATCH_OUTPUT_BUFFER_LENGTH 4194304 // constant which represents the number of bytes which evaluateBatchFile buffers before each write
+
+/**
+ * Open the file named file_name and choose its layout from its file name extension (see formatOf).
+ */
+BatchInput::BatchInput(const std::string & file_name, long long block_length) : BatchInput(file_name, formatOf(file_name), block_length)
+{
+}
+
+/**
+ * Open the file named file_name (which is read as the given layout).
+ *
+ * If block_length is out of range, it is reset to DEFAULT_BATCH_BLOCK_LENGTH.
+ * If the file cannot be opened, a message is printed to the command line terminal and the BatchInput is empty.
+ */
+BatchInput::BatchInput(const std::string & file_name, BatchInputFormat format, long long block_length) : input_format(format), block_length(block_length)
+{
+    // Set block_length to the default value if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((block_length < 1) || (block_length > MAXIMUM_BATCH_BLOCK_LENGTH))
+    {
+        this->block_length = DEFAULT_BATCH_BLOCK_LENGTH;
+        std::cout << "\n\nThe block length of the BatchInput was out of range. Hence, the block length has been reset to " << DEFAULT_BATCH_BLOCK_LENGTH << ".";
+    }
+
+    open(file_name);
+    if (data == nullptr) return;
+
+    if (input_format == BATCH_INPUT_TEXT)
+    {
+        std::size_t bytes = ((sizeof(double) * static_cast<std::size_t>(this->block_length) + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE) * CACHE_LINE_SIZE;
+        parsed = static_cast<double *>(std::aligned_alloc(CACHE_LINE_SIZE, bytes));
+
+        // If the block buffer could not be allocated, close the file (so that the BatchInput is empty). Then print a message about that to the command line terminal.
+        if (parsed == nullptr)
+        {
+            close();
+            std::cout << "\n\nThe block buffer for the input file " << file_name << " could not be allocated.";
+        }
+    }
+    else if (length % sizeof(double) != 0)
+    {
+        std::cout << "\n\nThe length of the binary input file " << file_name << " is not a multiple of " << sizeof(double) << " bytes. Hence, the incomplete last value is ignored.";
+    }
+}
+
+BatchInput::~BatchInput()
+{
+    close();
+    std::free(parsed);
+}
+
+/**
+ * Unmap (or free) the file contents, so that the BatchInput is empty.
+ */
+void BatchInput::close()
+{
+#if defined(BATCH_INPUT_HAS_MMAP)
+    if (mapped) munmap(const_cast<char *>(data), length);
+#endif
+    if (!mapped) delete[] data;
+    data = nullptr;
+    length = 0;
+    mapped = false;
+}
+
+/**
+ * Return BATCH_INPUT_TEXT if file_name ends with .txt or .csv. Otherwise, return BATCH_INPUT_BINARY (e.g. for .bin or .dat, the usual
+ * extensions of raw arrays of doubles).
+ */
+BatchInputFormat BatchInput::formatOf(const std::string & file_name)
+{
+    std::size_t dot = file_name.rfind('.');
+    if (dot == std::string::npos) return BATCH_INPUT_BINARY;
+    std::string extension = file_name.substr(dot);
+    if ((extension == ".txt") || (extension == ".csv")) return BATCH_INPUT_TEXT;
+    return BATCH_INPUT_BINARY;
+}
+
+/**
+ * Map the file named file_name read-only (or read the whole file into a private buffer if memory mapping is not available).
+ */
+void BatchInput::open(const std::string & file_name)
+{
+#if defined(BATCH_INPUT_HAS_MMAP)
+    int descriptor = ::open(file_name.c_str(), O_RDONLY);
+    if (descriptor >= 0)
+    {
+        struct stat status;
+        if ((fstat(descriptor, &status) == 0) && (status.st_size == 0))
+        {
+            // An empty file has no pages to map (but it is a valid input which contains no values).
+            ::close(descriptor);
+            data = new char[1];
+            length = 0;
+            return;
+        }
+        void * address = MAP_FAILED;
+        if (fstat(descriptor, &status) == 0)
+        {
+            length = static_cast<std::size_t>(status.st_size);
+            address = mmap(nullptr, length, PROT_READ, MAP_SHARED, descriptor, 0);
+        }
+        ::close(descriptor);
+        if (address != MAP_FAILED)
+        {
+            data = static_cast<const char *>(address);
+            mapped = true;
+            madvise(address, length, MADV_SEQUENTIAL);
+            return;
+        }
+    }
+#endif
+
+    std::FILE * file = std::fopen(file_name.c_str(), "rb");
+    if (file != nullptr)
+    {
+        std::fseek(file, 0, SEEK_END);
+        long end = std::ftell(file);
+        std::fseek(file, 0, SEEK_SET);
+        if (end >= 0)
+        {
+            length = static_cast<std::size_t>(end);
+            char * buffer = new char[length + 1];
+            if (std::fread(buffer, 1, length, file) == length) data = buffer;
+            else delete[] buffer;
+        }
+        std::fclose(file);
+    }
+    if (data == nullptr)
+    {
+        length = 0;
+        std::cout << "\n\nThe input file " << file_name << " could not be opened.";
+    }
+}
+
+/**
+ * Request the next BATCH_INPUT_READAHEAD_LENGTH bytes of the mapping from in_use onward, and release the pages which lie entirely
+ * behind in_use (the first byte which is still in use, i.e. the read position of the parser or the start of the binary block
+ * which is handed out to the caller).
+ */
+void BatchInput::advise(std::size_t in_use)
+{
+#if defined(BATCH_INPUT_HAS_MMAP)
+    if (!mapped) return;
+    if ((requested < length) && (requested < in_use + BATCH_INPUT_READAHEAD_LENGTH / 2))
+    {
+        std::size_t start = (in_use / PAGE_SIZE_BYTES) * PAGE_SIZE_BYTES;
+        std::size_t end = (in_use + BATCH_INPUT_READAHEAD_LENGTH < length) ? (in_use + BATCH_INPUT_READAHEAD_LENGTH) : length;
+        madvise(const_cast<char *>(data) + start, end - start, MADV_WILLNEED);
+        requested = end;
+    }
+    std::size_t behind = (in_use / PAGE_SIZE_BYTES) * PAGE_SIZE_BYTES;
+    if (behind >= released + BATCH_INPUT_READAHEAD_LENGTH)
+    {
+        madvise(const_cast<char *>(data) + released, behind - released, MADV_DONTNEED);
+        released = behind;
+    }
+#else
+    (void) in_use;
+#endif
+}
+
+/**
+ * Point block at the next (at most blockLength()) values of the input and return the number of those values
+ * (or zero when the whole input has been read).
+ *
+ * block remains valid until the next call to nextBlock.
+ */
+long long BatchInput::nextBlock(const double * & block)
+{
+    block = nullptr;
+    if (data == nullptr) return 0;
+
+    long long count = 0;
+    if (input_format == BATCH_INPUT_BINARY)
+    {
+        std::size_t remaining = (length - position) / sizeof(double);
+        count = (remaining < static_cast<std::size_t>(block_length)) ? static_cast<long long>(remaining) : block_length;
+        block = reinterpret_cast<const double *>(data + position);
+
+        // The caller reads block (inside of the mapping) until the next call, so only the pages behind block (i.e. those of the previous block) are released.
+        advise(position);
+        position += static_cast<std::size_t>(count) * sizeof(double);
+    }
+    else
+    {
+        count = parseTextBlock();
+        block = parsed;
+    }
+
+    values_read += count;
+    return count;
+}
+
+/**
+ * Parse at most blockLength() numbers from the text which follows the read position into the block buffer
+ * and return the number of parsed values.
+ *
+ * A line which does not contain a valid number is counted in invalidLines() and skipped.
+ */
+long long BatchInput::parseTextBlock()
+{
+    const char * p = data + position;
+    const char * end = data + length;
+    long long count = 0;
+
+    while ((count < block_length) && (p < end))
+    {
+        // Skip the separators between numbers.
+        char c = *p;
+        if ((c == '\n') || (c == '\r') || (c == ' ') || (c == '\t') || (c == ','))
+        {
+            p += 1;
+            continue;
+        }
+
+        // Skip comment lines.
+        if (c == '#')
+        {
+            const char * newline = static_cast<const char *>(std::memchr(p, '\n', static_cast<std::size_t>(end - p)));
+            p = (newline != nullptr) ? newline : end;
+            continue;
+        }
+
+        // std::from_chars does not accept a leading plus sign.
+        if ((c == '+') && (p + 1 < end)) p += 1;
+
+        double value = 0.0;
+        std::from_chars_result result = std::from_chars(p, end, value);
+        bool separated = (result.ptr == end) || (*result.ptr == '\n') || (*result.ptr == '\r') || (*result.ptr == ' ') || (*result.ptr == '\t') || (*result.ptr == ',');
+        if ((result.ec == std::errc()) && separated)
+        {
+            parsed[count] = value;
+            count += 1;
+            p = result.ptr;
+        }
+        else
+        {
+            invalid_lines += 1;
+            const char * newline = static_cast<const char *>(std::memchr(p, '\n', static_cast<std::size_t>(end - p)));
+            p = (newline != nullptr) ? newline : end;
+        }
+    }
+
+    position = static_cast<std::size_t>(p - data);
+    advise(position);
+    return count;
+}
+
+/**
+ * Stream every value of input through kernel (one block at a time) and pass each block of x values and the
+ * matching block of y values to consumer.
+ *
+ * Return the number of values which were evaluated (or -1 if the block buffer for the y values could not be allocated).
+ */
+long long evaluateBatch(BatchInput & input, const BatchKernel & kernel, const std::function<void(const double * x, const double * y, long long count)> & consumer)
+{
+    double * y = static_cast<double *>(std::aligned_alloc(CACHE_LINE_SIZE, ((sizeof(double) * static_cast<std::size_t>(input.blockLength()) + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE) * CACHE_LINE_SIZE));
+    if (y == nullptr)
+    {
+        std::cout << "\n\nThe block buffer for the y values could not be allocated.";
+        return -1;
+    }
+    long long total = 0;
+    const double * x = nullptr;
+    for (long long count = input.nextBlock(x); count > 0; count = input.nextBlock(x))
+    {
+        kernel(x, y, count);
+        consumer(x, y, count);
+        total += count;
+    }
+    std::free(y);
+    return total;
+}
+
+/**
+ * Compute y[k] = f(x[k]) for k = 0, 1, ..., count - 1 on every thread of pool (chunk_length values at a time).
+ *
+ * Each chunk writes only to its own part of y, so y is in the same order as x.
+ */
+void evaluateParallel(ThreadPool & pool, const BatchKernel & kernel, const double * x, double * y, long long count, long long chunk_length)
+{
+    pool.parallelFor(count, chunk_length, [&](long long begin, long long end) { kernel(x + begin, y + begin, end - begin); });
+}
+
+/**
+ * Compute y[k] = f(x[k]) for k = 0, 1, ..., count - 1 in DoubleDouble arithmetic on every thread of pool (chunk_length values at a time).
+ */
+void evaluateParallel(ThreadPool & pool, const DoubleDoubleBatchKernel & kernel, const DoubleDouble * x, DoubleDouble * y, long long count, long long chunk_length)
+{
+    pool.parallelFor(count, chunk_length, [&](long long begin, long long end) { kernel(x + begin, y + begin, end - begin); });
+}
+
+/**
+ * Return a BatchKernel which widens each double x[k] to a DoubleDouble, evaluates kernel, and rounds each result to the nearest double
+ * (so that a DoubleDouble kernel can be given to evaluateBatch, evaluateBatchFile, and evaluateParallel, and every output double is
+ * correctly rounded whenever the DoubleDouble result is accurate to more than 53 bits).
+ */
+BatchKernel roundedToDouble(const DoubleDoubleBatchKernel & kernel)
+{
+    return [kernel](const double * x, double * y, long long count)
+    {
+        // Each thread reuses its own pair of DoubleDouble buffers.
+        thread_local std::vector<DoubleDouble> wide_x, wide_y;
+        if (static_cast<long long>(wide_x.size()) < count)
+        {
+            wide_x.resize(count);
+            wide_y.resize(count);
+        }
+        for (long long k = 0; k < count; k += 1) wide_x[k] = DoubleDouble(x[k]);
+        kernel(wide_x.data(), wide_y.data(), count);
+        for (long long k = 0; k < count; k += 1) y[k] = wide_y[k].toDouble();
+    };
+}
+
+/**
+ * Evaluate kernel at every value of the file named input_file_name (binary or text, see BatchInput::formatOf) and write the
+ * results to the file named output_file_name as a raw array of native doubles (i.e. the binary input layout, so that one
+ * output file can be the input file of the next batch job).
+ *
+ * If pool is not nullptr, each block is split into chunks of DEFAULT_PARALLEL_CHUNK_LENGTH values which are evaluated
+ * on every thread of pool (so block_length should be many times larger than that chunk length).
+ *
+ * Return the number of values which were evaluated (or -1 if either file could not be opened or a block buffer could not be allocated).
+ */
+long long evaluateBatchFile(const std::string & input_file_name, const std::string & output_file_name, const BatchKernel & kernel, long long block_length, ThreadPool * pool)
+{
+    BatchInput input(input_file_name, block_length);
+    if (!input.isOpen()) return -1;
+
+    std::FILE * output = std::fopen(output_file_name.c_str(), "wb");
+    if (output == nullptr)
+    {
+        std::cout << "\n\nThe output file " << output_file_name << " could not be opened.";
+        return -1;
+    }
+    std::vector<char> output_buffer(BATCH_OUTPUT_BUFFER_LENGTH);
+    std::setvbuf(output, output_buffer.data(), _IOFBF, output_buffer.size());
+
+    // Spread the values of each block over the threads of pool (if a pool was given).
+    BatchKernel block_kernel = kernel;
+    if (pool != nullptr) block_kernel = [&](const double * x, double * y, long long count) { evaluateParallel(*pool, kernel, x, y, count); };
+
+    bool written = true;
+    long long total = evaluateBatch(input, block_kernel, [&](const double *, const double * y, long long count) {
+        written = (std::fwrite(y, sizeof(double), static_cast<std::size_t>(count), output) == static_cast<std::size_t>(count)) && written;
+    });
+
+    written = (std::fclose(output) == 0) && written;
+    if (total < 0) return -1;
+    if (!written)
+    {
+        std::cout << "\n\nThe output file " << output_file_name << " could not be written.";
+        return -1;
+    }
+    if (input.invalidLines() > 0) std::cout << "\n\n" << input.invalidLines() << " lines of the input file " << input_file_name << " did not contain a valid number and were skipped.";
+    return total;
+}
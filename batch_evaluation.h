@@ -0,0 +1,90 @@
+/**
+ * file: batch_evaluation.h
+ * type: C++ (header file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+#ifndef BATCH_EVALUATION_H
+#define BATCH_EVALUATION_H
+
+/** preprocessing directives */
+#include <cstddef> // std::size_t
+#include <functional> // std::function
+#include <string> // std::string
+#include "thread_pool.h" // ThreadPool
+#include "double_double.h" // DoubleDouble, DoubleDoubleBatchKernel
+#define DEFAULT_BATCH_BLOCK_LENGTH 4096 // constant which represents the default number of values per block (32 KiB of doubles, which fits inside of the L1 data cache)
+#define MAXIMUM_BATCH_BLOCK_LENGTH 16777216 // constant which represents the maximum number of values per block
+#define BATCH_INPUT_READAHEAD_LENGTH 8388608 // constant which represents the number of bytes of a memory-mapped input file which are requested ahead of the parser
+
+/**
+ * The two input file layouts which a BatchInput can read:
+ *
+ * BATCH_INPUT_BINARY: a raw array of native doubles (e.g. numpy.ndarray.tofile or the output of evaluateBatchFile).
+ * BATCH_INPUT_TEXT: one decimal number per line (blank lines are skipped, lines which begin with # are comments,
+ *                   and spaces, tabs, and commas also separate numbers).
+ */
+enum BatchInputFormat { BATCH_INPUT_BINARY, BATCH_INPUT_TEXT };
+
+// Define the data type for a kernel which computes y[k] = f(x[k]) for k = 0, 1, ..., count - 1 (one block at a time).
+using BatchKernel = std::function<void(const double * x, double * y, long long count)>;
+
+/**
+ * A BatchInput streams the x values of a (possibly very large) file in blocks of at most block_length values
+ * (instead of reading one value per std::cin >> x prompt).
+ *
+ * The file is memory-mapped read-only. The kernel asks for the pages which are about to be read ahead of time
+ * (madvise(MADV_WILLNEED)) and releases the pages which were already read (madvise(MADV_DONTNEED)), so a file of tens of
+ * GB streams through a bounded amount of memory.
+ *
+ * Blocks of a binary file point directly into the mapping (no copy). Blocks of a text file are parsed with
+ * std::from_chars (which neither allocates nor depends on the locale) into one reused, cache-line-aligned block buffer.
+ */
+class BatchInput
+{
+public:
+    explicit BatchInput(const std::string & file_name, long long block_length = DEFAULT_BATCH_BLOCK_LENGTH);
+    BatchInput(const std::string & file_name, BatchInputFormat format, long long block_length = DEFAULT_BATCH_BLOCK_LENGTH);
+    ~BatchInput();
+    BatchInput(const BatchInput &) = delete;
+    BatchInput & operator=(const BatchInput &) = delete;
+
+    static BatchInputFormat formatOf(const std::string & file_name);
+
+    bool isOpen() const { return data != nullptr; }
+    BatchInputFormat format() const { return input_format; }
+    long long blockLength() const { return block_length; }
+    long long valuesRead() const { return values_read; }
+    long long invalidLines() const { return invalid_lines; }
+
+    long long nextBlock(const double * & block);
+
+private:
+    void open(const std::string & file_name);
+    void close();
+    void advise(std::size_t in_use);
+    long long parseTextBlock();
+
+    BatchInputFormat input_format = BATCH_INPUT_BINARY;
+    long long block_length = DEFAULT_BATCH_BLOCK_LENGTH;
+    const char * data = nullptr; // start of the file contents (either a memory mapping or a private buffer)
+    std::size_t length = 0; // number of bytes in the file
+    std::size_t position = 0; // number of bytes which were already consumed
+    std::size_t requested = 0; // end of the byte range which was already requested with MADV_WILLNEED
+    std::size_t released = 0; // end of the byte range which was already released with MADV_DONTNEED
+    bool mapped = false;
+    double * parsed = nullptr; // block buffer for values parsed from a text file
+    long long values_read = 0;
+    long long invalid_lines = 0;
+};
+
+/** function prototypes */
+long long evaluateBatch(BatchInput & input, const BatchKernel & kernel, const std::function<void(const double * x, const double * y, long long count)> & consumer);
+long long evaluateBatchFile(const std::string & input_file_name, const std::string & output_file_name, const BatchKernel & kernel, long long block_length = DEFAULT_BATCH_BLOCK_LENGTH, ThreadPool * pool = nullptr);
+void evaluateParallel(ThreadPool & pool, const BatchKernel & kernel, const double * x, double * y, long long count, long long chunk_length = DEFAULT_PARALLEL_CHUNK_LENGTH);
+void evaluateParallel(ThreadPool & pool, const DoubleDoubleBatchKernel & kernel, const DoubleDouble * x, DoubleDouble * y, long long count, long long chunk_length = DEFAULT_PARALLEL_CHUNK_LENGTH);
+BatchKernel roundedToDouble(const DoubleDoubleBatchKernel & kernel);
+
+#endif // BATCH_EVALUATION_H
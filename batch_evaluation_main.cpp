@@ -0,0 +1,148 @@
+/**
+ * file: batch_evaluation_main.cpp
+ * type: C++ (source file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+/**
+ * This program evaluates one kernel of libkarbytes_math at every x value of an input file
+ * (instead of at one x value per std::cin >> x prompt) and writes the results as a raw array of doubles.
+ *
+ * The input file is either a raw array of doubles (e.g. .bin or .dat) or (if its name ends with .txt or .csv) a text file with one
+ * number per line. The input is memory-mapped and streamed through the kernel in blocks of --block values.
+ *
+ * Usage:
+ *
+ * batch_evaluation --function=NAME --input=FILE --output=FILE [--base=LOGARITHMIC_BASE] [--block=VALUES] [--threads=COUNT]
+ *
+ * where NAME is one of identity, sine, cosine, tangent, cotangent, secant, cosecant, arctangent, arcsine, arccosine,
+ * ln, logarithm, or power (identity only parses and copies the input, which measures the speed of the input layer alone),
+ * or one of sine_dd, cosine_dd, arctangent_dd, ln_dd, or power_of_e_to_x_dd (which compute in DoubleDouble arithmetic and write
+ * each result rounded to the nearest double), or one of tangent_batch, cotangent_batch, secant_batch, or cosecant_batch
+ * (which evaluate whole blocks with minimax approximations and without a division per value), or one of hyperbolic_sine,
+ * hyperbolic_cosine, hyperbolic_tangent, inverse_hyperbolic_sine, inverse_hyperbolic_cosine, inverse_hyperbolic_tangent,
+ * or one of logarithm_base_two, logarithm_base_ten, logarithm_of_one_plus, power_of_two_to_x, or power_of_e_to_x_minus_one
+ * (which evaluate whole blocks with the table-driven exponential and logarithm kernels).
+ *
+ * --threads=0 uses every hardware thread of the machine (and the default, --threads=1, runs on the calling thread only).
+ */
+
+/** preprocessing directives */
+#include <iostream> // standard output (std::cout)
+#include <chrono> // std::chrono::steady_clock
+#include <cstdlib> // std::atof, std::atoi, std::atoll
+#include <cstring> // std::strncmp
+#include <string> // std::string
+#include "trigonometric_functions.h" // sine, cosine, tangent, cotangent, secant, cosecant, arctangent, arcsine, arccosine
+#include "trigonometric_batch.h" // tangentBatch, cotangentBatch, secantBatch, cosecantBatch
+#include "hyperbolic_functions.h" // hyperbolicSineBatch, hyperbolicCosineBatch, hyperbolicTangentBatch, inverseHyperbolicSineBatch, ...
+#include "logarithm.h" // ln, logarithm, power, logarithmBaseTwoBatch, logarithmBaseTenBatch, logarithmOfOnePlusBatch, powerOfTwoToXBatch, powerOfEToXMinusOneBatch
+#include "batch_evaluation.h" // BatchKernel, evaluateBatchFile, roundedToDouble, DEFAULT_BATCH_BLOCK_LENGTH
+#include "double_double.h" // DoubleDouble, DoubleDoubleBatchKernel
+#include "thread_pool.h" // ThreadPool, DEFAULT_PARALLEL_CHUNK_LENGTH
+
+/**
+ * Return a BatchKernel which applies the single-variable kernel to each value of a block.
+ */
+template <typename Kernel> BatchKernel elementwise(Kernel kernel)
+{
+    return [kernel](const double * x, double * y, long long count) { for (long long k = 0; k < count; k += 1) y[k] = kernel(x[k]); };
+}
+
+/**
+ * Return a BatchKernel which applies the single-variable DoubleDouble kernel to each value of a block (rounding each result to a double).
+ */
+template <typename Kernel> BatchKernel elementwiseDoubleDouble(Kernel kernel)
+{
+    return roundedToDouble([kernel](const DoubleDouble * x, DoubleDouble * y, long long count) { for (long long k = 0; k < count; k += 1) y[k] = kernel(x[k]); });
+}
+
+/** program entry point */
+int main(int argc, char ** argv)
+{
+    // Declare the command line options (and their default values).
+    std::string function_name = "", input_file_name = "", output_file_name = "";
+    double logarithmic_base = 10;
+    long long block_length = DEFAULT_BATCH_BLOCK_LENGTH;
+    int thread_count = 1;
+
+    // Parse the command line options.
+    for (int i = 1; i < argc; i += 1)
+    {
+        if (std::strncmp(argv[i], "--function=", 11) == 0) function_name = argv[i] + 11;
+        else if (std::strncmp(argv[i], "--input=", 8) == 0) input_file_name = argv[i] + 8;
+        else if (std::strncmp(argv[i], "--output=", 9) == 0) output_file_name = argv[i] + 9;
+        else if (std::strncmp(argv[i], "--base=", 7) == 0) logarithmic_base = std::atof(argv[i] + 7);
+        else if (std::strncmp(argv[i], "--block=", 8) == 0) block_length = std::atoll(argv[i] + 8);
+        else if (std::strncmp(argv[i], "--threads=", 10) == 0) thread_count = std::atoi(argv[i] + 10);
+        else function_name = "";
+    }
+
+    // Select the kernel which is named by function_name.
+    BatchKernel kernel;
+    if (function_name == "identity") kernel = [](const double * x, double * y, long long count) { for (long long k = 0; k < count; k += 1) y[k] = x[k]; };
+    else if (function_name == "sine") kernel = elementwise([](double x) { return sine(x); });
+    else if (function_name == "cosine") kernel = elementwise([](double x) { return cosine(x); });
+    else if (function_name == "tangent") kernel = elementwise([](double x) { return tangent(x); });
+    else if (function_name == "cotangent") kernel = elementwise([](double x) { return cotangent(x); });
+    else if (function_name == "secant") kernel = elementwise([](double x) { return secant(x); });
+    else if (function_name == "cosecant") kernel = elementwise([](double x) { return cosecant(x); });
+    else if (function_name == "arctangent") kernel = elementwise([](double x) { return arctangent(x); });
+    else if (function_name == "arcsine") kernel = elementwise([](double x) { return arcsine(x); });
+    else if (function_name == "arccosine") kernel = elementwise([](double x) { return arccosine(x); });
+    else if (function_name == "ln") kernel = elementwise([](double x) { return static_cast<double>(ln(static_cast<float>(x))); });
+    else if (function_name == "logarithm") kernel = elementwise([logarithmic_base](double x) { return logarithm(x, logarithmic_base); });
+    else if (function_name == "power") kernel = elementwise([logarithmic_base](double x) { return power(logarithmic_base, x); });
+    else if (function_name == "sine_dd") kernel = elementwiseDoubleDouble([](const DoubleDouble & x) { return sine(x); });
+    else if (function_name == "cosine_dd") kernel = elementwiseDoubleDouble([](const DoubleDouble & x) { return cosine(x); });
+    else if (function_name == "arctangent_dd") kernel = elementwiseDoubleDouble([](const DoubleDouble & x) { return arctangent(x); });
+    else if (function_name == "ln_dd") kernel = elementwiseDoubleDouble([](const DoubleDouble & x) { return ln(x); });
+    else if (function_name == "power_of_e_to_x_dd") kernel = elementwiseDoubleDouble([](const DoubleDouble & x) { return power_of_e_to_x(x); });
+    else if (function_name == "tangent_batch") kernel = tangentBatch;
+    else if (function_name == "cotangent_batch") kernel = cotangentBatch;
+    else if (function_name == "secant_batch") kernel = secantBatch;
+    else if (function_name == "cosecant_batch") kernel = cosecantBatch;
+    else if (function_name == "hyperbolic_sine") kernel = hyperbolicSineBatch;
+    else if (function_name == "hyperbolic_cosine") kernel = hyperbolicCosineBatch;
+    else if (function_name == "hyperbolic_tangent") kernel = hyperbolicTangentBatch;
+    else if (function_name == "inverse_hyperbolic_sine") kernel = inverseHyperbolicSineBatch;
+    else if (function_name == "inverse_hyperbolic_cosine") kernel = inverseHyperbolicCosineBatch;
+    else if (function_name == "inverse_hyperbolic_tangent") kernel = inverseHyperbolicTangentBatch;
+    else if (function_name == "logarithm_base_two") kernel = logarithmBaseTwoBatch;
+    else if (function_name == "logarithm_base_ten") kernel = logarithmBaseTenBatch;
+    else if (function_name == "logarithm_of_one_plus") kernel = logarithmOfOnePlusBatch;
+    else if (function_name == "power_of_two_to_x") kernel = powerOfTwoToXBatch;
+    else if (function_name == "power_of_e_to_x_minus_one") kernel = powerOfEToXMinusOneBatch;
+
+    if (!kernel || input_file_name.empty() || output_file_name.empty())
+    {
+        std::cout << "\nUsage: " << argv[0] << " --function=NAME --input=FILE --output=FILE [--base=LOGARITHMIC_BASE] [--block=VALUES] [--threads=COUNT]";
+        std::cout << "\n\nNAME is one of identity, sine, cosine, tangent, cotangent, secant, cosecant, arctangent, arcsine, arccosine, ln, logarithm, power, sine_dd, cosine_dd, arctangent_dd, ln_dd, power_of_e_to_x_dd, tangent_batch, cotangent_batch, secant_batch, cosecant_batch, hyperbolic_sine, hyperbolic_cosine, hyperbolic_tangent, inverse_hyperbolic_sine, inverse_hyperbolic_cosine, inverse_hyperbolic_tangent, logarithm_base_two, logarithm_base_ten, logarithm_of_one_plus, power_of_two_to_x, power_of_e_to_x_minus_one.\n";
+        return 1;
+    }
+
+    /**
+     * With more than one thread, let each block hold DEFAULT_PARALLEL_CHUNK_LENGTH values per thread (at least 16 times over)
+     * unless a block length was requested, so that every thread gets many chunks of each block.
+     */
+    ThreadPool pool(thread_count);
+    bool block_length_requested = (block_length != DEFAULT_BATCH_BLOCK_LENGTH);
+    if ((pool.threadCount() > 1) && !block_length_requested) block_length = static_cast<long long>(DEFAULT_PARALLEL_CHUNK_LENGTH) * 16 * pool.threadCount();
+
+    // Stream the input file through the kernel and measure the elapsed time.
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    long long count = evaluateBatchFile(input_file_name, output_file_name, kernel, block_length, (pool.threadCount() > 1) ? &pool : nullptr);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (count < 0)
+    {
+        std::cout << "\n";
+        return 1;
+    }
+
+    // Print the number of evaluated values and the throughput to the command line terminal.
+    std::cout << "\n" << function_name << ": " << count << " values from " << input_file_name << " written to " << output_file_name;
+    std::cout << " in " << seconds << " seconds (" << ((seconds > 0) ? (count / seconds) : 0.0) << " values per second on " << pool.threadCount() << " threads).\n";
+    return 0;
+}
@@ -0,0 +1,519 @@
+/**
+ * file: benchmark_math_kernels.cpp
+ * type: C++ (source file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+/**
+ * This program measures the latency (nanoseconds per call on a single repeated argument) and the throughput
+ * (calls per second over a sweep of arguments) of every kernel in libkarbytes_math.
+ *
+ * The sweeps include worst-case arguments near the MAXIMUM_x limits of the kernels.
+ *
+ * The results are printed to the command line terminal and (optionally) written as JSON (in the same general layout which
+ * Google Benchmark uses for --benchmark_out) so that the results of two commits can be compared with a plain diff tool.
+ *
+ * Usage:
+ *
+ * benchmark_math_kernels [--benchmark_filter=SUBSTRING] [--benchmark_min_time=SECONDS] [--benchmark_out=FILE.json]
+ */
+
+/** preprocessing directives */
+#include <iostream> // standard output (std::cout)
+#include <fstream> // file output
+#include <chrono> // std::chrono::steady_clock
+#include <cmath> // sine function (sin(x)), square root function (sqrt(x))
+#include <cstdlib> // std::atof
+#include <cstring> // std::strncmp
+#include <string> // std::string, std::to_string
+#include <vector> // std::vector
+#include <type_traits> // std::is_floating_point_v
+#include "trigonometric_functions.h" // computePi, sine, cosine, tangent, arctangent, arcsine, arccosine, MAXIMUM_x
+#include "trigonometric_table.h" // SineCosineTable
+#include "trigonometric_batch.h" // tangentBatch, cotangentBatch, secantBatch, cosecantBatch
+#include "logarithm.h" // ln, power_of_e_to_x, power, logarithm, logarithmBaseTwo, logarithmBaseTwoBatch, ..., MAXIMUM_logarithmic_base
+#include "exponential_kernels.h" // exponentialKernel, logarithmKernel
+#include "hyperbolic_functions.h" // hyperbolicSine, hyperbolicSineBatch, hyperbolicTangentBatch, inverseHyperbolicSineBatch, ...
+#include "accuracy_tiers.h" // AccuracyTier, tieredLn, tieredPowerOfEToX, tieredPower, tieredSine, tieredCosine, tieredArctangent, tieredLogarithm
+#include "float_kernels.h" // sineFloatBatch, cosineFloatBatch, lnFloatBatch, powerOfEToXFloatBatch, powerFloatBatch
+#include "fundamental_theorem_of_calculus.h" // Function, computeRiemannSum, computeMultipleRiemannSum, computeRiemannSumEnclosure, integral, derivative, generate_array_of_functions, generate_array_of_interval_functions
+#include "batch_evaluation.h" // BatchKernel, evaluateParallel
+#include "monte_carlo.h" // integrateMonteCarlo, MonteCarloOptions
+#include "gauss_legendre.h" // integrateGaussLegendre, gaussLegendreRule, MAXIMUM_GAUSS_LEGENDRE_ORDER
+#include "tanh_sinh.h" // integrateTanhSinh
+#include "chebyshev.h" // ChebyshevExpansion
+#include "root_finding.h" // findRootBrent, findRootNewtonDual, findRootsBrent
+#include "evaluation_cache.h" // memoize, DEFAULT_EVALUATION_CACHE_CAPACITY
+#include "big_float.h" // BigFloat, computePiToDigits
+#include "double_double.h" // DoubleDouble, DoubleDoubleBatchKernel
+#include "interval.h" // Interval, IntervalFunction
+#include "thread_pool.h" // ThreadPool
+#define SWEEP_LENGTH 64 // constant which represents the number of arguments in each throughput sweep
+
+/**
+ * Define a struct-type variable named BenchmarkResult which stores the measurements of one benchmark
+ * where name identifies the kernel and the argument (or argument range),
+ * where iterations is the number of kernel calls which were timed,
+ * where nanoseconds_per_call is the mean wall-clock time of one kernel call,
+ * and where calls_per_second is the reciprocal of nanoseconds_per_call (scaled to seconds).
+ */
+struct BenchmarkResult {
+    std::string name;
+    long long iterations;
+    double nanoseconds_per_call;
+    double calls_per_second;
+};
+
+/** function prototypes */
+template <typename T> void doNotOptimize(const T & value);
+template <typename T> T hiddenFromOptimizer(T value);
+template <typename Kernel> BenchmarkResult runBenchmark(const std::string & name, double minimum_seconds, Kernel kernel, long long calls_per_run);
+std::vector<double> generateSweep(double minimum, double maximum);
+void writeJson(const std::vector<BenchmarkResult> & results, double minimum_seconds, std::ofstream & file);
+
+/**
+ * Prevent the compiler from discarding the computation which produced value (and from hoisting that computation out of the timing loop).
+ */
+template <typename T> void doNotOptimize(const T & value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile T sink;
+    sink = value;
+#endif
+}
+
+/**
+ * Return value unchanged in a way which the compiler cannot see through (so that a kernel whose argument is a constant of the benchmark
+ * is not evaluated at compile time or hoisted out of the timing loop, which would happen to every inline kernel of a header otherwise).
+ *
+ * On x86-64, floating-point values stay in their vector register (so that the barrier adds no instruction to the measured latency).
+ */
+template <typename T> T hiddenFromOptimizer(T value)
+{
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+    if constexpr (std::is_floating_point_v<T> && (sizeof(T) <= 8)) asm volatile("" : "+x"(value));
+    else asm volatile("" : "+r,m"(value));
+#elif defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : "+r,m"(value));
+#else
+    static volatile T source;
+    source = value;
+    value = source;
+#endif
+    return value;
+}
+
+/**
+ * Run kernel (which performs calls_per_run kernel calls each time it is invoked) in batches whose sizes double
+ * until one batch takes at least minimum_seconds. Then return the timing of that batch.
+ */
+template <typename Kernel> BenchmarkResult runBenchmark(const std::string & name, double minimum_seconds, Kernel kernel, long long calls_per_run)
+{
+    long long runs = 1;
+    double elapsed_seconds = 0.0;
+
+    // Warm up the instruction cache, the data cache and the branch predictor.
+    kernel();
+
+    while (true)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (long long r = 0; r < runs; r += 1) kernel();
+        auto stop = std::chrono::steady_clock::now();
+        elapsed_seconds = std::chrono::duration<double>(stop - start).count();
+        if ((elapsed_seconds >= minimum_seconds) || (runs >= (1LL << 40))) break;
+        runs *= 2;
+    }
+
+    long long iterations = runs * calls_per_run;
+    double nanoseconds_per_call = (elapsed_seconds * 1e9) / iterations;
+    return { name, iterations, nanoseconds_per_call, 1e9 / nanoseconds_per_call };
+}
+
+/**
+ * Return SWEEP_LENGTH evenly spaced arguments covering the closed interval [minimum, maximum].
+ */
+std::vector<double> generateSweep(double minimum, double maximum)
+{
+    std::vector<double> sweep(SWEEP_LENGTH);
+    for (int i = 0; i < SWEEP_LENGTH; i += 1) sweep[i] = minimum + (maximum - minimum) * i / (SWEEP_LENGTH - 1);
+    return sweep;
+}
+
+/**
+ * Write the benchmark results to the file output stream as a JSON document (one benchmark per line so that diffs stay readable).
+ */
+void writeJson(const std::vector<BenchmarkResult> & results, double minimum_seconds, std::ofstream & file)
+{
+    file.precision(6);
+    file << "{\n";
+    file << "  \"context\": {\n";
+    file << "    \"executable\": \"benchmark_math_kernels\",\n";
+    file << "    \"min_time\": " << minimum_seconds << ",\n";
+#if defined(NDEBUG)
+    file << "    \"library_build_type\": \"release\"\n";
+#else
+    file << "    \"library_build_type\": \"debug\"\n";
+#endif
+    file << "  },\n";
+    file << "  \"benchmarks\": [\n";
+    for (std::size_t i = 0; i < results.size(); i += 1)
+    {
+        file << "    {\"name\": \"" << results[i].name << "\", \"iterations\": " << results[i].iterations
+             << ", \"real_time\": " << results[i].nanoseconds_per_call << ", \"time_unit\": \"ns\", \"items_per_second\": " << results[i].calls_per_second << "}";
+        file << ((i + 1 < results.size()) ? ",\n" : "\n");
+    }
+    file << "  ]\n";
+    file << "}\n";
+}
+
+/** program entry point */
+int main(int argc, char ** argv)
+{
+    // Declare the command line options (and their default values).
+    std::string filter = "", output_file_name = "";
+    double minimum_seconds = 0.1;
+
+    // Parse the command line options.
+    for (int i = 1; i < argc; i += 1)
+    {
+        if (std::strncmp(argv[i], "--benchmark_filter=", 19) == 0) filter = argv[i] + 19;
+        else if (std::strncmp(argv[i], "--benchmark_min_time=", 21) == 0) minimum_seconds = std::atof(argv[i] + 21);
+        else if (std::strncmp(argv[i], "--benchmark_out=", 16) == 0) output_file_name = argv[i] + 16;
+        else
+        {
+            std::cout << "\nUsage: " << argv[0] << " [--benchmark_filter=SUBSTRING] [--benchmark_min_time=SECONDS] [--benchmark_out=FILE.json]\n";
+            return 1;
+        }
+    }
+
+    std::vector<BenchmarkResult> results;
+
+    /**
+     * Register one latency benchmark for each argument in points (the kernel is called on the same argument over and over)
+     * and one throughput benchmark for the sweep of arguments over [minimum, maximum].
+     *
+     * Each argument passes through hiddenFromOptimizer on every call (as each result passes through doNotOptimize), so that every call is timed.
+     */
+    auto measure = [&](const std::string & kernel_name, auto kernel, std::vector<double> points, double minimum, double maximum)
+    {
+        for (double point : points)
+        {
+            std::string name = kernel_name + "/latency/x:" + std::to_string(point);
+            if (name.find(filter) == std::string::npos) continue;
+            results.push_back(runBenchmark(name, minimum_seconds, [&]() { doNotOptimize(kernel(hiddenFromOptimizer(point))); }, 1));
+        }
+        std::string name = kernel_name + "/throughput/x:[" + std::to_string(minimum) + "," + std::to_string(maximum) + "]";
+        if (name.find(filter) == std::string::npos) return;
+        std::vector<double> sweep = generateSweep(minimum, maximum);
+        results.push_back(runBenchmark(name, minimum_seconds, [&]() { for (double x : sweep) doNotOptimize(kernel(hiddenFromOptimizer(x))); }, SWEEP_LENGTH));
+    };
+
+    /**
+     * Register one throughput benchmark for a batch kernel which produces count values each time it is invoked.
+     */
+    auto measureBatch = [&](const std::string & name, long long count, auto batch_kernel)
+    {
+        if (name.find(filter) == std::string::npos) return;
+        results.push_back(runBenchmark(name, minimum_seconds, batch_kernel, count));
+    };
+
+    const double near_maximum_x = MAXIMUM_x * 0.999;
+    const long long batch_length = 1 << 16;
+    std::vector<double> batch_output(batch_length), batch_output_two(batch_length);
+
+    /*****************************/
+    /* trigonometric_functions   */
+    /*****************************/
+
+    measure("sine", [](double x) { return sine(x); }, { 0.5, 3.0, 100.0, near_maximum_x }, -MAXIMUM_x, MAXIMUM_x);
+    measure("cosine", [](double x) { return cosine(x); }, { 0.5, 3.0, 100.0, near_maximum_x }, -MAXIMUM_x, MAXIMUM_x);
+    measure("tangent", [](double x) { return tangent(x); }, { 0.5, 3.0, 100.0, near_maximum_x }, -MAXIMUM_x, MAXIMUM_x);
+    measure("arctangent", [](double x) { return arctangent(x); }, { 0.1, 0.5, 0.999 }, -1.0, 1.0);
+    measure("arcsine", [](double x) { return arcsine(x); }, { 0.1, 0.5, 0.999 }, -1.0, 1.0);
+    measure("arccosine", [](double x) { return arccosine(x); }, { 0.1, 0.5, 0.999 }, -1.0, 1.0);
+    measure("sineAndCosine", [](double x) { double s = 0.0, c = 0.0; sineAndCosine(x, s, c); return s + c; }, { 0.5, near_maximum_x }, -MAXIMUM_x, MAXIMUM_x);
+    measureBatch("generateSineCosineSequence/per_element/d:0.001", batch_length, [&]() { generateSineCosineSequence(0.0, 0.001, batch_length, batch_output.data(), batch_output_two.data()); doNotOptimize(batch_output[batch_length - 1]); });
+    const SineCosineTable table(DEFAULT_TRIGONOMETRIC_TABLE_RESOLUTION);
+    measure("SineCosineTable::sine", [&](double x) { return table.sine(x); }, { 0.5, 3.0, near_maximum_x }, -MAXIMUM_x, MAXIMUM_x);
+    measure("SineCosineTable::cosine", [&](double x) { return table.cosine(x); }, { 0.5, 3.0, near_maximum_x }, -MAXIMUM_x, MAXIMUM_x);
+    measure("SineCosineTable::sineAtIndex", [&](double i) { return table.sineAtIndex(static_cast<long long>(i)); }, { 17.0 }, 0.0, DEFAULT_TRIGONOMETRIC_TABLE_RESOLUTION - 1);
+    measureBatch("SineCosineTable()/default_resolution", 1, [&]() { SineCosineTable built; doNotOptimize(built.sineAtIndex(1)); });
+
+    // The batch kernels evaluate a whole block without a division per value (compare with the elementwise loops of the series kernels).
+    std::vector<double> batch_input(batch_length);
+    for (long long k = 0; k < batch_length; k += 1) batch_input[k] = -MAXIMUM_x + 2.0 * MAXIMUM_x * (k + 0.5) / batch_length;
+    measureBatch("tangent/per_element/elementwise", batch_length / 64, [&]() { for (long long k = 0; k < batch_length / 64; k += 1) batch_output[k] = tangent(batch_input[k * 64]); doNotOptimize(batch_output[0]); });
+    measureBatch("secant/per_element/elementwise", batch_length / 64, [&]() { for (long long k = 0; k < batch_length / 64; k += 1) batch_output[k] = secant(batch_input[k * 64]); doNotOptimize(batch_output[0]); });
+    measureBatch("tangentBatch/per_element", batch_length, [&]() { tangentBatch(batch_input.data(), batch_output.data(), batch_length); doNotOptimize(batch_output[0]); });
+    measureBatch("cotangentBatch/per_element", batch_length, [&]() { cotangentBatch(batch_input.data(), batch_output.data(), batch_length); doNotOptimize(batch_output[0]); });
+    measureBatch("secantBatch/per_element", batch_length, [&]() { secantBatch(batch_input.data(), batch_output.data(), batch_length); doNotOptimize(batch_output[0]); });
+    measureBatch("cosecantBatch/per_element", batch_length, [&]() { cosecantBatch(batch_input.data(), batch_output.data(), batch_length); doNotOptimize(batch_output[0]); });
+    measureBatch("1.0/cos(x)/per_element/std", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = 1.0 / std::cos(batch_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("reciprocalWithoutDivision/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = reciprocalWithoutDivision(batch_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("1.0/x/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = 1.0 / batch_input[k]; doNotOptimize(batch_output[0]); });
+    measureBatch("SineCosineTable(4097)", 1, [&]() { SineCosineTable built(DEFAULT_TRIGONOMETRIC_TABLE_RESOLUTION + 1); doNotOptimize(built.sineAtIndex(1)); });
+    measure("computePi", [](double x) { return computePi(static_cast<int>(x)); }, { 10.0, 1000.0, MAXIMUM_i }, 1.0, MAXIMUM_i);
+
+    /*****************************/
+    /* logarithm                 */
+    /*****************************/
+
+    measure("ln", [](double x) { return ln(static_cast<float>(x)); }, { 0.5, 2.0, near_maximum_x }, 1e-3, MAXIMUM_x);
+    measure("power_of_e_to_x", [](double x) { return power_of_e_to_x(x); }, { 0.5, 10.0, 700.0 }, -700.0, 700.0);
+    measure("power", [](double x) { return power(x, 2.5); }, { 0.5, 2.0, near_maximum_x }, 1e-3, MAXIMUM_x);
+    measure("power_whole_exponent", [](double x) { return power(1.0001, x); }, { 2.0, 100.0, near_maximum_x }, 1.0, MAXIMUM_x);
+    measure("logarithm", [](double x) { return logarithm(x, 10.0); }, { 0.5, 2.0, near_maximum_x }, 1e-3, MAXIMUM_x);
+    measure("exponentialKernel", [](double x) { return exponentialKernel(x); }, { 0.5, 10.0, 700.0 }, -700.0, 700.0);
+    measure("logarithmKernel", [](double x) { return logarithmKernel(x); }, { 0.5, 2.0, near_maximum_x }, 1e-3, MAXIMUM_x);
+    measure("logarithmBaseTwo", [](double x) { return logarithmBaseTwo(x); }, { 0.5, 2.0, near_maximum_x }, 1e-3, MAXIMUM_x);
+    measure("logarithmBaseTen", [](double x) { return logarithmBaseTen(x); }, { 0.5, 2.0, near_maximum_x }, 1e-3, MAXIMUM_x);
+    measure("logarithmOfOnePlus", [](double x) { return logarithmOfOnePlus(x); }, { 1e-10, 0.5, near_maximum_x }, -0.5, MAXIMUM_x);
+    measure("powerOfTwoToX", [](double x) { return powerOfTwoToX(x); }, { 0.5, 10.0, 1000.0 }, -1000.0, 1000.0);
+    measure("powerOfEToXMinusOne", [](double x) { return powerOfEToXMinusOne(x); }, { 1e-10, 0.5, 700.0 }, -700.0, 700.0);
+
+    // The specialized batch kernels against the change of base of logarithm(x, b) and against the library functions.
+    std::vector<double> logarithm_input(batch_length), exponent_input(batch_length);
+    for (long long k = 0; k < batch_length; k += 1)
+    {
+        logarithm_input[k] = 1e-3 + (MAXIMUM_x - 1e-3) * (k + 0.5) / batch_length;
+        exponent_input[k] = -700.0 + 1400.0 * (k + 0.5) / batch_length;
+    }
+    measureBatch("logarithm(x,2)/per_element/elementwise", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = logarithm(logarithm_input[k], 2.0); doNotOptimize(batch_output[0]); });
+    measureBatch("std::log2/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = std::log2(logarithm_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("logarithmBaseTwoBatch/per_element", batch_length, [&]() { logarithmBaseTwoBatch(logarithm_input.data(), batch_output.data(), batch_length); doNotOptimize(batch_output[0]); });
+    measureBatch("logarithm(x,10)/per_element/elementwise", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = logarithm(logarithm_input[k], 10.0); doNotOptimize(batch_output[0]); });
+    measureBatch("std::log10/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = std::log10(logarithm_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("logarithmBaseTenBatch/per_element", batch_length, [&]() { logarithmBaseTenBatch(logarithm_input.data(), batch_output.data(), batch_length); doNotOptimize(batch_output[0]); });
+    measureBatch("logarithmKernel(x)/ln(2)/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = logarithmKernel(logarithm_input[k]) / LN_2; doNotOptimize(batch_output[0]); });
+    measureBatch("logarithmKernel(x)/ln(10)/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = logarithmKernel(logarithm_input[k]) / static_cast<double>(LN_10_LONG); doNotOptimize(batch_output[0]); });
+    measureBatch("std::log1p/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = std::log1p(logarithm_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("logarithmOfOnePlusBatch/per_element", batch_length, [&]() { logarithmOfOnePlusBatch(logarithm_input.data(), batch_output.data(), batch_length); doNotOptimize(batch_output[0]); });
+    measureBatch("std::exp2/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = std::exp2(exponent_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("powerOfTwoToXBatch/per_element", batch_length, [&]() { powerOfTwoToXBatch(exponent_input.data(), batch_output.data(), batch_length); doNotOptimize(batch_output[0]); });
+    measureBatch("std::expm1/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = std::expm1(exponent_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("powerOfEToXMinusOneBatch/per_element", batch_length, [&]() { powerOfEToXMinusOneBatch(exponent_input.data(), batch_output.data(), batch_length); doNotOptimize(batch_output[0]); });
+
+    /*****************************/
+    /* hyperbolic_functions      */
+    /*****************************/
+
+    // The batch kernels of hyperbolic_functions.h sweep [-700, 700] (inside the range of the exponential kernel) and [1, MAXIMUM_x] for acosh.
+    std::vector<double> hyperbolic_input(batch_length), inverse_cosine_input(batch_length), inverse_tangent_input(batch_length);
+    for (long long k = 0; k < batch_length; k += 1)
+    {
+        hyperbolic_input[k] = -700.0 + 1400.0 * (k + 0.5) / batch_length;
+        inverse_cosine_input[k] = 1.0 + (MAXIMUM_x - 1.0) * (k + 0.5) / batch_length;
+        inverse_tangent_input[k] = -1.0 + 2.0 * (k + 0.5) / batch_length;
+    }
+    measure("hyperbolicSine", [](double x) { return hyperbolicSine(x); }, { 0.5, 10.0, 700.0 }, -700.0, 700.0);
+    measure("hyperbolicTangent", [](double x) { return hyperbolicTangent(x); }, { 0.5, 10.0, 700.0 }, -700.0, 700.0);
+    measureBatch("std::sinh/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = std::sinh(hyperbolic_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("hyperbolicSineBatch/per_element", batch_length, [&]() { hyperbolicSineBatch(hyperbolic_input.data(), batch_output.data(), batch_length); doNotOptimize(batch_output[0]); });
+    measureBatch("hyperbolicCosineBatch/per_element", batch_length, [&]() { hyperbolicCosineBatch(hyperbolic_input.data(), batch_output.data(), batch_length); doNotOptimize(batch_output[0]); });
+    measureBatch("hyperbolicSineAndCosineBatch/per_element", batch_length, [&]() { hyperbolicSineAndCosineBatch(hyperbolic_input.data(), batch_output.data(), batch_output_two.data(), batch_length); doNotOptimize(batch_output[0]); });
+    measureBatch("std::tanh/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = std::tanh(hyperbolic_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("hyperbolicTangentBatch/per_element", batch_length, [&]() { hyperbolicTangentBatch(hyperbolic_input.data(), batch_output.data(), batch_length); doNotOptimize(batch_output[0]); });
+    measureBatch("std::asinh/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = std::asinh(hyperbolic_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("inverseHyperbolicSineBatch/per_element", batch_length, [&]() { inverseHyperbolicSineBatch(hyperbolic_input.data(), batch_output.data(), batch_length); doNotOptimize(batch_output[0]); });
+    measureBatch("inverseHyperbolicCosineBatch/per_element", batch_length, [&]() { inverseHyperbolicCosineBatch(inverse_cosine_input.data(), batch_output.data(), batch_length); doNotOptimize(batch_output[0]); });
+    measureBatch("inverseHyperbolicTangentBatch/per_element", batch_length, [&]() { inverseHyperbolicTangentBatch(inverse_tangent_input.data(), batch_output.data(), batch_length); doNotOptimize(batch_output[0]); });
+
+    /*****************************/
+    /* accuracy_tiers            */
+    /*****************************/
+
+    // Each tiered kernel of accuracy_tiers.h in a loop over a whole block (which the compiler vectorizes) at each of the three tiers, next to the library function.
+    std::vector<double> angle_input(batch_length), arctangent_input(batch_length);
+    for (long long k = 0; k < batch_length; k += 1)
+    {
+        angle_input[k] = -MAXIMUM_x + 2.0 * MAXIMUM_x * (k + 0.5) / batch_length;
+        arctangent_input[k] = -4.0 + 8.0 * (k + 0.5) / batch_length;
+    }
+    measureBatch("std::log/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = std::log(logarithm_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("tieredLn<ACCURACY_APPROXIMATE>/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = tieredLn<ACCURACY_APPROXIMATE>(logarithm_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("tieredLn<ACCURACY_MEDIUM>/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = tieredLn<ACCURACY_MEDIUM>(logarithm_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("tieredLn<ACCURACY_FULL>/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = tieredLn<ACCURACY_FULL>(logarithm_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("std::exp/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = std::exp(exponent_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("tieredPowerOfEToX<ACCURACY_APPROXIMATE>/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = tieredPowerOfEToX<ACCURACY_APPROXIMATE>(exponent_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("tieredPowerOfEToX<ACCURACY_MEDIUM>/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = tieredPowerOfEToX<ACCURACY_MEDIUM>(exponent_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("tieredPowerOfEToX<ACCURACY_FULL>/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = tieredPowerOfEToX<ACCURACY_FULL>(exponent_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("std::pow(x,2.5)/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = std::pow(logarithm_input[k], 2.5); doNotOptimize(batch_output[0]); });
+    measureBatch("tieredPower(x,2.5)<ACCURACY_APPROXIMATE>/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = tieredPower<ACCURACY_APPROXIMATE>(logarithm_input[k], 2.5); doNotOptimize(batch_output[0]); });
+    measureBatch("tieredPower(x,2.5)<ACCURACY_MEDIUM>/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = tieredPower<ACCURACY_MEDIUM>(logarithm_input[k], 2.5); doNotOptimize(batch_output[0]); });
+    measureBatch("tieredPower(x,2.5)<ACCURACY_FULL>/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = tieredPower<ACCURACY_FULL>(logarithm_input[k], 2.5); doNotOptimize(batch_output[0]); });
+    measureBatch("std::sin/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = std::sin(angle_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("tieredSine<ACCURACY_APPROXIMATE>/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = tieredSine<ACCURACY_APPROXIMATE>(angle_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("tieredSine<ACCURACY_MEDIUM>/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = tieredSine<ACCURACY_MEDIUM>(angle_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("tieredSine<ACCURACY_FULL>/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = tieredSine<ACCURACY_FULL>(angle_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("std::cos/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = std::cos(angle_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("tieredCosine<ACCURACY_APPROXIMATE>/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = tieredCosine<ACCURACY_APPROXIMATE>(angle_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("tieredCosine<ACCURACY_MEDIUM>/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = tieredCosine<ACCURACY_MEDIUM>(angle_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("tieredCosine<ACCURACY_FULL>/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = tieredCosine<ACCURACY_FULL>(angle_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("std::atan/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = std::atan(arctangent_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("tieredArctangent<ACCURACY_APPROXIMATE>/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = tieredArctangent<ACCURACY_APPROXIMATE>(arctangent_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("tieredArctangent<ACCURACY_MEDIUM>/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = tieredArctangent<ACCURACY_MEDIUM>(arctangent_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("tieredArctangent<ACCURACY_FULL>/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = tieredArctangent<ACCURACY_FULL>(arctangent_input[k]); doNotOptimize(batch_output[0]); });
+    measureBatch("std::log(x)/std::log(3)/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = std::log(logarithm_input[k]) / std::log(3.0); doNotOptimize(batch_output[0]); });
+    measureBatch("tieredLogarithm(x,3)<ACCURACY_APPROXIMATE>/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = tieredLogarithm<ACCURACY_APPROXIMATE>(logarithm_input[k], 3.0); doNotOptimize(batch_output[0]); });
+    measureBatch("tieredLogarithm(x,3)<ACCURACY_MEDIUM>/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = tieredLogarithm<ACCURACY_MEDIUM>(logarithm_input[k], 3.0); doNotOptimize(batch_output[0]); });
+    measureBatch("tieredLogarithm(x,3)<ACCURACY_FULL>/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) batch_output[k] = tieredLogarithm<ACCURACY_FULL>(logarithm_input[k], 3.0); doNotOptimize(batch_output[0]); });
+
+    /*****************************/
+    /* float_kernels             */
+    /*****************************/
+
+    // The float batch kernels (which process 16, 8, or 4 floats per instruction on AVX-512, AVX2, or SSE2 machines) next to loops of the float overloads of the library functions.
+    std::vector<float> float_angle_input(batch_length), float_logarithm_input(batch_length), float_exponent_input(batch_length), float_unit_input(batch_length), float_output(batch_length);
+    for (long long k = 0; k < batch_length; k += 1)
+    {
+        float_angle_input[k] = static_cast<float>(angle_input[k]);
+        float_logarithm_input[k] = static_cast<float>(logarithm_input[k]);
+        float_exponent_input[k] = static_cast<float>(-86.0 + 172.0 * (k + 0.5) / batch_length);
+        float_unit_input[k] = static_cast<float>((k + 0.5) / batch_length);
+    }
+    measureBatch("std::sin(float)/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) float_output[k] = std::sin(float_angle_input[k]); doNotOptimize(float_output[0]); });
+    measureBatch("sineFloatBatch/per_element", batch_length, [&]() { sineFloatBatch(float_angle_input.data(), float_output.data(), batch_length); doNotOptimize(float_output[0]); });
+    measureBatch("std::cos(float)/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) float_output[k] = std::cos(float_angle_input[k]); doNotOptimize(float_output[0]); });
+    measureBatch("cosineFloatBatch/per_element", batch_length, [&]() { cosineFloatBatch(float_angle_input.data(), float_output.data(), batch_length); doNotOptimize(float_output[0]); });
+    measureBatch("std::log(float)/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) float_output[k] = std::log(float_logarithm_input[k]); doNotOptimize(float_output[0]); });
+    measureBatch("ln(float)/per_element/elementwise", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) float_output[k] = ln(float_logarithm_input[k]); doNotOptimize(float_output[0]); });
+    measureBatch("lnFloatBatch/per_element", batch_length, [&]() { lnFloatBatch(float_logarithm_input.data(), float_output.data(), batch_length); doNotOptimize(float_output[0]); });
+    measureBatch("std::exp(float)/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) float_output[k] = std::exp(float_exponent_input[k]); doNotOptimize(float_output[0]); });
+    measureBatch("powerOfEToXFloatBatch/per_element", batch_length, [&]() { powerOfEToXFloatBatch(float_exponent_input.data(), float_output.data(), batch_length); doNotOptimize(float_output[0]); });
+    measureBatch("std::pow(float,1/2.2)/per_element", batch_length, [&]() { for (long long k = 0; k < batch_length; k += 1) float_output[k] = std::pow(float_unit_input[k], 1.0f / 2.2f); doNotOptimize(float_output[0]); });
+    measureBatch("powerFloatBatch(x,1/2.2)/per_element", batch_length, [&]() { powerFloatBatch(float_unit_input.data(), 1.0f / 2.2f, float_output.data(), batch_length); doNotOptimize(float_output[0]); });
+
+    /*****************************/
+    /* calculus                  */
+    /*****************************/
+
+    const std::array<Function, 6> functions = generate_array_of_functions();
+    const Function integ = integral(functions[2], 0.0, 1.0);
+    const Function func_prime = derivative(functions[2]);
+
+    measure("computeRiemannSum/midpoint/sin", [&](double n) { return computeRiemannSum(functions[2], 0.0, 1.0, static_cast<int>(n), "midpoint"); }, { 10.0, 100.0, MAXIMUM_RIEMANN_SUM_n }, 1.0, MAXIMUM_RIEMANN_SUM_n);
+    measure("integral/sin", [&](double x) { return integ(x); }, { 0.5, 50.0, MAXIMUM_RIEMANN_SUM_a * 0.999 }, 0.001, MAXIMUM_RIEMANN_SUM_a);
+    const Function cached_integ = integral(functions[2], 0.0, 1.0, DEFAULT_EVALUATION_CACHE_CAPACITY);
+    measure("integral/sin:cached", [&](double x) { return cached_integ(x); }, { 0.5, 50.0, MAXIMUM_RIEMANN_SUM_a * 0.999 }, 0.001, MAXIMUM_RIEMANN_SUM_a);
+    const Function memoized_sin = memoize(functions[2]);
+    measure("memoize/sin:hit", [&](double x) { return memoized_sin(x); }, { 0.5, 2.0, 3.0 }, 0.0, 1.0 / 64);
+    std::vector<double> distinct_x = generateSweep(0.0, 1.0);
+    const Function small_memoized_sin = memoize(functions[2], 16);
+    measureBatch("memoize/sin:miss_and_evict", static_cast<long long>(distinct_x.size()), [&]() { double sum = 0.0; for (double x : distinct_x) sum += small_memoized_sin(x); doNotOptimize(sum); });
+    measure("integrateGaussLegendre/sin", [&](double b) { return integrateGaussLegendre(functions[2], 0.0, b); }, { 0.5, 50.0, MAXIMUM_RIEMANN_SUM_a * 0.999 }, 0.001, MAXIMUM_RIEMANN_SUM_a);
+    measure("integrateGaussLegendre/sin:n=64", [&](double b) { return integrateGaussLegendre(functions[2], 0.0, b, 64); }, { 0.5, 50.0, MAXIMUM_RIEMANN_SUM_a * 0.999 }, 0.001, MAXIMUM_RIEMANN_SUM_a);
+    measure("integrateTanhSinh/sqrt", [&](double b) { return integrateTanhSinh(functions[4], 0.0, b).estimate; }, { 0.5, 50.0, MAXIMUM_RIEMANN_SUM_a * 0.999 }, 0.001, MAXIMUM_RIEMANN_SUM_a);
+    measure("computeRiemannSum/midpoint/sqrt:n=1000", [&](double b) { return computeRiemannSum(functions[4], 0.0, b, 1000, "midpoint"); }, { 0.5, 50.0, MAXIMUM_RIEMANN_SUM_a * 0.999 }, 0.001, MAXIMUM_RIEMANN_SUM_a);
+    measure("gaussLegendreRule/cached", [](double n) { return gaussLegendreRule(static_cast<int>(n)).weights[0]; }, { 20.0, 100.0, MAXIMUM_GAUSS_LEGENDRE_ORDER }, 1.0, 200.0);
+    const ChebyshevExpansion expansion(functions[2], 0.0, MAXIMUM_RIEMANN_SUM_a);
+    const Function chebyshev_integ = integral(expansion, functions[2]);
+    const Function chebyshev_prime = derivative(expansion, functions[2]);
+    measureBatch("ChebyshevExpansion/fit/sin[0,10]", 1, [&]() { doNotOptimize(ChebyshevExpansion(functions[2], 0.0, 10.0).degree()); });
+    measure("integral(ChebyshevExpansion)/sin:degree=" + std::to_string(expansion.degree()), [&](double x) { return chebyshev_integ(x); }, { 0.5, 50.0, MAXIMUM_RIEMANN_SUM_a * 0.999 }, 0.001, MAXIMUM_RIEMANN_SUM_a);
+    measure("derivative(ChebyshevExpansion)/sin:degree=" + std::to_string(expansion.degree()), [&](double x) { return chebyshev_prime(x); }, { 0.5, 50.0, MAXIMUM_RIEMANN_SUM_a * 0.999 }, 0.001, MAXIMUM_RIEMANN_SUM_a);
+    measure("derivative/sin", [&](double x) { return func_prime(x); }, { 0.5, 50.0, MAXIMUM_RIEMANN_SUM_a * 0.999 }, -MAXIMUM_RIEMANN_SUM_a, MAXIMUM_RIEMANN_SUM_a);
+    const RowFunction box_row = [](const double * x, long long count, const double * point, double * values) { double yz = point[1] * point[2]; for (long long k = 0; k < count; k += 1) values[k] = x[k] * x[k] * yz; };
+    measureBatch("computeMultipleRiemannSum/per_sample/x^2*y*z:100^3", 1000000, [&]() { doNotOptimize(computeMultipleRiemannSum(box_row, { { 0.0, 1.0, 100 }, { 0.0, 2.0, 100 }, { 0.0, 3.0, 100 } }, "midpoint")); });
+    const MultivariableFunction box_function = [](const double * point) { return point[0] * point[0] * point[1] * point[2]; };
+    const std::vector<Parameters> box = { { 0.0, 1.0, 1 }, { 0.0, 2.0, 1 }, { 0.0, 3.0, 1 } };
+    for (MonteCarloSampler sampler : { MONTE_CARLO_PSEUDO_RANDOM, MONTE_CARLO_SOBOL, MONTE_CARLO_HALTON })
+    {
+        MonteCarloOptions options;
+        options.samples = 65536;
+        options.sampler = sampler;
+        const char * sampler_names[] = { "pseudo_random", "sobol", "halton" };
+        measureBatch(std::string("integrateMonteCarlo/per_sample/") + sampler_names[sampler] + "/x^2*y*z", options.samples, [&]() { doNotOptimize(integrateMonteCarlo(box_function, box, options).estimate); });
+    }
+
+    /*****************************/
+    /* parallel batch evaluation */
+    /*****************************/
+
+    // Each parallel batch is spread over every hardware thread (compare calls/s with the single-thread throughput benchmarks above).
+    ThreadPool pool;
+    const long long parallel_length = 256 * static_cast<long long>(pool.threadCount());
+    std::vector<double> parallel_input = generateSweep(-3.0, 3.0);
+    parallel_input.resize(parallel_length, 0.5);
+    const BatchKernel sine_kernel = [](const double * x, double * y, long long count) { for (long long k = 0; k < count; k += 1) y[k] = sine(x[k]); };
+    const BatchKernel power_kernel = [](const double * x, double * y, long long count) { for (long long k = 0; k < count; k += 1) y[k] = power(2.5, x[k]); };
+    std::string threads_suffix = "/threads:" + std::to_string(pool.threadCount());
+    measureBatch("evaluateParallel/sine" + threads_suffix, parallel_length, [&]() { evaluateParallel(pool, sine_kernel, parallel_input.data(), batch_output.data(), parallel_length, 16); doNotOptimize(batch_output[0]); });
+    measureBatch("evaluateParallel/power" + threads_suffix, parallel_length, [&]() { evaluateParallel(pool, power_kernel, parallel_input.data(), batch_output.data(), parallel_length, 16); doNotOptimize(batch_output[0]); });
+
+
+    /*****************************/
+    /* root finding              */
+    /*****************************/
+
+    // Solve sine(x) = y for x in [-pi/2, pi/2] (one root per call, then a batch of roots per call of the kernel).
+    measure("findRootBrent/sine(x)=y", [](double y) { return findRootBrent([y](double x) { return sine(x) - y; }, -1.5707963, 1.5707963).root; }, { -0.5, 0.5, 0.99 }, -0.99, 0.99);
+    measure("findRootNewtonDual/x^3=y", [](double y) { return findRootNewtonDual([y](auto x) { return x * x * x - y; }, 0.0, 100.0).root; }, { 0.5, 2.0, 1000.0 }, 0.001, 1000.0);
+    std::vector<double> root_targets = generateSweep(-0.99, 0.99);
+    const long long root_count = static_cast<long long>(root_targets.size());
+    std::vector<double> root_lower(root_count, -1.5707963), root_upper(root_count, 1.5707963), roots(root_count);
+    measureBatch("findRootsBrent/per_root/sine(x)=y", root_count, [&]() { doNotOptimize(static_cast<double>(findRootsBrent(sine_kernel, root_targets.data(), root_lower.data(), root_upper.data(), roots.data(), root_count))); });
+    measureBatch("findRootsBrent/per_root/sine(x)=y" + threads_suffix, root_count, [&]() { doNotOptimize(static_cast<double>(findRootsBrent(sine_kernel, root_targets.data(), root_lower.data(), root_upper.data(), roots.data(), root_count, DEFAULT_ROOT_TOLERANCE, &pool))); });
+
+    /*****************************/
+    /* arbitrary precision       */
+    /*****************************/
+
+    // Evaluate the BigFloat kernels to 100 significant digits (one call per iteration), and multiply two 10000-digit numbers (Karatsuba's method).
+    const BigFloat big_x(std::string("3.7")), big_pi = computePiToDigits(10000);
+    measureBatch("ln(BigFloat)/100_digits", 1, [&]() { doNotOptimize(ln(big_x).toDouble()); });
+    measureBatch("power_of_e_to_x(BigFloat)/100_digits", 1, [&]() { doNotOptimize(power_of_e_to_x(big_x).toDouble()); });
+    measureBatch("sine(BigFloat)/100_digits", 1, [&]() { doNotOptimize(sine(big_x).toDouble()); });
+    measureBatch("BigFloat*BigFloat/10000_digits", 1, [&]() { doNotOptimize((big_pi * big_pi).toDouble()); });
+    measureBatch("BigFloat::toString/100_digits", 1, [&]() { doNotOptimize(static_cast<double>(ln(big_x).toString(100).size())); });
+
+    /*****************************/
+    /* double-double precision   */
+    /*****************************/
+
+    // Evaluate the DoubleDouble kernels (about 32 digits) at double arguments, and sum 1000 partitions in DoubleDouble arithmetic.
+    measure("sine(DoubleDouble)", [](double x) { return sine(DoubleDouble(x)).hi; }, { 0.5, 50.0, MAXIMUM_x * 0.999 }, -MAXIMUM_x, MAXIMUM_x);
+    measure("cosine(DoubleDouble)", [](double x) { return cosine(DoubleDouble(x)).hi; }, { 0.5, 50.0, MAXIMUM_x * 0.999 }, -MAXIMUM_x, MAXIMUM_x);
+    measure("arctangent(DoubleDouble)", [](double x) { return arctangent(DoubleDouble(x)).hi; }, { 0.5, 50.0, MAXIMUM_x * 0.999 }, -MAXIMUM_x, MAXIMUM_x);
+    measure("ln(DoubleDouble)", [](double x) { return ln(DoubleDouble(x)).hi; }, { 0.5, 50.0, MAXIMUM_x * 0.999 }, 1e-3, MAXIMUM_x);
+    measure("power_of_e_to_x(DoubleDouble)", [](double x) { return power_of_e_to_x(DoubleDouble(x)).hi; }, { -50.0, 0.5, 700.0 }, -700.0, 700.0);
+    const std::function<DoubleDouble(const DoubleDouble &)> dd_sine = [](const DoubleDouble & x) { return sine(x); };
+    measure("computeRiemannSum<DoubleDouble>/midpoint/sin:n=1000", [&](double b) { return computeRiemannSum<DoubleDouble>(dd_sine, DoubleDouble(0.0), DoubleDouble(b), 1000, "midpoint").hi; }, { 0.5, 50.0, MAXIMUM_RIEMANN_SUM_a * 0.999 }, 0.001, MAXIMUM_RIEMANN_SUM_a);
+    std::vector<DoubleDouble> dd_input(parallel_input.begin(), parallel_input.end()), dd_output(parallel_length);
+    const DoubleDoubleBatchKernel dd_sine_kernel = [](const DoubleDouble * x, DoubleDouble * y, long long count) { for (long long k = 0; k < count; k += 1) y[k] = sine(x[k]); };
+    measureBatch("evaluateParallel/sine(DoubleDouble)" + threads_suffix, parallel_length, [&]() { evaluateParallel(pool, dd_sine_kernel, dd_input.data(), dd_output.data(), parallel_length, 16); doNotOptimize(dd_output[0].hi); });
+
+    /*****************************/
+    /* interval arithmetic       */
+    /*****************************/
+
+    // Evaluate the Interval kernels on intervals of width 0.01, and enclose the integrals of sin(x) and sqrt(x) with 1000 partitions (compare to computeRiemannSum/midpoint:n=1000).
+    const std::array<IntervalFunction, 6> interval_functions = generate_array_of_interval_functions();
+    measure("sine(Interval)", [](double x) { return sine(Interval(x, x + 0.01)).upper; }, { 0.5, 50.0, MAXIMUM_x * 0.99 }, -MAXIMUM_x, MAXIMUM_x * 0.99);
+    measure("ln(Interval)", [](double x) { return ln(Interval(x, x + 0.01)).upper; }, { 0.5, 50.0, MAXIMUM_x * 0.99 }, 1e-3, MAXIMUM_x * 0.99);
+    measure("computeRiemannSum/midpoint/sin:n=1000", [&](double b) { return computeRiemannSum(functions[2], 0.0, b, 1000, "midpoint"); }, { 0.5, 50.0, MAXIMUM_RIEMANN_SUM_a * 0.999 }, 0.001, MAXIMUM_RIEMANN_SUM_a);
+    measure("computeRiemannSumEnclosure/sin:n=1000", [&](double b) { return computeRiemannSumEnclosure(interval_functions[2], 0.0, b, 1000).upper; }, { 0.5, 50.0, MAXIMUM_RIEMANN_SUM_a * 0.999 }, 0.001, MAXIMUM_RIEMANN_SUM_a);
+    measure("computeRiemannSumEnclosure/sqrt:n=1000", [&](double b) { return computeRiemannSumEnclosure(interval_functions[4], 0.0, b, 1000).upper; }, { 0.5, 50.0, MAXIMUM_RIEMANN_SUM_a * 0.999 }, 0.001, MAXIMUM_RIEMANN_SUM_a);
+
+    // Print the results to the command line terminal.
+    std::cout.precision(6);
+    for (const BenchmarkResult & result : results)
+    {
+        std::cout << result.name << "\t" << result.nanoseconds_per_call << " ns/call\t" << result.calls_per_second << " calls/s\t(" << result.iterations << " iterations)\n";
+    }
+
+    // Write the results to the JSON file (if one was requested).
+    if (!output_file_name.empty())
+    {
+        std::ofstream file(output_file_name);
+        writeJson(results, minimum_seconds, file);
+        file.close();
+    }
+
+    // Exit the program.
+    return 0;
+}
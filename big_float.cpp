@@ -0,0 +1,1067 @@
+/**
+ * file: big_float.cpp
+ * type: C++ (source file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+/** preprocessing directives */
+#include <iostream> // standard output (std::cout)
+#include <algorithm> // std::max, std::min, std::reverse
+#include <cmath> // std::frexp, std::ldexp, std::log, std::log10, std::sqrt, std::floor, std::fabs, std::isfinite, std::llround
+#include <limits> // std::numeric_limits
+#include <mutex> // std::mutex, std::lock_guard
+#include "big_float.h" // BigFloat, function prototypes
+
+/*****************************/
+/* limb arithmetic           */
+/*****************************/
+
+/**
+ * Add the na limbs of a to the nr limbs of r (i.e. r += a, where the carry out of the top limb of r is discarded).
+ */
+static void addLimbs(std::uint32_t * r, std::size_t nr, const std::uint32_t * a, std::size_t na)
+{
+    std::uint64_t carry = 0;
+    std::size_t i = 0;
+    for (; i < na; i += 1)
+    {
+        carry += static_cast<std::uint64_t>(r[i]) + a[i];
+        r[i] = static_cast<std::uint32_t>(carry);
+        carry >>= 32;
+    }
+    for (; carry && (i < nr); i += 1)
+    {
+        carry += r[i];
+        r[i] = static_cast<std::uint32_t>(carry);
+        carry >>= 32;
+    }
+}
+
+/**
+ * Subtract the na limbs of a from the nr limbs of r (i.e. r -= a, where r >= a is required).
+ */
+static void subtractLimbs(std::uint32_t * r, std::size_t nr, const std::uint32_t * a, std::size_t na)
+{
+    std::int64_t borrow = 0;
+    std::size_t i = 0;
+    for (; i < na; i += 1)
+    {
+        std::int64_t difference = static_cast<std::int64_t>(r[i]) - a[i] - borrow;
+        borrow = (difference < 0) ? 1 : 0;
+        r[i] = static_cast<std::uint32_t>(difference + (borrow << 32));
+    }
+    for (; borrow && (i < nr); i += 1)
+    {
+        std::int64_t difference = static_cast<std::int64_t>(r[i]) - borrow;
+        borrow = (difference < 0) ? 1 : 0;
+        r[i] = static_cast<std::uint32_t>(difference + (borrow << 32));
+    }
+}
+
+/**
+ * Store the product of the na limbs of a and the nb limbs of b in the na + nb limbs of r (which are required to be zero).
+ *
+ * Short operands use the schoolbook method (na * nb limb products). Long operands use Karatsuba's method:
+ * with a = a1 * B + a0 and b = b1 * B + b0 (where B = 2 ^ (32 * m)),
+ *
+ * a * b = z2 * B ^ 2 + (z1 - z2 - z0) * B + z0 where z0 = a0 * b0, z2 = a1 * b1, and z1 = (a0 + a1) * (b0 + b1),
+ *
+ * which takes three half-size products instead of four (so the cost grows like n ^ 1.585 instead of n ^ 2).
+ */
+static void multiplyLimbs(const std::uint32_t * a, std::size_t na, const std::uint32_t * b, std::size_t nb, std::uint32_t * r)
+{
+    if (na < nb)
+    {
+        std::swap(a, b);
+        std::swap(na, nb);
+    }
+    if (nb == 0) return;
+
+    if (nb < KARATSUBA_THRESHOLD_LIMBS)
+    {
+        for (std::size_t i = 0; i < nb; i += 1)
+        {
+            std::uint64_t carry = 0;
+            const std::uint64_t bi = b[i];
+            if (bi == 0) continue;
+            for (std::size_t j = 0; j < na; j += 1)
+            {
+                carry += r[i + j] + bi * a[j];
+                r[i + j] = static_cast<std::uint32_t>(carry);
+                carry >>= 32;
+            }
+            r[i + na] = static_cast<std::uint32_t>(carry);
+        }
+        return;
+    }
+
+    const std::size_t m = (na + 1) / 2;
+    if (nb <= m)
+    {
+        // Unbalanced operands: multiply b by each half of a.
+        multiplyLimbs(a, m, b, nb, r);
+        std::vector<std::uint32_t> high(na - m + nb, 0);
+        multiplyLimbs(a + m, na - m, b, nb, high.data());
+        addLimbs(r + m, na + nb - m, high.data(), high.size());
+        return;
+    }
+
+    // z0 = a0 * b0 goes into r[0, 2 * m) and z2 = a1 * b1 goes into r[2 * m, na + nb).
+    multiplyLimbs(a, m, b, m, r);
+    multiplyLimbs(a + m, na - m, b + m, nb - m, r + 2 * m);
+
+    // z1 = (a0 + a1) * (b0 + b1) - z0 - z2.
+    std::vector<std::uint32_t> sum_a(a, a + m), sum_b(b, b + m);
+    sum_a.push_back(0);
+    sum_b.push_back(0);
+    addLimbs(sum_a.data(), m + 1, a + m, na - m);
+    addLimbs(sum_b.data(), m + 1, b + m, nb - m);
+    std::vector<std::uint32_t> z1(2 * m + 2, 0);
+    multiplyLimbs(sum_a.data(), m + 1, sum_b.data(), m + 1, z1.data());
+    subtractLimbs(z1.data(), z1.size(), r, 2 * m);
+    subtractLimbs(z1.data(), z1.size(), r + 2 * m, na + nb - 2 * m);
+
+    // Add z1 * B (whose limbs above na + nb - m are zero).
+    std::size_t z1_length = std::min(z1.size(), na + nb - m);
+    addLimbs(r + m, na + nb - m, z1.data(), z1_length);
+}
+
+/*****************************/
+/* BigFloat                  */
+/*****************************/
+
+/**
+ * Return the number of 32-bit limbs which hold digits significant decimal digits (plus one guard limb).
+ */
+int bigFloatLimbsForDigits(int digits)
+{
+    return static_cast<int>(std::ceil(digits * 3.3219280948873623 / 32.0)) + 1;
+}
+
+/**
+ * Return the precision (in limbs) of the result of an operation on values of precisions p and q (zero means exact).
+ */
+static int combinedPrecision(int p, int q)
+{
+    if (p == 0) return q;
+    if (q == 0) return p;
+    return std::max(p, q);
+}
+
+/**
+ * Return p (or, if p is zero, i.e. exact, the precision of DEFAULT_BIG_FLOAT_DIGITS digits).
+ */
+static int inexactPrecision(int p)
+{
+    return (p > 0) ? p : bigFloatLimbsForDigits(DEFAULT_BIG_FLOAT_DIGITS);
+}
+
+/**
+ * Construct a BigFloat which stores value exactly (and keeps digits significant decimal digits in later operations).
+ *
+ * If value is not finite (or digits is out of range), an error message is printed to the command line terminal and the
+ * BigFloat is set to zero (or digits is reset to DEFAULT_BIG_FLOAT_DIGITS).
+ */
+BigFloat::BigFloat(double value, int digits)
+{
+    // Set digits to the default value if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((digits < 1) || (digits > MAXIMUM_BIG_FLOAT_DIGITS))
+    {
+        std::cout << "\n\nThe number of BigFloat digits was out of range. Hence, the number of digits has been reset to " << DEFAULT_BIG_FLOAT_DIGITS << ".";
+        digits = DEFAULT_BIG_FLOAT_DIGITS;
+    }
+    precision = bigFloatLimbsForDigits(digits);
+    if (!std::isfinite(value))
+    {
+        std::cout << "\n\nA BigFloat cannot store an infinite value or NaN. Hence, the value has been set to 0.";
+        return;
+    }
+    if (value == 0) return;
+
+    // value = mantissa * 2 ^ (binary_exponent - 53) where mantissa is a 53-bit integer.
+    negative = (value < 0);
+    int binary_exponent = 0;
+    double fraction = std::frexp(std::fabs(value), &binary_exponent);
+    std::uint64_t mantissa = static_cast<std::uint64_t>(std::ldexp(fraction, 53));
+    long long shift = binary_exponent - 53;
+    long long limb_exponent = (shift >= 0) ? (shift / 32) : -((-shift + 31) / 32);
+    int bit_shift = static_cast<int>(shift - 32 * limb_exponent);
+    std::uint64_t low = mantissa << bit_shift;
+    std::uint64_t high = (bit_shift > 0) ? (mantissa >> (64 - bit_shift)) : 0;
+    limbs = { static_cast<std::uint32_t>(low), static_cast<std::uint32_t>(low >> 32), static_cast<std::uint32_t>(high) };
+    exponent = limb_exponent;
+    normalize();
+}
+
+/**
+ * Return 10 ^ n (rounded to precision limbs) by repeated squaring.
+ */
+static BigFloat powerOfTen(long long n, int precision)
+{
+    BigFloat result = BigFloat::exactInteger(1).withPrecisionLimbs(precision);
+    BigFloat square = BigFloat::exactInteger(10).withPrecisionLimbs(precision);
+    for (; n > 0; n >>= 1)
+    {
+        if (n & 1) result = result * square;
+        if (n > 1) square = square * square;
+    }
+    return result;
+}
+
+/**
+ * Construct a BigFloat from a decimal number such as "-12.5", "0.1", or "6.02214076e23" (which, unlike the double constructor,
+ * stores 0.1 to digits significant digits instead of storing the double which is nearest to 0.1).
+ *
+ * If decimal is not a number, an error message is printed to the command line terminal and the BigFloat is set to zero.
+ */
+BigFloat::BigFloat(const std::string & decimal, int digits) : BigFloat(0.0, digits)
+{
+    std::size_t i = 0;
+    bool is_negative = false;
+    if ((i < decimal.size()) && ((decimal[i] == '-') || (decimal[i] == '+'))) is_negative = (decimal[i++] == '-');
+
+    // Accumulate the digits (nine at a time) into an exact integer.
+    BigFloat mantissa = exactInteger(0);
+    long long decimal_exponent = 0, digit_count = 0;
+    std::uint32_t chunk = 0, chunk_scale = 1;
+    bool after_point = false;
+    for (; i < decimal.size(); i += 1)
+    {
+        char c = decimal[i];
+        if (c == '.' && !after_point)
+        {
+            after_point = true;
+            continue;
+        }
+        if ((c < '0') || (c > '9')) break;
+        chunk = chunk * 10 + static_cast<std::uint32_t>(c - '0');
+        chunk_scale *= 10;
+        digit_count += 1;
+        if (after_point) decimal_exponent -= 1;
+        if (chunk_scale == 1000000000)
+        {
+            mantissa = mantissa.multipliedBySmall(chunk_scale) + exactInteger(chunk);
+            chunk = 0;
+            chunk_scale = 1;
+        }
+    }
+    mantissa = mantissa.multipliedBySmall(chunk_scale) + exactInteger(chunk);
+    if ((i < decimal.size()) && ((decimal[i] == 'e') || (decimal[i] == 'E')) && (i + 1 < decimal.size()))
+    {
+        std::size_t end = 0;
+        try { decimal_exponent += std::stoll(decimal.substr(i + 1), &end); } catch (...) { end = 0; }
+        i += 1 + end;
+        if (end == 0) digit_count = 0;
+    }
+    if ((digit_count == 0) || (i != decimal.size()))
+    {
+        std::cout << "\n\nThe string \"" << decimal << "\" is not a decimal number. Hence, the BigFloat has been set to 0.";
+        return;
+    }
+
+    // Scale the integer by 10 ^ decimal_exponent (rounding to the precision of this BigFloat).
+    int working = precision + 1;
+    BigFloat result = mantissa.withPrecisionLimbs(working);
+    if (decimal_exponent > 0) result = result * powerOfTen(decimal_exponent, working);
+    if (decimal_exponent < 0) result = result / powerOfTen(-decimal_exponent, working);
+    result.negative = is_negative && !result.isZero();
+    *this = result.withPrecisionLimbs(precision);
+}
+
+/**
+ * Return a BigFloat which stores value exactly (and whose precision is exact).
+ */
+BigFloat BigFloat::exactInteger(long long value)
+{
+    BigFloat result;
+    result.negative = (value < 0);
+    std::uint64_t magnitude = (value < 0) ? (0 - static_cast<std::uint64_t>(value)) : static_cast<std::uint64_t>(value);
+    result.limbs = { static_cast<std::uint32_t>(magnitude), static_cast<std::uint32_t>(magnitude >> 32) };
+    result.normalize();
+    return result;
+}
+
+/**
+ * Remove the zero limbs at both ends (adjusting the exponent) and truncate the value to precision limbs.
+ */
+void BigFloat::normalize()
+{
+    while (!limbs.empty() && (limbs.back() == 0)) limbs.pop_back();
+    if ((precision > 0) && (limbs.size() > static_cast<std::size_t>(precision)))
+    {
+        std::size_t dropped = limbs.size() - precision;
+        limbs.erase(limbs.begin(), limbs.begin() + dropped);
+        exponent += static_cast<long long>(dropped);
+    }
+    std::size_t low_zeros = 0;
+    while ((low_zeros < limbs.size()) && (limbs[low_zeros] == 0)) low_zeros += 1;
+    if (low_zeros > 0)
+    {
+        limbs.erase(limbs.begin(), limbs.begin() + low_zeros);
+        exponent += static_cast<long long>(low_zeros);
+    }
+    if (limbs.empty())
+    {
+        negative = false;
+        exponent = 0;
+    }
+}
+
+/**
+ * Return the number of significant decimal digits which this BigFloat keeps (or zero if it is exact).
+ */
+int BigFloat::digits() const
+{
+    return (precision > 0) ? static_cast<int>((precision - 1) * 32 * 0.30102999566398120) : 0;
+}
+
+/**
+ * Return a copy of this BigFloat which keeps digits significant decimal digits (rounded toward zero if digits is smaller).
+ */
+BigFloat BigFloat::withDigits(int digits) const
+{
+    // Set digits to the default value if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((digits < 1) || (digits > MAXIMUM_BIG_FLOAT_DIGITS))
+    {
+        std::cout << "\n\nThe number of BigFloat digits was out of range. Hence, the number of digits has been reset to " << DEFAULT_BIG_FLOAT_DIGITS << ".";
+        digits = DEFAULT_BIG_FLOAT_DIGITS;
+    }
+    return withPrecisionLimbs(bigFloatLimbsForDigits(digits));
+}
+
+/**
+ * Return a copy of this BigFloat which keeps limbs limbs (or which is exact if limbs is zero).
+ */
+BigFloat BigFloat::withPrecisionLimbs(int limbs) const
+{
+    BigFloat result = *this;
+    result.precision = (limbs > 0) ? limbs : 0;
+    result.normalize();
+    return result;
+}
+
+/**
+ * Return the number of bits of the integer part of |x| counted from the binary point, i.e. the e for which 2 ^ (e - 1) <= |x| < 2 ^ e
+ * (e.g. 1 for 1.5 and -2 for 0.2), or LLONG_MIN / 2 if this BigFloat is zero.
+ */
+long long BigFloat::magnitudeBits() const
+{
+    if (isZero()) return std::numeric_limits<long long>::min() / 2;
+    long long bits = 32 * top();
+    for (std::uint32_t leading = limbs.back(); !(leading & 0x80000000u); leading <<= 1) bits -= 1;
+    return bits;
+}
+
+/**
+ * Return the double which is nearest to this BigFloat (from its three most significant limbs).
+ */
+double BigFloat::toDouble() const
+{
+    double value = 0.0;
+    std::size_t first = (limbs.size() > 3) ? (limbs.size() - 3) : 0;
+    for (std::size_t i = first; i < limbs.size(); i += 1)
+    {
+        // Clamp the power of two (so that huge exponents give infinity or zero instead of overflowing the int argument of std::ldexp).
+        long long bits = 32 * (exponent + static_cast<long long>(i));
+        bits = std::max(-100000LL, std::min(100000LL, bits));
+        value += std::ldexp(static_cast<double>(limbs[i]), static_cast<int>(bits));
+    }
+    return negative ? -value : value;
+}
+
+/**
+ * Return the negative of this BigFloat.
+ */
+BigFloat BigFloat::operator - () const
+{
+    BigFloat result = *this;
+    if (!result.isZero()) result.negative = !negative;
+    return result;
+}
+
+/**
+ * Return this BigFloat times factor.
+ */
+BigFloat BigFloat::multipliedBySmall(std::uint32_t factor) const
+{
+    BigFloat result = *this;
+    std::uint64_t carry = 0;
+    for (std::uint32_t & limb : result.limbs)
+    {
+        carry += static_cast<std::uint64_t>(limb) * factor;
+        limb = static_cast<std::uint32_t>(carry);
+        carry >>= 32;
+    }
+    if (carry) result.limbs.push_back(static_cast<std::uint32_t>(carry));
+    result.normalize();
+    return result;
+}
+
+/**
+ * Return this BigFloat divided by divisor (rounded toward zero to the precision of this BigFloat, or to
+ * DEFAULT_BIG_FLOAT_DIGITS digits if this BigFloat is exact).
+ *
+ * If divisor is zero, an error message is printed to the command line terminal and zero is returned.
+ */
+BigFloat BigFloat::dividedBySmall(std::uint32_t divisor) const
+{
+    if (divisor == 0)
+    {
+        std::cout << "\n\nDivision by zero. Hence, the quotient has been set to 0.";
+        return BigFloat().withPrecisionLimbs(precision);
+    }
+    BigFloat result = *this;
+    result.precision = inexactPrecision(precision);
+    if (result.isZero()) return result;
+
+    // Append zero limbs below the value so that the quotient keeps precision + 1 limbs.
+    std::size_t extra = static_cast<std::size_t>(result.precision) + 1;
+    result.limbs.insert(result.limbs.begin(), extra, 0);
+    result.exponent -= static_cast<long long>(extra);
+    std::uint64_t remainder = 0;
+    for (std::size_t i = result.limbs.size(); i-- > 0;)
+    {
+        std::uint64_t current = (remainder << 32) | result.limbs[i];
+        result.limbs[i] = static_cast<std::uint32_t>(current / divisor);
+        remainder = current % divisor;
+    }
+    result.normalize();
+    return result;
+}
+
+/**
+ * Return this BigFloat times 2 ^ bits.
+ */
+BigFloat BigFloat::scaledByPowerOfTwo(long long bits) const
+{
+    long long limb_shift = (bits >= 0) ? (bits / 32) : -((-bits + 31) / 32);
+    int bit_shift = static_cast<int>(bits - 32 * limb_shift);
+    BigFloat result = (bit_shift > 0) ? multipliedBySmall(static_cast<std::uint32_t>(1) << bit_shift) : *this;
+    if (!result.isZero()) result.exponent += limb_shift;
+    return result;
+}
+
+/**
+ * Return the integer part of this BigFloat (i.e. this BigFloat rounded toward zero to an integer).
+ */
+BigFloat BigFloat::integerPart() const
+{
+    if (exponent >= 0) return *this;
+    BigFloat result = *this;
+    if (top() <= 0) result.limbs.clear();
+    else
+    {
+        result.limbs.erase(result.limbs.begin(), result.limbs.begin() + static_cast<std::size_t>(-exponent));
+        result.exponent = 0;
+    }
+    result.normalize();
+    return result;
+}
+
+/**
+ * Return -1, 0, or 1 if |u| is smaller than, equal to, or larger than |v|.
+ */
+int BigFloat::compareMagnitudes(const BigFloat & u, const BigFloat & v)
+{
+    if (u.isZero() || v.isZero()) return (u.isZero() ? 0 : 1) - (v.isZero() ? 0 : 1);
+    if (u.top() != v.top()) return (u.top() < v.top()) ? -1 : 1;
+    long long lowest = std::min(u.exponent, v.exponent);
+    for (long long position = u.top() - 1; position >= lowest; position -= 1)
+    {
+        std::uint32_t a = (position >= u.exponent) ? u.limbs[static_cast<std::size_t>(position - u.exponent)] : 0;
+        std::uint32_t b = (position >= v.exponent) ? v.limbs[static_cast<std::size_t>(position - v.exponent)] : 0;
+        if (a != b) return (a < b) ? -1 : 1;
+    }
+    return 0;
+}
+
+/**
+ * Return -1, 0, or 1 if u is smaller than, equal to, or larger than v.
+ */
+int compare(const BigFloat & u, const BigFloat & v)
+{
+    if (u.negative != v.negative) return u.negative ? -1 : 1;
+    int magnitude = BigFloat::compareMagnitudes(u, v);
+    return u.negative ? -magnitude : magnitude;
+}
+
+/**
+ * Return |u| + |v| with the given sign and precision (the limbs which are below the precision of the result are ignored).
+ */
+BigFloat BigFloat::addMagnitudes(const BigFloat & u, const BigFloat & v, bool negative, int precision)
+{
+    long long highest = std::max(u.top(), v.top());
+    long long lowest = std::min(u.exponent, v.exponent);
+    if (precision > 0) lowest = std::max(lowest, highest - precision - 1);
+
+    BigFloat result;
+    result.precision = precision;
+    result.negative = negative;
+    result.exponent = lowest;
+    result.limbs.assign(static_cast<std::size_t>(highest - lowest + 1), 0);
+    for (const BigFloat * operand : { &u, &v })
+    {
+        long long first = std::max(operand->exponent, lowest);
+        if (first >= operand->top()) continue;
+        addLimbs(result.limbs.data() + (first - lowest), result.limbs.size() - static_cast<std::size_t>(first - lowest), operand->limbs.data() + (first - operand->exponent), static_cast<std::size_t>(operand->top() - first));
+    }
+    result.normalize();
+    return result;
+}
+
+/**
+ * Return |u| - |v| (where |u| >= |v|) with the given sign and precision.
+ */
+BigFloat BigFloat::subtractMagnitudes(const BigFloat & u, const BigFloat & v, bool negative, int precision)
+{
+    long long highest = u.top();
+    long long lowest = std::min(u.exponent, v.exponent);
+    if (precision > 0) lowest = std::max(lowest, highest - precision - 1);
+
+    BigFloat result;
+    result.precision = precision;
+    result.negative = negative;
+    result.exponent = lowest;
+    result.limbs.assign(static_cast<std::size_t>(highest - lowest), 0);
+    long long first = std::max(u.exponent, lowest);
+    std::copy(u.limbs.begin() + (first - u.exponent), u.limbs.end(), result.limbs.begin() + (first - lowest));
+    first = std::max(v.exponent, lowest);
+    if (first < v.top()) subtractLimbs(result.limbs.data() + (first - lowest), result.limbs.size() - static_cast<std::size_t>(first - lowest), v.limbs.data() + (first - v.exponent), static_cast<std::size_t>(v.top() - first));
+    result.normalize();
+    return result;
+}
+
+/**
+ * Return u + v.
+ */
+BigFloat operator + (const BigFloat & u, const BigFloat & v)
+{
+    int precision = combinedPrecision(u.precision, v.precision);
+    if (v.isZero()) return u.withPrecisionLimbs(precision);
+    if (u.isZero()) return v.withPrecisionLimbs(precision);
+    if (u.negative == v.negative) return BigFloat::addMagnitudes(u, v, u.negative, precision);
+    int magnitude = BigFloat::compareMagnitudes(u, v);
+    if (magnitude == 0) return BigFloat().withPrecisionLimbs(precision);
+    return (magnitude > 0) ? BigFloat::subtractMagnitudes(u, v, u.negative, precision) : BigFloat::subtractMagnitudes(v, u, v.negative, precision);
+}
+
+/**
+ * Return u - v.
+ */
+BigFloat operator - (const BigFloat & u, const BigFloat & v)
+{
+    return u + (-v);
+}
+
+/**
+ * Return u * v (where only the precision + 1 most significant limbs of each operand take part in the product).
+ */
+BigFloat operator * (const BigFloat & u, const BigFloat & v)
+{
+    BigFloat result;
+    result.precision = combinedPrecision(u.precision, v.precision);
+    if (u.isZero() || v.isZero()) return result;
+
+    std::size_t keep = (result.precision > 0) ? static_cast<std::size_t>(result.precision) + 1 : static_cast<std::size_t>(-1);
+    std::size_t u_skip = (u.limbs.size() > keep) ? (u.limbs.size() - keep) : 0;
+    std::size_t v_skip = (v.limbs.size() > keep) ? (v.limbs.size() - keep) : 0;
+    std::size_t nu = u.limbs.size() - u_skip, nv = v.limbs.size() - v_skip;
+    result.limbs.assign(nu + nv, 0);
+    multiplyLimbs(u.limbs.data() + u_skip, nu, v.limbs.data() + v_skip, nv, result.limbs.data());
+    result.exponent = u.exponent + v.exponent + static_cast<long long>(u_skip + v_skip);
+    result.negative = (u.negative != v.negative);
+    result.normalize();
+    return result;
+}
+
+/**
+ * Return 1 / (this BigFloat) to precision limbs using Newton's method, y <-- y + y * (1 - d * y),
+ * which doubles the number of correct bits per iteration (starting from the 53 bits of a double).
+ */
+BigFloat BigFloat::reciprocal(int precision) const
+{
+    // Scale d into [2 ^ -32, 1) so that its double approximation neither overflows nor underflows.
+    BigFloat d = withPrecisionLimbs(precision + 1);
+    long long scale = d.top();
+    d.exponent -= scale;
+    d.negative = false;
+    BigFloat one = exactInteger(1);
+    BigFloat y = BigFloat(1.0 / d.toDouble()).withPrecisionLimbs(precision + 1);
+    for (long long bits = 50; bits < 32LL * (precision + 1); bits *= 2) y = y + y * (one - d * y);
+    y = y + y * (one - d * y);
+    y.exponent -= scale;
+    y.negative = negative;
+    return y.withPrecisionLimbs(precision);
+}
+
+/**
+ * Return u / v.
+ *
+ * If v is zero, an error message is printed to the command line terminal and zero is returned.
+ */
+BigFloat operator / (const BigFloat & u, const BigFloat & v)
+{
+    int precision = inexactPrecision(combinedPrecision(u.precision, v.precision));
+    if (v.isZero())
+    {
+        std::cout << "\n\nDivision by zero. Hence, the quotient has been set to 0.";
+        return BigFloat().withPrecisionLimbs(precision);
+    }
+    return (u.withPrecisionLimbs(precision + 1) * v.reciprocal(precision + 1)).withPrecisionLimbs(precision);
+}
+
+/**
+ * Return the decimal digits of the exact non-negative integer n (by repeated division by 10 ^ 9).
+ */
+static std::string integerToDecimal(std::vector<std::uint32_t> n)
+{
+    std::string reversed;
+    while (!n.empty())
+    {
+        std::uint64_t remainder = 0;
+        for (std::size_t i = n.size(); i-- > 0;)
+        {
+            std::uint64_t current = (remainder << 32) | n[i];
+            n[i] = static_cast<std::uint32_t>(current / 1000000000);
+            remainder = current % 1000000000;
+        }
+        while (!n.empty() && (n.back() == 0)) n.pop_back();
+        for (int k = 0; k < 9; k += 1)
+        {
+            if (n.empty() && (remainder == 0)) break;
+            reversed.push_back(static_cast<char>('0' + remainder % 10));
+            remainder /= 10;
+        }
+    }
+    if (reversed.empty()) reversed.push_back('0');
+    std::reverse(reversed.begin(), reversed.end());
+    return reversed;
+}
+
+/**
+ * Return this BigFloat as a decimal number of digits significant digits (or of all of its significant digits if digits is zero),
+ * e.g. "3.14159", "-0.001", or "6.02214076e+23" (trailing zeros after the decimal point are omitted).
+ */
+std::string BigFloat::toString(int digits) const
+{
+    if (isZero()) return "0";
+    if (digits <= 0) digits = (precision > 0) ? this->digits() : std::max(1, static_cast<int>((top() > 0 ? top() : 1) * 32 * 0.30102999566398120) + 1);
+    if (digits > MAXIMUM_BIG_FLOAT_DIGITS) digits = MAXIMUM_BIG_FLOAT_DIGITS;
+
+    // Estimate the decimal exponent, E = floor(log10(|x|)), from the leading limbs.
+    BigFloat magnitude = *this;
+    magnitude.negative = false;
+    BigFloat leading = magnitude;
+    leading.exponent -= top();
+    long long decimal_exponent = static_cast<long long>(std::floor(std::log10(leading.toDouble()) + 32.0 * top() * 0.30102999566398120));
+
+    // Compute N = round(|x| * 10 ^ (digits - 1 - E)), which has exactly digits decimal digits if E is right.
+    const int working = bigFloatLimbsForDigits(digits) + 2;
+    std::string mantissa;
+    for (int attempt = 0; attempt < 3; attempt += 1)
+    {
+        long long shift = digits - 1 - decimal_exponent;
+        BigFloat scaled = magnitude.withPrecisionLimbs(working);
+        if (shift > 0) scaled = scaled * powerOfTen(shift, working);
+        if (shift < 0) scaled = scaled / powerOfTen(-shift, working);
+        BigFloat n = (scaled + BigFloat(0.5)).integerPart();
+        std::vector<std::uint32_t> integer_limbs(static_cast<std::size_t>(n.exponent), 0);
+        integer_limbs.insert(integer_limbs.end(), n.limbs.begin(), n.limbs.end());
+        mantissa = integerToDecimal(integer_limbs);
+        if (static_cast<int>(mantissa.size()) > digits) decimal_exponent += 1;
+        else if (static_cast<int>(mantissa.size()) < digits) decimal_exponent -= 1;
+        else break;
+    }
+    if (static_cast<int>(mantissa.size()) > digits) mantissa.resize(digits);
+    while ((mantissa.size() > 1) && (mantissa.back() == '0')) mantissa.pop_back();
+
+    // Place the decimal point (or use scientific notation for very large and very small magnitudes).
+    std::string text = negative ? "-" : "";
+    if ((decimal_exponent >= 0) && (decimal_exponent < 40))
+    {
+        std::size_t integer_digits = static_cast<std::size_t>(decimal_exponent) + 1;
+        if (mantissa.size() <= integer_digits) text += mantissa + std::string(integer_digits - mantissa.size(), '0');
+        else text += mantissa.substr(0, integer_digits) + "." + mantissa.substr(integer_digits);
+    }
+    else if ((decimal_exponent < 0) && (decimal_exponent >= -7)) text += "0." + std::string(static_cast<std::size_t>(-decimal_exponent - 1), '0') + mantissa;
+    else
+    {
+        text += mantissa.substr(0, 1);
+        if (mantissa.size() > 1) text.append(".").append(mantissa, 1, std::string::npos);
+        text += (decimal_exponent < 0) ? "e-" : "e+";
+        text += std::to_string((decimal_exponent < 0) ? -decimal_exponent : decimal_exponent);
+    }
+    return text;
+}
+
+/*****************************/
+/* elementary functions      */
+/*****************************/
+
+/**
+ * Return true if term is too small to change sum at precision limbs (i.e. if a series whose latest term is term has converged).
+ */
+static bool isNegligible(const BigFloat & term, const BigFloat & sum, int precision)
+{
+    return term.isZero() || (term.magnitudeBits() < sum.magnitudeBits() - 32LL * precision);
+}
+
+/**
+ * Return the square root of x using Newton's method for the reciprocal square root, y <-- y + y * (1 - x * y ^ 2) / 2
+ * (which needs no division), and then sqrt(x) = x * y.
+ *
+ * If x is negative, an error message is printed to the command line terminal and zero is returned.
+ */
+BigFloat sqrt(const BigFloat & x)
+{
+    const int precision = inexactPrecision(x.precisionLimbs());
+    if (x.isNegative())
+    {
+        std::cout << "\n\nThe square root of a negative number is not a real number. Hence, the square root has been set to 0.";
+        return BigFloat().withPrecisionLimbs(precision);
+    }
+    if (x.isZero()) return x.withPrecisionLimbs(precision);
+
+    // Scale x by an even power of two, 2 ^ (-2 * h), into [0.5,2) so that sqrt(x) = sqrt(s) * 2 ^ h.
+    const long long bits = x.magnitudeBits();
+    const long long h = (bits >= 0) ? (bits / 2) : -((-bits + 1) / 2);
+    const BigFloat s = x.withPrecisionLimbs(precision + 1).scaledByPowerOfTwo(-2 * h);
+    const BigFloat one = BigFloat::exactInteger(1);
+    BigFloat y = BigFloat(1.0 / std::sqrt(s.toDouble())).withPrecisionLimbs(precision + 1);
+    for (long long correct_bits = 50; correct_bits < 32LL * (precision + 2); correct_bits *= 2) y = y + (y * (one - s * y * y)).scaledByPowerOfTwo(-1);
+    return (s * y).scaledByPowerOfTwo(h).withPrecisionLimbs(precision);
+}
+
+/**
+ * Define a struct-type variable named ChudnovskyTerms which stores the three exact integers P(a,b), Q(a,b), and T(a,b)
+ * which the binary splitting method computes for the terms a, a + 1, ..., b - 1 of the Chudnovsky series.
+ */
+struct ChudnovskyTerms {
+    BigFloat p, q, t;
+};
+
+/**
+ * Return P(a,b), Q(a,b), and T(a,b) of the Chudnovsky series,
+ *
+ * 1 / pi = 12 * sum((-1) ^ k * (6k)! * (13591409 + 545140134k) / ((3k)! * (k!) ^ 3 * 640320 ^ (3k + 3/2))),
+ *
+ * where P(a,a+1) = -(6a - 5)(2a - 1)(6a - 1), Q(a,a+1) = a ^ 3 * 640320 ^ 3 / 24, T(a,a+1) = P(a,a+1) * (13591409 + 545140134a)
+ * (and P(0,1) = Q(0,1) = 1), and where the halves [a,m) and [m,b) are combined as
+ *
+ * P(a,b) = P(a,m) * P(m,b), Q(a,b) = Q(a,m) * Q(m,b), T(a,b) = Q(m,b) * T(a,m) + P(a,m) * T(m,b).
+ *
+ * Splitting the terms in halves keeps the big integers of each product about equally long, which is where Karatsuba's method pays off.
+ */
+static ChudnovskyTerms chudnovskySplit(long long a, long long b)
+{
+    if (b - a == 1)
+    {
+        if (a == 0) return { BigFloat::exactInteger(1), BigFloat::exactInteger(1), BigFloat::exactInteger(13591409) };
+        BigFloat p = BigFloat::exactInteger(-(6 * a - 5)) * BigFloat::exactInteger(2 * a - 1) * BigFloat::exactInteger(6 * a - 1);
+        BigFloat q = BigFloat::exactInteger(a) * BigFloat::exactInteger(a) * BigFloat::exactInteger(a) * BigFloat::exactInteger(10939058860032000LL);
+        return { p, q, p * BigFloat::exactInteger(13591409 + 545140134 * a) };
+    }
+    long long m = (a + b) / 2;
+    ChudnovskyTerms left = chudnovskySplit(a, m), right = chudnovskySplit(m, b);
+    return { left.p * right.p, left.q * right.q, right.q * left.t + left.p * right.t };
+}
+
+/**
+ * Return pi to precision limbs (computed once per precision increase and then cached).
+ */
+static BigFloat piWithLimbs(int precision)
+{
+    static std::mutex mutex;
+    static BigFloat cached;
+    std::lock_guard<std::mutex> lock(mutex);
+    if (cached.precisionLimbs() < precision)
+    {
+        // Each term of the Chudnovsky series adds about 14.18 decimal digits.
+        long long terms = static_cast<long long>(32 * (precision + 1) * 0.30102999566398120 / 14.18) + 2;
+        ChudnovskyTerms sum = chudnovskySplit(0, terms);
+        BigFloat root = sqrt(BigFloat::exactInteger(10005).withPrecisionLimbs(precision + 1));
+        cached = (sum.q.multipliedBySmall(426880) * root / sum.t.withPrecisionLimbs(precision + 1)).withPrecisionLimbs(precision + 1);
+    }
+    return cached.withPrecisionLimbs(precision);
+}
+
+/**
+ * Define a struct-type variable named Ln2Terms which stores the three exact integers B(a,b), Q(a,b), and T(a,b)
+ * which the binary splitting method computes for the terms a, a + 1, ..., b - 1 of the series of ln(2).
+ */
+struct Ln2Terms {
+    BigFloat b, q, t;
+};
+
+/**
+ * Return B(a,b), Q(a,b), and T(a,b) of the series
+ *
+ * ln(2) = 2 * arctanh(1/3) = (2/3) * sum(1 / ((2k + 1) * 9 ^ k)),
+ *
+ * where B(a,a+1) = 2a + 1, Q(a,a+1) = 9 (and Q(0,1) = 1), T(a,a+1) = 1, and where the halves [a,m) and [m,b) are combined as
+ *
+ * B(a,b) = B(a,m) * B(m,b), Q(a,b) = Q(a,m) * Q(m,b), T(a,b) = B(m,b) * Q(m,b) * T(a,m) + B(a,m) * T(m,b)
+ *
+ * (so that the sum of the terms a, ..., b - 1 is T(a,b) / (B(a,b) * Q(a,b)) times 9 ^ -a).
+ */
+static Ln2Terms ln2Split(long long a, long long b)
+{
+    if (b - a == 1) return { BigFloat::exactInteger(2 * a + 1), BigFloat::exactInteger((a == 0) ? 1 : 9), BigFloat::exactInteger(1) };
+    long long m = (a + b) / 2;
+    Ln2Terms left = ln2Split(a, m), right = ln2Split(m, b);
+    return { left.b * right.b, left.q * right.q, right.b * right.q * left.t + left.b * right.t };
+}
+
+/**
+ * Return ln(2) to precision limbs (computed once per precision increase and then cached).
+ */
+static BigFloat ln2WithLimbs(int precision)
+{
+    static std::mutex mutex;
+    static BigFloat cached;
+    std::lock_guard<std::mutex> lock(mutex);
+    if (cached.precisionLimbs() < precision)
+    {
+        // Each term of the series adds log10(9) (about 0.954) decimal digits.
+        long long terms = static_cast<long long>(32 * (precision + 1) * 0.30102999566398120 / 0.954) + 2;
+        Ln2Terms sum = ln2Split(0, terms);
+        BigFloat denominator = (sum.b * sum.q).multipliedBySmall(3).withPrecisionLimbs(precision + 1);
+        cached = (sum.t.multipliedBySmall(2) / denominator).withPrecisionLimbs(precision + 1);
+    }
+    return cached.withPrecisionLimbs(precision);
+}
+
+/**
+ * Return the number of limbs of digits decimal digits (or of DEFAULT_BIG_FLOAT_DIGITS digits if digits is out of range).
+ */
+static int limbsForDigitsInRange(int digits)
+{
+    // Set digits to the default value if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((digits < 1) || (digits > MAXIMUM_BIG_FLOAT_DIGITS))
+    {
+        std::cout << "\n\nThe number of BigFloat digits was out of range. Hence, the number of digits has been reset to " << DEFAULT_BIG_FLOAT_DIGITS << ".";
+        digits = DEFAULT_BIG_FLOAT_DIGITS;
+    }
+    return bigFloatLimbsForDigits(digits);
+}
+
+/**
+ * Return pi to digits significant decimal digits.
+ *
+ * Unlike computePi(iterations) in trigonometric_functions.cpp (the Leibniz series, which gains one digit per tenfold increase
+ * in iterations), this sums the Chudnovsky series by binary splitting, which gains about 14 digits per term.
+ */
+BigFloat computePiToDigits(int digits)
+{
+    return piWithLimbs(limbsForDigitsInRange(digits));
+}
+
+/**
+ * Return ln(2) to digits significant decimal digits (which the BigFloat versions of power_of_e_to_x and ln use for range reduction).
+ */
+BigFloat computeLn2ToDigits(int digits)
+{
+    return ln2WithLimbs(limbsForDigitsInRange(digits));
+}
+
+/**
+ * Return e ^ x to the precision of x (or to DEFAULT_BIG_FLOAT_DIGITS digits if x is exact).
+ *
+ * The argument is reduced twice: first x = k * ln(2) + r with |r| <= ln(2) / 2 (so that e ^ x = 2 ^ k * e ^ r), and then r is
+ * divided by 2 ^ s (where s grows like the square root of the number of bits), so that the Taylor series of e ^ (r / 2 ^ s) - 1
+ * needs few terms. The result is squared s times, using e ^ (2t) - 1 = (e ^ t - 1) * (e ^ t - 1 + 2), which keeps the small
+ * value e ^ t - 1 (instead of e ^ t, whose leading 1 would swallow the low digits).
+ *
+ * If |x| is larger than MAXIMUM_BIG_FLOAT_REDUCED_ARGUMENT, an error message is printed to the command line terminal and zero is returned.
+ */
+BigFloat power_of_e_to_x(const BigFloat & x)
+{
+    const int precision = inexactPrecision(x.precisionLimbs());
+    const BigFloat one = BigFloat::exactInteger(1);
+    if (x.isZero()) return one.withPrecisionLimbs(precision);
+    const double approximation = x.toDouble();
+    if (!(std::fabs(approximation) <= MAXIMUM_BIG_FLOAT_REDUCED_ARGUMENT))
+    {
+        std::cout << "\n\nThe exponent, x, in power_of_e_to_x(x) was out of range. Hence, the power has been set to 0.";
+        return BigFloat().withPrecisionLimbs(precision);
+    }
+
+    // Reduce x to r = x - k * ln(2) (with two extra limbs for the digits which cancel in the subtraction).
+    const long long k = std::llround(approximation / 0.69314718055994531);
+    const int halvings = static_cast<int>(std::sqrt(32.0 * precision) / 2) + 1;
+    const int working = precision + 2 + halvings / 32;
+    BigFloat r = x.withPrecisionLimbs(working) - ln2WithLimbs(working) * BigFloat::exactInteger(k);
+    r = r.scaledByPowerOfTwo(-halvings);
+
+    // Sum the Taylor series of e ^ r - 1 = r + r ^ 2 / 2! + r ^ 3 / 3! + ...
+    BigFloat sum = r, term = r;
+    for (std::uint32_t n = 2; !r.isZero(); n += 1)
+    {
+        term = (term * r).dividedBySmall(n);
+        if (isNegligible(term, sum, working)) break;
+        sum += term;
+    }
+
+    // Undo the halvings.
+    const BigFloat two = BigFloat::exactInteger(2);
+    for (int i = 0; i < halvings; i += 1) sum = sum * (sum + two);
+    return (sum + one).scaledByPowerOfTwo(k).withPrecisionLimbs(precision);
+}
+
+/**
+ * Return the natural logarithm of x to the precision of x (or to DEFAULT_BIG_FLOAT_DIGITS digits if x is exact).
+ *
+ * With x = m * 2 ^ e (where 0.5 <= m < 1), ln(x) = ln(m) + e * ln(2), and ln(m) is the root y of e ^ y = m, which
+ * Halley's method, y <-- y + 2 * (m - e ^ y) / (m + e ^ y), finds by tripling the number of correct bits per iteration
+ * (starting from the 53 bits of std::log, and raising the working precision along with the number of correct bits).
+ * For x near 1, the series ln(x) = 2 * arctanh(z) = 2 * (z + z ^ 3 / 3 + z ^ 5 / 5 + ...), where z = (x - 1) / (x + 1), is used
+ * instead (so that the small result keeps all of its digits).
+ *
+ * If x is not positive, an error message is printed to the command line terminal and zero is returned.
+ */
+BigFloat ln(const BigFloat & x)
+{
+    const int precision = inexactPrecision(x.precisionLimbs());
+    if (x.isNegative() || x.isZero())
+    {
+        std::cout << "\n\nThe logarithm of a non-positive number is not a real number. Hence, the logarithm has been set to 0.";
+        return BigFloat().withPrecisionLimbs(precision);
+    }
+    const int working = precision + 2;
+    const BigFloat one = BigFloat::exactInteger(1);
+    const BigFloat difference = x.withPrecisionLimbs(working) - one;
+    if (difference.isZero()) return BigFloat().withPrecisionLimbs(precision);
+
+    if (difference.magnitudeBits() <= -6)
+    {
+        // |x - 1| < 1/32: sum the series of 2 * arctanh(z), each term of which adds at least 12 bits.
+        const BigFloat z = difference / (x.withPrecisionLimbs(working) + one);
+        const BigFloat z_squared = z * z;
+        BigFloat sum = z, power = z;
+        for (std::uint32_t n = 3; ; n += 2)
+        {
+            power = power * z_squared;
+            BigFloat term = power.dividedBySmall(n);
+            if (isNegligible(term, sum, working)) break;
+            sum += term;
+        }
+        return sum.scaledByPowerOfTwo(1).withPrecisionLimbs(precision);
+    }
+
+    const long long e = x.magnitudeBits();
+    const BigFloat m = x.withPrecisionLimbs(working).scaledByPowerOfTwo(-e);
+    BigFloat y = BigFloat(std::log(m.toDouble()));
+    for (long long correct_bits = 50; correct_bits < 32LL * working; correct_bits *= 3)
+    {
+        const int step_precision = std::min(working, static_cast<int>(3 * correct_bits / 32) + 2);
+        const BigFloat m_step = m.withPrecisionLimbs(step_precision);
+        const BigFloat power = power_of_e_to_x(y.withPrecisionLimbs(step_precision));
+        y = y.withPrecisionLimbs(step_precision) + ((m_step - power) / (m_step + power)).scaledByPowerOfTwo(1);
+    }
+    return (y + ln2WithLimbs(working) * BigFloat::exactInteger(e)).withPrecisionLimbs(precision);
+}
+
+/**
+ * Return the logarithm of x to the base logarithmic_base, ln(x) / ln(logarithmic_base).
+ *
+ * If logarithmic_base is not positive or is 1, an error message is printed to the command line terminal and zero is returned.
+ */
+BigFloat logarithm(const BigFloat & x, const BigFloat & logarithmic_base)
+{
+    if (logarithmic_base.isNegative() || logarithmic_base.isZero() || (logarithmic_base == BigFloat::exactInteger(1)))
+    {
+        std::cout << "\n\nThe logarithmic base is required to be a positive number other than 1. Hence, the logarithm has been set to 0.";
+        return BigFloat().withPrecisionLimbs(inexactPrecision(x.precisionLimbs()));
+    }
+    return ln(x) / ln(logarithmic_base);
+}
+
+/**
+ * Return base ^ exponent = e ^ (exponent * ln(base)).
+ *
+ * A negative base is accepted only with an integer exponent (and 0 ^ exponent only with a positive exponent). Otherwise an
+ * error message is printed to the command line terminal and zero is returned.
+ */
+BigFloat power(const BigFloat & base, const BigFloat & exponent)
+{
+    const int precision = inexactPrecision(std::max(base.precisionLimbs(), exponent.precisionLimbs()));
+    const bool integer_exponent = (compare(exponent.integerPart(), exponent) == 0);
+    if ((base.isZero() && (exponent.isNegative() || exponent.isZero())) || (base.isNegative() && !integer_exponent))
+    {
+        std::cout << "\n\nThe power is not a real number. Hence, the power has been set to 0.";
+        return BigFloat().withPrecisionLimbs(precision);
+    }
+    if (base.isZero()) return BigFloat().withPrecisionLimbs(precision);
+    const BigFloat magnitude = base.isNegative() ? -base : base;
+    BigFloat result = power_of_e_to_x((exponent * ln(magnitude.withPrecisionLimbs(precision))).withPrecisionLimbs(precision));
+
+    // (-b) ^ n = -(b ^ n) if n is odd.
+    if (base.isNegative())
+    {
+        const BigFloat half = exponent.withPrecisionLimbs(0).scaledByPowerOfTwo(-1);
+        if (compare(half.integerPart(), half) != 0) result = -result;
+    }
+    return result;
+}
+
+/**
+ * Return sin(x) (if cosine_wanted is false) or cos(x) (if cosine_wanted is true) to the precision of x.
+ *
+ * x is reduced to r = x - k * pi / 2 with |r| <= pi / 4 (using enough extra digits of pi that r keeps the precision of x even
+ * if x is very close to a multiple of pi / 2), and the Taylor series of sin(r) or cos(r) is chosen by the quadrant k mod 4.
+ */
+static BigFloat sineOrCosine(const BigFloat & x, bool cosine_wanted)
+{
+    const int precision = inexactPrecision(x.precisionLimbs());
+    const double approximation = x.toDouble();
+    if (!(std::fabs(approximation) <= MAXIMUM_BIG_FLOAT_REDUCED_ARGUMENT))
+    {
+        std::cout << "\n\nThe number of radians, x, in " << (cosine_wanted ? "cosine" : "sine") << "(x) was out of range. Hence, the result has been set to 0.";
+        return BigFloat().withPrecisionLimbs(precision);
+    }
+    const long long k = std::llround(approximation / 1.5707963267948966);
+    int extra = 2 + static_cast<int>(std::max(0LL, x.magnitudeBits()) / 32);
+    BigFloat r;
+    for (int attempt = 0; attempt < 2; attempt += 1)
+    {
+        r = x.withPrecisionLimbs(precision + extra) - piWithLimbs(precision + extra).scaledByPowerOfTwo(-1) * BigFloat::exactInteger(k);
+        if (r.isZero() || (r.magnitudeBits() > -32)) break;
+        extra += static_cast<int>(-r.magnitudeBits() / 32) + 1;
+    }
+
+    const int quadrant = static_cast<int>(((k % 4) + 4) % 4);
+    const bool cosine_series = (cosine_wanted == (quadrant % 2 == 0));
+    const bool negated = cosine_wanted ? ((quadrant == 1) || (quadrant == 2)) : (quadrant >= 2);
+
+    // Sum sin(r) = r - r ^ 3 / 3! + r ^ 5 / 5! - ... or cos(r) = 1 - r ^ 2 / 2! + r ^ 4 / 4! - ...
+    const int working = precision + 1;
+    r = r.withPrecisionLimbs(working);
+    const BigFloat r_squared = r * r;
+    BigFloat term = cosine_series ? BigFloat::exactInteger(1).withPrecisionLimbs(working) : r;
+    BigFloat sum = term;
+    for (std::uint32_t n = cosine_series ? 0 : 1; !r.isZero(); n += 2)
+    {
+        term = -(term * r_squared).dividedBySmall((n + 1) * (n + 2));
+        if (isNegligible(term, sum, working)) break;
+        sum += term;
+    }
+    return (negated ? -sum : sum).withPrecisionLimbs(precision);
+}
+
+/**
+ * Return sin(x) to the precision of x (or to DEFAULT_BIG_FLOAT_DIGITS digits if x is exact).
+ */
+BigFloat sine(const BigFloat & x)
+{
+    return sineOrCosine(x, false);
+}
+
+/**
+ * Return cos(x) to the precision of x (or to DEFAULT_BIG_FLOAT_DIGITS digits if x is exact).
+ */
+BigFloat cosine(const BigFloat & x)
+{
+    return sineOrCosine(x, true);
+}
@@ -0,0 +1,102 @@
+/**
+ * file: big_float.h
+ * type: C++ (header file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+#ifndef BIG_FLOAT_H
+#define BIG_FLOAT_H
+
+/** preprocessing directives */
+#include <cstdint> // std::uint32_t
+#include <string> // std::string
+#include <vector> // std::vector
+#define DEFAULT_BIG_FLOAT_DIGITS 100 // constant which represents the default number of significant decimal digits of a BigFloat
+#define MAXIMUM_BIG_FLOAT_DIGITS 1000000 // constant which represents the maximum number of significant decimal digits of a BigFloat
+#define MAXIMUM_BIG_FLOAT_REDUCED_ARGUMENT 1e15 // constant which represents the maximum magnitude of x accepted by the BigFloat versions of power_of_e_to_x, sine, and cosine
+#define KARATSUBA_THRESHOLD_LIMBS 40 // constant which represents the number of 32-bit limbs below which multiplication uses the schoolbook method
+
+/**
+ * A BigFloat is an arbitrary-precision binary floating-point number:
+ *
+ * value = (-1) ^ negative * (limbs[0] + limbs[1] * 2 ^ 32 + limbs[2] * 2 ^ 64 + ...) * 2 ^ (32 * exponent)
+ *
+ * where each limb is a 32-bit unsigned integer and where at most precision limbs are kept (the lower limbs of every result
+ * are truncated). A BigFloat of precision zero is exact: its limbs are never truncated (which is how the binary splitting
+ * sums compute their big integers).
+ *
+ * The precision of a result is the larger precision of its operands (an exact operand adopts the precision of the other one).
+ * Multiplication uses the schoolbook method for short operands and Karatsuba's method (three half-size products instead of
+ * four) once both operands have KARATSUBA_THRESHOLD_LIMBS limbs or more. Division and square roots use Newton's method.
+ */
+class BigFloat
+{
+public:
+    BigFloat() {}
+    BigFloat(double value, int digits = DEFAULT_BIG_FLOAT_DIGITS);
+    BigFloat(const std::string & decimal, int digits = DEFAULT_BIG_FLOAT_DIGITS);
+    static BigFloat exactInteger(long long value);
+
+    int digits() const;
+    int precisionLimbs() const { return precision; }
+    BigFloat withDigits(int digits) const;
+    BigFloat withPrecisionLimbs(int limbs) const;
+    bool isZero() const { return limbs.empty(); }
+    bool isNegative() const { return negative; }
+    long long magnitudeBits() const;
+    double toDouble() const;
+    std::string toString(int digits = 0) const;
+
+    BigFloat operator - () const;
+    BigFloat multipliedBySmall(std::uint32_t factor) const;
+    BigFloat dividedBySmall(std::uint32_t divisor) const;
+    BigFloat scaledByPowerOfTwo(long long bits) const;
+    BigFloat integerPart() const;
+
+    friend BigFloat operator + (const BigFloat & u, const BigFloat & v);
+    friend BigFloat operator - (const BigFloat & u, const BigFloat & v);
+    friend BigFloat operator * (const BigFloat & u, const BigFloat & v);
+    friend BigFloat operator / (const BigFloat & u, const BigFloat & v);
+    friend int compare(const BigFloat & u, const BigFloat & v);
+
+    BigFloat & operator += (const BigFloat & v) { return *this = *this + v; }
+    BigFloat & operator -= (const BigFloat & v) { return *this = *this - v; }
+    BigFloat & operator *= (const BigFloat & v) { return *this = *this * v; }
+    BigFloat & operator /= (const BigFloat & v) { return *this = *this / v; }
+
+private:
+    static BigFloat addMagnitudes(const BigFloat & u, const BigFloat & v, bool negative, int precision);
+    static BigFloat subtractMagnitudes(const BigFloat & u, const BigFloat & v, bool negative, int precision);
+    static int compareMagnitudes(const BigFloat & u, const BigFloat & v);
+    BigFloat reciprocal(int precision) const;
+    void normalize();
+    long long top() const { return exponent + static_cast<long long>(limbs.size()); }
+
+    std::vector<std::uint32_t> limbs; // least significant limb first (and a non-zero most significant limb)
+    long long exponent = 0; // the power of 2 ^ 32 by which the limbs are scaled
+    bool negative = false;
+    int precision = 0; // the maximum number of limbs which are kept (or zero if the value is exact)
+};
+
+inline bool operator < (const BigFloat & u, const BigFloat & v) { return compare(u, v) < 0; }
+inline bool operator > (const BigFloat & u, const BigFloat & v) { return compare(u, v) > 0; }
+inline bool operator <= (const BigFloat & u, const BigFloat & v) { return compare(u, v) <= 0; }
+inline bool operator >= (const BigFloat & u, const BigFloat & v) { return compare(u, v) >= 0; }
+inline bool operator == (const BigFloat & u, const BigFloat & v) { return compare(u, v) == 0; }
+inline bool operator != (const BigFloat & u, const BigFloat & v) { return compare(u, v) != 0; }
+
+/** function prototypes */
+int bigFloatLimbsForDigits(int digits);
+BigFloat sqrt(const BigFloat & x);
+BigFloat computePiToDigits(int digits);
+BigFloat computeLn2ToDigits(int digits);
+BigFloat power_of_e_to_x(const BigFloat & x);
+BigFloat ln(const BigFloat & x);
+BigFloat logarithm(const BigFloat & x, const BigFloat & logarithmic_base);
+BigFloat power(const BigFloat & base, const BigFloat & exponent);
+BigFloat sine(const BigFloat & x);
+BigFloat cosine(const BigFloat & x);
+
+#endif // BIG_FLOAT_H
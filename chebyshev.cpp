@@ -0,0 +1,224 @@
+/**
+ * file: chebyshev.cpp
+ * type: C++ (source file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+/** preprocessing directives */
+#include <iostream> // standard output (std::cout)
+#include <cmath> // std::cos, std::fabs, std::isfinite
+#include <complex> // std::complex, std::polar
+#include <limits> // std::numeric_limits
+#include <utility> // std::move, std::swap
+#include "chebyshev.h" // ChebyshevExpansion
+
+/**
+ * Replace values (whose length is a power of two) by its discrete Fourier transform, W_k = sum over j of w_j * exp(-2 * Pi * i * j * k / length),
+ * using the iterative radix-2 Cooley-Tukey algorithm.
+ */
+static void fastFourierTransform(std::vector<std::complex<double>> & values)
+{
+    const std::size_t length = values.size();
+
+    // Reorder the values by bit-reversed index.
+    for (std::size_t i = 1, j = 0; i < length; i += 1)
+    {
+        std::size_t bit = length >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) std::swap(values[i], values[j]);
+    }
+
+    // Combine pairs of transforms of length half into transforms of length 2 * half.
+    const double pi = 3.14159265358979323846;
+    for (std::size_t half = 1; half < length; half <<= 1)
+    {
+        for (std::size_t k = 0; k < half; k += 1)
+        {
+            std::complex<double> twiddle = std::polar(1.0, -pi * static_cast<double>(k) / static_cast<double>(half));
+            for (std::size_t start = 0; start < length; start += 2 * half)
+            {
+                std::complex<double> even = values[start + k];
+                std::complex<double> odd = twiddle * values[start + k + half];
+                values[start + k] = even + odd;
+                values[start + k + half] = even - odd;
+            }
+        }
+    }
+}
+
+/**
+ * Return the Chebyshev coefficients c_0, ..., c_n of the polynomial of degree n which interpolates the samples
+ * v_j = f(x_j) at the n + 1 Chebyshev points x_j = cos(Pi * j / n) (of the interval [-1, 1]).
+ *
+ * That is the type-I discrete cosine transform c_k = (2 / n) * (v_0 / 2 + v_1 * cos(Pi * k / n) + ... + v_n * cos(Pi * k) / 2)
+ * (with c_0 and c_n halved), which is computed as the Fourier transform of the even extension v_0, ..., v_n, v_(n - 1), ..., v_1.
+ */
+static std::vector<double> cosineTransformOfSamples(const std::vector<double> & samples)
+{
+    const std::size_t n = samples.size() - 1;
+    std::vector<std::complex<double>> extension(2 * n);
+    for (std::size_t j = 0; j <= n; j += 1) extension[j] = samples[j];
+    for (std::size_t j = 1; j < n; j += 1) extension[2 * n - j] = samples[j];
+    fastFourierTransform(extension);
+
+    std::vector<double> coefficients(n + 1);
+    for (std::size_t k = 0; k <= n; k += 1) coefficients[k] = extension[k].real() / static_cast<double>(n);
+    coefficients[0] /= 2;
+    coefficients[n] /= 2;
+    return coefficients;
+}
+
+/**
+ * Fit a Chebyshev expansion to func on the x-axis interval [a,b].
+ *
+ * The degree starts at MINIMUM_CHEBYSHEV_DEGREE and doubles (reusing every earlier sample) until the last eighth of the
+ * coefficients are all smaller than CHEBYSHEV_TOLERANCE times the largest sample (in which case the trailing coefficients
+ * which are below rounding error are removed and isConverged() returns true) or until the degree reaches maximum_degree.
+ *
+ * If [a,b] is not a finite interval with a < b, an error message is printed to the command line terminal and the expansion is
+ * the zero function. If maximum_degree is not a power of two in [MINIMUM_CHEBYSHEV_DEGREE, MAXIMUM_CHEBYSHEV_DEGREE], it is reset to MAXIMUM_CHEBYSHEV_DEGREE.
+ */
+ChebyshevExpansion::ChebyshevExpansion(const Function & func, double a, double b, int maximum_degree) : a(a), b(b), coefficients(1, 0.0)
+{
+    // Print an error message to the command line terminal and keep the zero function if [a,b] is out of range.
+    if (!std::isfinite(a) || !std::isfinite(b) || (b <= a))
+    {
+        std::cout << "\n\nInvalid interval. a and b are required to be finite numbers which satisfy a < b.";
+        return;
+    }
+
+    // Set maximum_degree to the default value if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((maximum_degree < MINIMUM_CHEBYSHEV_DEGREE) || (maximum_degree > MAXIMUM_CHEBYSHEV_DEGREE) || ((maximum_degree & (maximum_degree - 1)) != 0))
+    {
+        std::cout << "\n\nThe maximum Chebyshev degree was out of range. Hence, the maximum degree has been reset to " << MAXIMUM_CHEBYSHEV_DEGREE << ".";
+        maximum_degree = MAXIMUM_CHEBYSHEV_DEGREE;
+    }
+
+    const double pi = 3.14159265358979323846;
+    const double center = (a + b) / 2, half_width = (b - a) / 2;
+    std::vector<double> samples;
+    double scale = 0.0;
+
+    for (int n = MINIMUM_CHEBYSHEV_DEGREE; n <= maximum_degree; n *= 2)
+    {
+        // Sample f at the Chebyshev points x_j = center + half_width * cos(Pi * j / n). The even points are the points of the previous fit.
+        std::vector<double> refined(n + 1);
+        for (int j = 0; j <= n; j += 1)
+        {
+            if (!samples.empty() && (j % 2 == 0))
+            {
+                refined[j] = samples[j / 2];
+                continue;
+            }
+            refined[j] = func(center + half_width * std::cos(pi * j / n));
+            evaluation_count += 1;
+            if (!std::isfinite(refined[j])) return; // f is not finite somewhere in [a,b] (so the expansion cannot converge)
+            if (std::fabs(refined[j]) > scale) scale = std::fabs(refined[j]);
+        }
+        samples = std::move(refined);
+
+        coefficients = cosineTransformOfSamples(samples);
+        if (scale == 0.0)
+        {
+            coefficients.assign(1, 0.0);
+            converged = true;
+            return;
+        }
+
+        // Check whether the last eighth of the coefficients are negligible.
+        const double negligible = CHEBYSHEV_TOLERANCE * scale;
+        bool tail_is_negligible = true;
+        for (int k = n - n / 8; k <= n; k += 1) tail_is_negligible = tail_is_negligible && (std::fabs(coefficients[k]) <= negligible);
+        if (tail_is_negligible)
+        {
+            // Remove only the trailing coefficients which are below the rounding error of the largest sample (so that chopping costs no accuracy).
+            const double rounding_error = std::numeric_limits<double>::epsilon() * scale;
+            int last = n;
+            while ((last > 0) && (std::fabs(coefficients[last]) <= rounding_error)) last -= 1;
+            coefficients.resize(last + 1);
+            converged = true;
+            return;
+        }
+    }
+}
+
+/**
+ * Construct the expansion c_0 * T_0(t) + ... + c_n * T_n(t) on [a,b] from its coefficients.
+ */
+ChebyshevExpansion::ChebyshevExpansion(double a, double b, std::vector<double> coefficients) : a(a), b(b), coefficients(std::move(coefficients)), converged(true) {}
+
+/**
+ * Return the value of the expansion at x using the Clenshaw recurrence
+ *
+ * b_k = c_k + 2 * t * b_(k + 1) - b_(k + 2) and value = c_0 + t * b_1 - b_2.
+ */
+double ChebyshevExpansion::operator()(double x) const
+{
+    const double t = (2 * x - a - b) / (b - a);
+    double b_1 = 0.0, b_2 = 0.0;
+    for (int k = degree(); k >= 1; k -= 1)
+    {
+        double b_0 = coefficients[k] + 2 * t * b_1 - b_2;
+        b_2 = b_1;
+        b_1 = b_0;
+    }
+    return coefficients[0] + t * b_1 - b_2;
+}
+
+/**
+ * Return the expansion of the derivative, f'(x), on [a,b] (whose degree is one less).
+ *
+ * The coefficients d_k of the derivative satisfy d_(k - 1) = d_(k + 1) + 2 * k * c_k (where d_0 is then halved), times the
+ * factor 2 / (b - a) by which t changes per unit of x.
+ */
+ChebyshevExpansion ChebyshevExpansion::derivative() const
+{
+    const int n = degree();
+    if (n == 0) return ChebyshevExpansion(a, b, std::vector<double>(1, 0.0));
+    std::vector<double> derivative_coefficients(n + 2, 0.0);
+    for (int k = n; k >= 1; k -= 1) derivative_coefficients[k - 1] = derivative_coefficients[k + 1] + 2 * k * coefficients[k];
+    derivative_coefficients[0] /= 2;
+    derivative_coefficients.resize(n);
+    for (double & coefficient : derivative_coefficients) coefficient *= 2 / (b - a);
+    return ChebyshevExpansion(a, b, std::move(derivative_coefficients));
+}
+
+/**
+ * Return the expansion of the integral of f on [a,x] (whose degree is one more and whose value at x = a is zero).
+ *
+ * The integral of T_k is T_(k + 1) / (2 * (k + 1)) - T_(k - 1) / (2 * (k - 1)), so the coefficients C_k of the integral are
+ * C_1 = c_0 - c_2 / 2 and C_k = (c_(k - 1) - c_(k + 1)) / (2 * k), times the factor (b - a) / 2 by which x changes per unit of t.
+ * C_0 is chosen so that the integral is zero at t = -1.
+ */
+ChebyshevExpansion ChebyshevExpansion::integral() const
+{
+    const int n = degree();
+    std::vector<double> c(coefficients);
+    c.resize(n + 3, 0.0);
+    std::vector<double> integral_coefficients(n + 2, 0.0);
+    integral_coefficients[1] = c[0] - c[2] / 2;
+    for (int k = 2; k <= n + 1; k += 1) integral_coefficients[k] = (c[k - 1] - c[k + 1]) / (2 * k);
+    double value_at_a = 0.0;
+    for (int k = 1; k <= n + 1; k += 1)
+    {
+        integral_coefficients[k] *= (b - a) / 2;
+        value_at_a += (k % 2 == 0) ? integral_coefficients[k] : -integral_coefficients[k];
+    }
+    integral_coefficients[0] = -value_at_a;
+    return ChebyshevExpansion(a, b, std::move(integral_coefficients));
+}
+
+/**
+ * Return the integral of the expansion on [a,b] (i.e. the Clenshaw-Curtis quadrature of f), which is
+ *
+ * (b - a) / 2 * (sum over even k of c_k * 2 / (1 - k ^ 2)).
+ */
+double ChebyshevExpansion::definiteIntegral() const
+{
+    double sum = 0.0;
+    for (int k = 0; k <= degree(); k += 2) sum += coefficients[k] * 2.0 / (1.0 - static_cast<double>(k) * k);
+    return sum * (b - a) / 2;
+}
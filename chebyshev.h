@@ -0,0 +1,62 @@
+/**
+ * file: chebyshev.h
+ * type: C++ (header file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+#ifndef CHEBYSHEV_H
+#define CHEBYSHEV_H
+
+/** preprocessing directives */
+#include <vector> // std::vector
+#include "reimann_sum.h" // Function
+#define MINIMUM_CHEBYSHEV_DEGREE 16 // constant which represents the degree of the first (coarsest) Chebyshev fit of a function
+#define MAXIMUM_CHEBYSHEV_DEGREE 65536 // constant which represents the largest degree of a Chebyshev fit (which must be a power of two)
+#define CHEBYSHEV_TOLERANCE 1e-14 // constant which represents the size (relative to the largest sample of f) below which a Chebyshev coefficient is negligible
+
+/**
+ * A ChebyshevExpansion approximates a single variable function, y = f(x), on the x-axis interval [a,b] by the sum
+ *
+ * c_0 * T_0(t) + c_1 * T_1(t) + ... + c_degree * T_degree(t) where t = (2 * x - a - b) / (b - a)
+ *
+ * and where T_k(t) = cos(k * arccos(t)) is the kth Chebyshev polynomial.
+ *
+ * The constructor samples f at 17, 33, 65, ... Chebyshev points (every point of one fit is reused by the next fit) and
+ * computes the coefficients of each fit with a fast cosine transform, until the trailing coefficients are negligible.
+ * Smooth functions such as sin(x), cos(x), and polynomials converge at a small degree (e.g. sin(x) on [0,10] at degree 25, using 33 evaluations of f);
+ * a function whose derivative is unbounded in [a,b] (e.g. sqrt(x) on [0,1]) does not converge before MAXIMUM_CHEBYSHEV_DEGREE
+ * (see isConverged()).
+ *
+ * After the fit, f(x), the derivative f'(x), and the integral of f on [a,x] are each evaluated with O(degree) operations
+ * (by the Clenshaw recurrence) without calling f again. Values of x outside of [a,b] are extrapolated (and are not accurate).
+ */
+class ChebyshevExpansion
+{
+public:
+    ChebyshevExpansion(const Function & func, double a, double b, int maximum_degree = MAXIMUM_CHEBYSHEV_DEGREE);
+
+    double operator()(double x) const;
+    ChebyshevExpansion derivative() const;
+    ChebyshevExpansion integral() const;
+    double definiteIntegral() const;
+
+    int degree() const { return static_cast<int>(coefficients.size()) - 1; }
+    double lowerBound() const { return a; }
+    double upperBound() const { return b; }
+    bool isConverged() const { return converged; }
+    long long evaluations() const { return evaluation_count; }
+    const std::vector<double> & chebyshevCoefficients() const { return coefficients; }
+
+private:
+    ChebyshevExpansion(double a, double b, std::vector<double> coefficients);
+
+    double a = 0.0;
+    double b = 1.0;
+    std::vector<double> coefficients;
+    bool converged = false;
+    long long evaluation_count = 0;
+};
+
+#endif // CHEBYSHEV_H
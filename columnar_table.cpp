@@ -0,0 +1,315 @@
+/**
+ * file: columnar_table.cpp
+ * type: C++ (source file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+/** preprocessing directives */
+#include <iostream> // standard output (std::cout)
+#include <cstdint> // std::uint32_t, std::uint64_t
+#include <cstdio> // std::fopen, std::fread, std::fwrite, std::fclose
+#include <cstdlib> // std::aligned_alloc, std::free
+#include <cstring> // std::memchr, std::memcmp, std::memcpy, std::memset, std::strncpy
+#include <utility> // std::move, std::swap
+#include "columnar_table.h" // ColumnarTable
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h> // open
+#include <sys/mman.h> // mmap, munmap
+#include <sys/stat.h> // fstat
+#include <unistd.h> // close, ftruncate
+#define COLUMNAR_TABLE_HAS_MMAP 1
+#endif
+#define COLUMNAR_TABLE_FILE_VERSION 1 // constant which represents the version of the columnar table file layout
+
+/**
+ * Define a struct-type variable named ColumnarTableHeader which occupies the first 64 bytes of a columnar table file.
+ */
+struct ColumnarTableHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t column_count;
+    std::uint64_t row_count;
+    std::uint64_t column_stride;
+    std::uint64_t data_offset;
+    char padding[24];
+};
+
+static_assert(sizeof(ColumnarTableHeader) == 64, "ColumnarTableHeader is required to occupy exactly 64 bytes.");
+
+static const char COLUMNAR_TABLE_MAGIC[8] = { 'K', 'A', 'R', 'B', 'C', 'O', 'L', 'S' };
+
+/**
+ * Return value rounded up to the nearest multiple of COLUMNAR_TABLE_ALIGNMENT.
+ */
+static std::size_t roundUpToAlignment(std::size_t value)
+{
+    return ((value + COLUMNAR_TABLE_ALIGNMENT - 1) / COLUMNAR_TABLE_ALIGNMENT) * COLUMNAR_TABLE_ALIGNMENT;
+}
+
+ColumnarTable::~ColumnarTable()
+{
+    close();
+}
+
+ColumnarTable::ColumnarTable(ColumnarTable && other) noexcept
+{
+    *this = std::move(other);
+}
+
+ColumnarTable & ColumnarTable::operator=(ColumnarTable && other) noexcept
+{
+    if (this != &other)
+    {
+        close();
+        column_names = std::move(other.column_names);
+        file_name = std::move(other.file_name);
+        std::swap(row_count, other.row_count);
+        std::swap(column_stride, other.column_stride);
+        std::swap(data_offset, other.data_offset);
+        std::swap(file_length, other.file_length);
+        std::swap(writable, other.writable);
+        std::swap(base, other.base);
+        std::swap(mapped, other.mapped);
+    }
+    return *this;
+}
+
+/**
+ * Compute the column stride, the data offset, and the file length of a table which has row_count rows and column_count columns.
+ */
+void ColumnarTable::setLayout(long long row_count, std::size_t column_count)
+{
+    this->row_count = row_count;
+    column_stride = roundUpToAlignment(static_cast<std::size_t>(row_count) * sizeof(double)) / sizeof(double);
+    data_offset = roundUpToAlignment(sizeof(ColumnarTableHeader) + COLUMNAR_TABLE_NAME_LENGTH * column_count);
+    file_length = data_offset + column_count * column_stride * sizeof(double);
+}
+
+/**
+ * Create (or overwrite) the file named file_name as a table of row_count rows and one column per entry of column_names.
+ *
+ * Every value of the new table is zero until it is set. The values are stored in the file when the table is closed
+ * (or destroyed).
+ *
+ * If the input values are out of range or if the file cannot be created, a message is printed to the command line
+ * terminal and a table which is not open is returned.
+ */
+ColumnarTable ColumnarTable::create(const std::string & file_name, const std::vector<std::string> & column_names, long long row_count)
+{
+    ColumnarTable table;
+
+    if (column_names.empty() || (column_names.size() > MAXIMUM_COLUMNAR_TABLE_COLUMNS) || (row_count < 0) || (row_count > MAXIMUM_COLUMNAR_TABLE_ROWS))
+    {
+        std::cout << "\n\nThe ColumnarTable " << file_name << " requires between 1 and " << MAXIMUM_COLUMNAR_TABLE_COLUMNS << " columns and between 0 and " << MAXIMUM_COLUMNAR_TABLE_ROWS << " rows. Hence, that table has not been created.";
+        return table;
+    }
+
+    table.column_names = column_names;
+    table.setLayout(row_count, column_names.size());
+    table.writable = true;
+
+#if defined(COLUMNAR_TABLE_HAS_MMAP)
+    int descriptor = ::open(file_name.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (descriptor >= 0)
+    {
+        void * address = MAP_FAILED;
+        if (ftruncate(descriptor, static_cast<off_t>(table.file_length)) == 0)
+        {
+            address = mmap(nullptr, table.file_length, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+        }
+        ::close(descriptor);
+        if (address != MAP_FAILED)
+        {
+            table.base = static_cast<char *>(address);
+            table.mapped = true;
+        }
+    }
+#endif
+
+    // Without a memory mapping, the table is collected in a private (zeroed) buffer which close() writes to the file.
+    if (table.base == nullptr)
+    {
+        table.base = static_cast<char *>(std::aligned_alloc(COLUMNAR_TABLE_ALIGNMENT, table.file_length));
+        if (table.base == nullptr)
+        {
+            std::cout << "\n\nThe ColumnarTable " << file_name << " could not be created.";
+            return ColumnarTable();
+        }
+        std::memset(table.base, 0, table.file_length);
+        table.file_name = file_name;
+    }
+
+    // Write the header and the column names (a new mapping of a truncated file is already filled with zeros).
+    ColumnarTableHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, COLUMNAR_TABLE_MAGIC, sizeof(header.magic));
+    header.version = COLUMNAR_TABLE_FILE_VERSION;
+    header.column_count = static_cast<std::uint32_t>(column_names.size());
+    header.row_count = static_cast<std::uint64_t>(row_count);
+    header.column_stride = table.column_stride;
+    header.data_offset = table.data_offset;
+    std::memcpy(table.base, &header, sizeof(header));
+    for (std::size_t c = 0; c < column_names.size(); c += 1)
+    {
+        char * name = table.base + sizeof(ColumnarTableHeader) + c * COLUMNAR_TABLE_NAME_LENGTH;
+        std::strncpy(name, column_names[c].c_str(), COLUMNAR_TABLE_NAME_LENGTH - 1);
+        table.column_names[c] = name;
+    }
+
+    return table;
+}
+
+/**
+ * Open the existing table file named file_name for reading (without copying its values if the file can be memory-mapped).
+ *
+ * If the file cannot be opened or is not a valid table file, a message is printed to the command line terminal and a
+ * table which is not open is returned.
+ */
+ColumnarTable ColumnarTable::open(const std::string & file_name)
+{
+    ColumnarTable table;
+    std::size_t length = 0;
+
+#if defined(COLUMNAR_TABLE_HAS_MMAP)
+    int descriptor = ::open(file_name.c_str(), O_RDONLY);
+    if (descriptor >= 0)
+    {
+        struct stat status;
+        void * address = MAP_FAILED;
+        if ((fstat(descriptor, &status) == 0) && (static_cast<std::size_t>(status.st_size) >= sizeof(ColumnarTableHeader)))
+        {
+            length = static_cast<std::size_t>(status.st_size);
+            address = mmap(nullptr, length, PROT_READ, MAP_SHARED, descriptor, 0);
+        }
+        ::close(descriptor);
+        if (address != MAP_FAILED)
+        {
+            table.base = static_cast<char *>(address);
+            table.mapped = true;
+            table.file_length = length;
+        }
+    }
+#endif
+
+    // Without a memory mapping, the whole file is read into a private buffer.
+    if (table.base == nullptr)
+    {
+        std::FILE * file = std::fopen(file_name.c_str(), "rb");
+        if (file != nullptr)
+        {
+            std::fseek(file, 0, SEEK_END);
+            long end = std::ftell(file);
+            std::fseek(file, 0, SEEK_SET);
+            if (end >= static_cast<long>(sizeof(ColumnarTableHeader)))
+            {
+                length = static_cast<std::size_t>(end);
+                table.base = static_cast<char *>(std::aligned_alloc(COLUMNAR_TABLE_ALIGNMENT, roundUpToAlignment(length)));
+                if ((table.base != nullptr) && (std::fread(table.base, 1, length, file) != length))
+                {
+                    std::free(table.base);
+                    table.base = nullptr;
+                }
+                table.file_length = length;
+            }
+            std::fclose(file);
+        }
+    }
+
+    if (table.base == nullptr)
+    {
+        std::cout << "\n\nThe ColumnarTable file " << file_name << " could not be opened.";
+        return table;
+    }
+
+    // Check that the header describes a table which fits inside of the file.
+    ColumnarTableHeader header;
+    std::memcpy(&header, table.base, sizeof(header));
+    bool valid = (std::memcmp(header.magic, COLUMNAR_TABLE_MAGIC, sizeof(header.magic)) == 0) && (header.version == COLUMNAR_TABLE_FILE_VERSION);
+    valid = valid && (header.column_count >= 1) && (header.column_count <= MAXIMUM_COLUMNAR_TABLE_COLUMNS) && (header.row_count <= MAXIMUM_COLUMNAR_TABLE_ROWS);
+    if (valid)
+    {
+        table.setLayout(static_cast<long long>(header.row_count), header.column_count);
+        valid = (table.column_stride == header.column_stride) && (table.data_offset == header.data_offset) && (table.file_length <= length);
+    }
+    if (!valid)
+    {
+        std::cout << "\n\nThe file " << file_name << " is not a valid ColumnarTable file.";
+        table.file_length = length;
+        table.release();
+        return ColumnarTable();
+    }
+    table.file_length = length;
+
+    for (std::uint32_t c = 0; c < header.column_count; c += 1)
+    {
+        const char * name = table.base + sizeof(ColumnarTableHeader) + c * COLUMNAR_TABLE_NAME_LENGTH;
+        const char * end = static_cast<const char *>(std::memchr(name, '\0', COLUMNAR_TABLE_NAME_LENGTH));
+        table.column_names.push_back(std::string(name, (end != nullptr) ? (end - name) : COLUMNAR_TABLE_NAME_LENGTH));
+    }
+
+    return table;
+}
+
+/**
+ * Return the index of the column named name (or -1 if the table has no column with that name).
+ */
+int ColumnarTable::columnIndex(const std::string & name) const
+{
+    for (std::size_t c = 0; c < column_names.size(); c += 1) if (column_names[c] == name) return static_cast<int>(c);
+    return -1;
+}
+
+/**
+ * Return the address of the first value of column c (or nullptr if the table is not open or if c is out of range).
+ */
+const double * ColumnarTable::column(int c) const
+{
+    if ((base == nullptr) || (c < 0) || (c >= columnCount())) return nullptr;
+    return reinterpret_cast<const double *>(base + data_offset + static_cast<std::size_t>(c) * column_stride * sizeof(double));
+}
+
+/**
+ * Return the writable address of the first value of column c (or nullptr if the table was opened read-only).
+ */
+double * ColumnarTable::writableColumn(int c)
+{
+    if (!writable) return nullptr;
+    return const_cast<double *>(column(c));
+}
+
+/**
+ * Store every value of a created table in its file and close the table.
+ *
+ * Return true if the table was closed without an error.
+ */
+bool ColumnarTable::close()
+{
+    bool success = true;
+    if ((base != nullptr) && writable && !mapped)
+    {
+        std::FILE * file = std::fopen(file_name.c_str(), "wb");
+        success = (file != nullptr) && (std::fwrite(base, 1, file_length, file) == file_length);
+        if (file != nullptr) success = (std::fclose(file) == 0) && success;
+        if (!success) std::cout << "\n\nThe ColumnarTable file " << file_name << " could not be written.";
+    }
+    release();
+    return success;
+}
+
+void ColumnarTable::release()
+{
+#if defined(COLUMNAR_TABLE_HAS_MMAP)
+    if (mapped && (base != nullptr)) munmap(base, file_length);
+#endif
+    if (!mapped) std::free(base);
+    base = nullptr;
+    mapped = false;
+    writable = false;
+    column_names.clear();
+    row_count = 0;
+    column_stride = 0;
+    data_offset = 0;
+    file_length = 0;
+}
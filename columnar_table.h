@@ -0,0 +1,79 @@
+/**
+ * file: columnar_table.h
+ * type: C++ (header file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+#ifndef COLUMNAR_TABLE_H
+#define COLUMNAR_TABLE_H
+
+/** preprocessing directives */
+#include <cstddef> // std::size_t
+#include <string> // std::string
+#include <vector> // std::vector
+#define COLUMNAR_TABLE_ALIGNMENT 4096 // constant which represents the byte alignment of the first value of every column (one memory page)
+#define COLUMNAR_TABLE_NAME_LENGTH 32 // constant which represents the number of bytes reserved for each column name (including the terminating null character)
+#define MAXIMUM_COLUMNAR_TABLE_COLUMNS 64 // constant which represents the maximum number of columns in one table file
+#define MAXIMUM_COLUMNAR_TABLE_ROWS 1000000000 // constant which represents the maximum number of rows in one table file
+
+/**
+ * A ColumnarTable is a compact binary file of raw doubles (an alternative to the plain-text *_output.txt files for
+ * long traces and for batch function results).
+ *
+ * File layout (all integers are little-endian on the machines which this program is built for):
+ *
+ * bytes [0, 64): header { char magic[8] = "KARBCOLS"; uint32 version; uint32 column_count; uint64 row_count;
+ *                         uint64 column_stride; uint64 data_offset; (padding) }
+ * bytes [64, 64 + 32 * column_count): column names (null-terminated and null-padded to 32 bytes each)
+ * bytes [data_offset + c * column_stride * 8, ... + row_count * 8): the row_count doubles of column c
+ *
+ * data_offset and column_stride * 8 are multiples of COLUMNAR_TABLE_ALIGNMENT, so every column starts on its own page
+ * (which lets a reader memory-map the file and use each column as a plain double array without copying it, and which
+ * lets a reader which opens the file with O_DIRECT read whole columns into page-aligned buffers).
+ *
+ * A table which is created is memory-mapped for writing, so values are stored directly into the page cache (instead of
+ * being formatted as text and copied through a stream buffer). A table which is opened is memory-mapped read-only.
+ */
+class ColumnarTable
+{
+public:
+    ColumnarTable() {}
+    ~ColumnarTable();
+    ColumnarTable(ColumnarTable && other) noexcept;
+    ColumnarTable & operator=(ColumnarTable && other) noexcept;
+    ColumnarTable(const ColumnarTable &) = delete;
+    ColumnarTable & operator=(const ColumnarTable &) = delete;
+
+    static ColumnarTable create(const std::string & file_name, const std::vector<std::string> & column_names, long long row_count);
+    static ColumnarTable open(const std::string & file_name);
+
+    bool isOpen() const { return base != nullptr; }
+    bool isWritable() const { return writable; }
+    long long rowCount() const { return row_count; }
+    int columnCount() const { return static_cast<int>(column_names.size()); }
+    const std::string & columnName(int c) const { return column_names[c]; }
+    int columnIndex(const std::string & name) const;
+
+    const double * column(int c) const;
+    double * writableColumn(int c);
+    void set(long long row, int c, double value) { writableColumn(c)[row] = value; }
+    bool close();
+
+private:
+    void release();
+    void setLayout(long long row_count, std::size_t column_count);
+
+    std::vector<std::string> column_names;
+    long long row_count = 0;
+    std::size_t column_stride = 0; // number of doubles from the start of one column to the start of the next column
+    std::size_t data_offset = 0; // number of bytes from the start of the file to the first value of column 0
+    std::size_t file_length = 0;
+    bool writable = false;
+    char * base = nullptr; // start of the file contents (either a memory mapping or a private buffer)
+    bool mapped = false; // true if base is a memory mapping (false if base is a private buffer)
+    std::string file_name; // name of the file which a private (unmapped) writable buffer is written to by close()
+};
+
+#endif // COLUMNAR_TABLE_H
@@ -0,0 +1,320 @@
+/**
+ * file: double_double.cpp
+ * type: C++ (source file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+/** preprocessing directives */
+#include <iostream> // standard output (std::cout)
+#include <array> // std::array
+#include <cmath> // std::sqrt, std::exp, std::log, std::atan, std::ldexp, std::floor, std::fabs, NAN, INFINITY
+#include "double_double.h" // DoubleDouble, function prototypes
+#include "trigonometric_functions.h" // MAXIMUM_x
+#include "big_float.h" // BigFloat, computePiToDigits
+#define DOUBLE_DOUBLE_PI_OVER_TWO_1 1.5707963267948966 // constant which represents the double nearest to pi / 2
+#define DOUBLE_DOUBLE_PI_OVER_TWO_2 6.123233995736766e-17 // constant which represents the double nearest to pi / 2 - DOUBLE_DOUBLE_PI_OVER_TWO_1
+#define DOUBLE_DOUBLE_PI_OVER_TWO_3 -1.4973849048591698e-33 // constant which represents the double nearest to pi / 2 - DOUBLE_DOUBLE_PI_OVER_TWO_1 - DOUBLE_DOUBLE_PI_OVER_TWO_2
+#define DOUBLE_DOUBLE_LN_2_1 0.6931471805599453 // constant which represents the double nearest to ln(2)
+#define DOUBLE_DOUBLE_LN_2_2 2.3190468138462996e-17 // constant which represents the double nearest to ln(2) - DOUBLE_DOUBLE_LN_2_1
+#define DOUBLE_DOUBLE_LN_2_3 5.7077084384162121e-34 // constant which represents the double nearest to ln(2) - DOUBLE_DOUBLE_LN_2_1 - DOUBLE_DOUBLE_LN_2_2
+#define DOUBLE_DOUBLE_EXP_HALVINGS 9 // constant which represents the number of times which power_of_e_to_x halves its reduced argument
+#define DOUBLE_DOUBLE_FACTORIALS 21 // constant which represents the number of reciprocal factorials, 1 / n! (for n = 0, 1, ..., 20), used by the Taylor series
+
+/**
+ * Return the DoubleDouble nearest to the BigFloat value (the high part is rounded first and the remainder is rounded into the low part).
+ */
+static DoubleDouble toDoubleDouble(const BigFloat & value)
+{
+    double high = value.toDouble();
+    double low = (value - BigFloat(high)).toDouble();
+    double error = 0.0;
+    high = quickTwoSum(high, low, error);
+    return { high, error };
+}
+
+/**
+ * Return the table of 1 / n! for n = 0, 1, ..., DOUBLE_DOUBLE_FACTORIALS - 1 (n! is exact in double arithmetic for these n).
+ */
+static const std::array<DoubleDouble, DOUBLE_DOUBLE_FACTORIALS> & reciprocalFactorials()
+{
+    static const std::array<DoubleDouble, DOUBLE_DOUBLE_FACTORIALS> table = []()
+    {
+        std::array<DoubleDouble, DOUBLE_DOUBLE_FACTORIALS> values;
+        double factorial = 1.0;
+        for (int n = 0; n < DOUBLE_DOUBLE_FACTORIALS; n += 1)
+        {
+            if (n > 0) factorial *= n;
+            values[n] = DoubleDouble(1.0) / DoubleDouble(factorial);
+        }
+        return values;
+    }();
+    return table;
+}
+
+/**
+ * Define a struct-type variable named SineCosineTable16 which stores sin(j * pi / 16) and cos(j * pi / 16) for j = 0, 1, 2, 3, 4
+ * (computed once, to more than 32 digits, with BigFloat arithmetic).
+ */
+struct SineCosineTable16 {
+    std::array<DoubleDouble, 5> sine;
+    std::array<DoubleDouble, 5> cosine;
+};
+
+static const SineCosineTable16 & sixteenthsOfPi()
+{
+    static const SineCosineTable16 table = []()
+    {
+        SineCosineTable16 values;
+        const BigFloat pi_over_16 = computePiToDigits(50).dividedBySmall(16);
+        for (int j = 0; j < 5; j += 1)
+        {
+            BigFloat angle = pi_over_16.multipliedBySmall(static_cast<std::uint32_t>(j));
+            values.sine[j] = toDoubleDouble(sine(angle));
+            values.cosine[j] = toDoubleDouble(cosine(angle));
+        }
+        return values;
+    }();
+    return table;
+}
+
+/**
+ * Return this DoubleDouble as a decimal number of digits significant digits (the exact value hi + lo is converted by BigFloat).
+ */
+std::string DoubleDouble::toString(int digits) const
+{
+    if (!std::isfinite(hi)) return std::to_string(hi);
+    return (BigFloat(hi, 40) + BigFloat(lo, 40)).toString(digits);
+}
+
+/**
+ * Return the square root of x: with y = sqrt(hi) in double arithmetic, sqrt(x) = y + (x - y ^ 2) / (2 * y) to about 106 bits
+ * (one Newton step from 53 correct bits). If x is negative, NaN is returned.
+ */
+DoubleDouble sqrt(const DoubleDouble & x)
+{
+    if (x.hi <= 0) return (x.hi == 0) ? DoubleDouble(0.0) : DoubleDouble(NAN);
+    double y = std::sqrt(x.hi);
+    double error = 0.0;
+    double square = twoProduct(y, y, error);
+    DoubleDouble residual = (x - DoubleDouble(square, error));
+    return DoubleDouble(y) + residual.hi / (2 * y);
+}
+
+/**
+ * Store sin(t) and cos(t) for |t| <= pi / 32 in sine_of_t and cosine_of_t, using the Taylor polynomials up to t ^ 19 and t ^ 20
+ * (whose first omitted terms are below 10 ^ -35) in Horner form in u = t ^ 2:
+ *
+ * sin(t) = t * (1 - u / 3! + u ^ 2 / 5! - ... - u ^ 9 / 19!)
+ * cos(t) = 1 - u / 2! + u ^ 2 / 4! - ... + u ^ 10 / 20!
+ *
+ * Since u <= 0.0097, the terms from u ^ 5 / 11! (and from u ^ 6 / 12!) on are below 10 ^ -17 and are summed in double arithmetic,
+ * so only the leading terms need DoubleDouble operations.
+ */
+static void sineAndCosineTaylor(const DoubleDouble & t, DoubleDouble & sine_of_t, DoubleDouble & cosine_of_t)
+{
+    const std::array<DoubleDouble, DOUBLE_DOUBLE_FACTORIALS> & c = reciprocalFactorials();
+    const DoubleDouble u = t * t;
+    double tail = -c[19].hi;
+    for (int m = 8; m >= 5; m -= 1) tail = tail * u.hi + ((m % 2 == 0) ? c[2 * m + 1].hi : -c[2 * m + 1].hi);
+    DoubleDouble s = tail;
+    for (int m = 4; m >= 0; m -= 1) s = s * u + ((m % 2 == 0) ? c[2 * m + 1] : -c[2 * m + 1]);
+    tail = c[20].hi;
+    for (int m = 9; m >= 6; m -= 1) tail = tail * u.hi + ((m % 2 == 0) ? c[2 * m].hi : -c[2 * m].hi);
+    DoubleDouble k = tail;
+    for (int m = 5; m >= 0; m -= 1) k = k * u + ((m % 2 == 0) ? c[2 * m] : -c[2 * m]);
+    sine_of_t = s * t;
+    cosine_of_t = k;
+}
+
+/**
+ * Return x - k * pi / 2 where k * 8 is an integer (so that k * DOUBLE_DOUBLE_PI_OVER_TWO_1 and k * DOUBLE_DOUBLE_PI_OVER_TWO_2
+ * are computed exactly with twoProduct and pi / 2 takes part with about 160 bits).
+ */
+static DoubleDouble minusMultipleOfPiOverTwo(const DoubleDouble & x, double k)
+{
+    double error = 0.0;
+    double product = twoProduct(k, DOUBLE_DOUBLE_PI_OVER_TWO_1, error);
+    DoubleDouble r = x - DoubleDouble(product, error);
+    product = twoProduct(k, DOUBLE_DOUBLE_PI_OVER_TWO_2, error);
+    r = r - DoubleDouble(product, error);
+    return r + (-k * DOUBLE_DOUBLE_PI_OVER_TWO_3);
+}
+
+/**
+ * Store sin(x) and cos(x) in sine_of_x and cosine_of_x (without a range check).
+ *
+ * x is reduced to r = x - n * pi / 2 (with |r| <= pi / 4) and then to t = r - j * pi / 16 (with |t| <= pi / 32 and |j| <= 4), so
+ * sin(r) = sin(j * pi / 16) * cos(t) + cos(j * pi / 16) * sin(t) and cos(r) = cos(j * pi / 16) * cos(t) - sin(j * pi / 16) * sin(t),
+ * where sin(j * pi / 16) and cos(j * pi / 16) come from a table. The quadrant n mod 4 then maps sin(r) and cos(r) to sin(x) and cos(x).
+ */
+static void sineAndCosineReduced(const DoubleDouble & x, DoubleDouble & sine_of_x, DoubleDouble & cosine_of_x)
+{
+    const double n = std::floor(x.hi / DOUBLE_DOUBLE_PI_OVER_TWO_1 + 0.5);
+    const DoubleDouble r = minusMultipleOfPiOverTwo(x, n);
+    const double j = std::floor(r.hi / (DOUBLE_DOUBLE_PI_OVER_TWO_1 / 8) + 0.5);
+    const DoubleDouble t = minusMultipleOfPiOverTwo(r, j / 8);
+    DoubleDouble sine_of_t, cosine_of_t;
+    sineAndCosineTaylor(t, sine_of_t, cosine_of_t);
+
+    const SineCosineTable16 & table = sixteenthsOfPi();
+    const int index = static_cast<int>(std::fabs(j));
+    const DoubleDouble sine_of_j = (j < 0) ? -table.sine[index] : table.sine[index];
+    const DoubleDouble cosine_of_j = table.cosine[index];
+    const DoubleDouble sine_of_r = sine_of_j * cosine_of_t + cosine_of_j * sine_of_t;
+    const DoubleDouble cosine_of_r = cosine_of_j * cosine_of_t - sine_of_j * sine_of_t;
+    switch (static_cast<long long>(n) & 3)
+    {
+        case 0: sine_of_x = sine_of_r; cosine_of_x = cosine_of_r; break;
+        case 1: sine_of_x = cosine_of_r; cosine_of_x = -sine_of_r; break;
+        case 2: sine_of_x = -sine_of_r; cosine_of_x = -cosine_of_r; break;
+        default: sine_of_x = -cosine_of_r; cosine_of_x = sine_of_r; break;
+    }
+}
+
+/**
+ * Store sin(x) and cos(x) in sine_of_x and cosine_of_x to about 32 significant digits.
+ *
+ * If x is out of range, x is reset to 1 (as in the double version of sineAndCosine).
+ */
+void sineAndCosine(const DoubleDouble & x, DoubleDouble & sine_of_x, DoubleDouble & cosine_of_x)
+{
+    // Set x to 1 if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((x.hi < (-1 * MAXIMUM_x)) || (x.hi > MAXIMUM_x) || std::isnan(x.hi))
+    {
+        std::cout << "\n\nThe number of radians, x, in sineAndCosine(x) was out of range. Hence, x has been reset to 1.";
+        sineAndCosineReduced(DoubleDouble(1.0), sine_of_x, cosine_of_x);
+        return;
+    }
+    sineAndCosineReduced(x, sine_of_x, cosine_of_x);
+}
+
+/**
+ * Return sin(x) to about 32 significant digits (see sineAndCosineReduced).
+ *
+ * If x is out of range, x is reset to 1 (as in the double version of sine).
+ */
+DoubleDouble sine(const DoubleDouble & x)
+{
+    DoubleDouble sine_of_x, cosine_of_x;
+    // Set x to 1 if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((x.hi < (-1 * MAXIMUM_x)) || (x.hi > MAXIMUM_x) || std::isnan(x.hi))
+    {
+        std::cout << "\n\nThe number of radians, x, in sine(x) was out of range. Hence, x has been reset to 1.";
+        sineAndCosineReduced(DoubleDouble(1.0), sine_of_x, cosine_of_x);
+        return sine_of_x;
+    }
+    sineAndCosineReduced(x, sine_of_x, cosine_of_x);
+    return sine_of_x;
+}
+
+/**
+ * Return cos(x) to about 32 significant digits (see sineAndCosineReduced).
+ *
+ * If x is out of range, x is reset to 1 (as in the double version of cosine).
+ */
+DoubleDouble cosine(const DoubleDouble & x)
+{
+    DoubleDouble sine_of_x, cosine_of_x;
+    // Set x to 1 if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((x.hi < (-1 * MAXIMUM_x)) || (x.hi > MAXIMUM_x) || std::isnan(x.hi))
+    {
+        std::cout << "\n\nThe number of radians, x, in cosine(x) was out of range. Hence, x has been reset to 1.";
+        sineAndCosineReduced(DoubleDouble(1.0), sine_of_x, cosine_of_x);
+        return cosine_of_x;
+    }
+    sineAndCosineReduced(x, sine_of_x, cosine_of_x);
+    return cosine_of_x;
+}
+
+/**
+ * Return arctan(x) to about 32 significant digits: starting from y = atan(hi) in double arithmetic, one Newton step on
+ * x * cos(y) - sin(y) = 0, y <-- y + (x * cos(y) - sin(y)) / (cos(y) + x * sin(y)), doubles the 53 correct bits.
+ *
+ * If x is out of range, x is reset to 1 (as in the double version of arctangent).
+ */
+DoubleDouble arctangent(const DoubleDouble & x)
+{
+    DoubleDouble argument = x;
+    // Set x to 1 if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((x.hi < (-1 * MAXIMUM_x)) || (x.hi > MAXIMUM_x) || std::isnan(x.hi))
+    {
+        std::cout << "\n\nThe number of radians, x, in arctangent(x) was out of range. Hence, x has been reset to 1.";
+        argument = DoubleDouble(1.0);
+    }
+    if (argument.hi == 0) return argument;
+    DoubleDouble y = std::atan(argument.hi), sine_of_y, cosine_of_y;
+    sineAndCosineReduced(y, sine_of_y, cosine_of_y);
+    return y + (argument * cosine_of_y - sine_of_y) / (cosine_of_y + argument * sine_of_y);
+}
+
+/**
+ * Return e ^ x to about 32 significant digits.
+ *
+ * x is reduced to r = x - k * ln(2) (so that e ^ x = 2 ^ k * e ^ r), r is divided by 2 ^ DOUBLE_DOUBLE_EXP_HALVINGS, the Taylor
+ * polynomial of e ^ r - 1 is evaluated up to r ^ 9, and the result is squared back with e ^ (2t) - 1 = (e ^ t - 1) * (e ^ t - 1 + 2).
+ * Results which overflow are infinity and results which underflow are zero (as for std::exp).
+ */
+DoubleDouble power_of_e_to_x(const DoubleDouble & x)
+{
+    if (std::isnan(x.hi)) return x;
+    if (x.hi > 709.79) return DoubleDouble(INFINITY);
+    if (x.hi < -745.2) return DoubleDouble(0.0);
+
+    // Subtract k * ln(2) with ln(2) to about 160 bits (the first two products are exact).
+    const double k = std::floor(x.hi / DOUBLE_DOUBLE_LN_2_1 + 0.5);
+    double error = 0.0;
+    double product = twoProduct(k, DOUBLE_DOUBLE_LN_2_1, error);
+    DoubleDouble r = x - DoubleDouble(product, error);
+    product = twoProduct(k, DOUBLE_DOUBLE_LN_2_2, error);
+    r = (r - DoubleDouble(product, error)) + (-k * DOUBLE_DOUBLE_LN_2_3);
+    r = { std::ldexp(r.hi, -DOUBLE_DOUBLE_EXP_HALVINGS), std::ldexp(r.lo, -DOUBLE_DOUBLE_EXP_HALVINGS) };
+
+    // Sum the terms from r ^ 5 / 5! on (which are below 10 ^ -17) in double arithmetic and the leading terms in DoubleDouble arithmetic.
+    const std::array<DoubleDouble, DOUBLE_DOUBLE_FACTORIALS> & c = reciprocalFactorials();
+    double tail = c[9].hi;
+    for (int n = 8; n >= 5; n -= 1) tail = tail * r.hi + c[n].hi;
+    DoubleDouble s = tail;
+    for (int n = 4; n >= 1; n -= 1) s = s * r + c[n];
+    s = s * r;
+    for (int i = 0; i < DOUBLE_DOUBLE_EXP_HALVINGS; i += 1) s = s * (s + 2.0);
+    s = s + 1.0;
+    return { std::ldexp(s.hi, static_cast<int>(k)), std::ldexp(s.lo, static_cast<int>(k)) };
+}
+
+/**
+ * Return the natural logarithm of x to about 32 significant digits: starting from y = log(hi) in double arithmetic, the correction
+ * ln(x) = y + ln(1 + t) with t = x * e ^ -y - 1 is added to second order, y <-- y + t - t ^ 2 / 2. (A plain Newton step, y + t, would leave an
+ * error of t ^ 2 / 2, i.e. about 10 ^ -27 for a result near 700.) For |x - 1| < 1/64, the series
+ * ln(x) = 2 * (z + z ^ 3 / 3 + z ^ 5 / 5 + ...) with z = (x - 1) / (x + 1) is used instead (so that a small result keeps its digits).
+ *
+ * ln(0) is -infinity and the logarithm of a negative number is NaN (as for std::log).
+ */
+DoubleDouble ln(const DoubleDouble & x)
+{
+    if (!(x.hi > 0)) return DoubleDouble((x.hi == 0) ? -INFINITY : NAN);
+    if ((x.hi == 1) && (x.lo == 0)) return DoubleDouble(0.0);
+    if (std::isinf(x.hi)) return x;
+    if (std::fabs(x.hi - 1) < 0.015625)
+    {
+        // |z| < 0.008, so nine terms reach z ^ 19 (below 10 ^ -40).
+        const DoubleDouble z = (x + (-1.0)) / (x + 1.0);
+        const DoubleDouble z2 = z * z;
+        DoubleDouble sum = DoubleDouble(1.0) / DoubleDouble(19.0);
+        for (int n = 17; n >= 1; n -= 2) sum = sum * z2 + DoubleDouble(1.0) / DoubleDouble(n);
+        return sum * z * 2.0;
+    }
+    // x = e ^ y * (1 + t), where |t| is about the rounding error of std::log (below 10 ^ -13 for every double), so ln(1 + t) = t - t ^ 2 / 2
+    // (the next term, t ^ 3 / 3, is below 10 ^ -39 and is dropped). If |y| > 600, e ^ -y is applied as two factors e ^ (-y / 2) (because the
+    // low part of e ^ -y would be a subnormal number, which has fewer than 53 bits, once e ^ -y is below about 10 ^ -292).
+    const DoubleDouble y = std::log(x.hi);
+    DoubleDouble t = 0.0;
+    if (std::fabs(y.hi) > 600)
+    {
+        const DoubleDouble half_power = power_of_e_to_x(y * -0.5);
+        t = (x * half_power) * half_power + (-1.0);
+    }
+    else t = x * power_of_e_to_x(-y) + (-1.0);
+    return y + (t - t * t * 0.5);
+}
@@ -0,0 +1,160 @@
+/**
+ * file: double_double.h
+ * type: C++ (header file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+#ifndef DOUBLE_DOUBLE_H
+#define DOUBLE_DOUBLE_H
+
+/** preprocessing directives */
+#include <cmath> // std::fma, std::fabs, std::sqrt, std::isfinite, FP_FAST_FMA
+#include <functional> // std::function
+#include <string> // std::string
+#define DOUBLE_DOUBLE_DIGITS 32 // constant which represents the number of significant decimal digits which a DoubleDouble stores (about 106 bits)
+#define DOUBLE_DOUBLE_SPLITTER 134217729.0 // constant which represents 2 ^ 27 + 1 (which splits a double into two halves of 26 bits when there is no fused multiply-add)
+
+/**
+ * A DoubleDouble stores a number as the unevaluated sum hi + lo of two doubles, where |lo| <= ulp(hi) / 2,
+ * which gives about 106 significant bits (32 decimal digits) while every operation stays in double arithmetic.
+ *
+ * The operations are built from error-free transformations: twoSum(a, b) returns s = fl(a + b) together with the exact
+ * rounding error a + b - s, and twoProduct(a, b) returns p = fl(a * b) together with the exact rounding error a * b - p
+ * (one fused multiply-add where the target has one, otherwise Dekker's splitting into 26-bit halves).
+ */
+struct DoubleDouble {
+    double hi;
+    double lo;
+
+    DoubleDouble(double value = 0.0) : hi(value), lo(0.0) {}
+    DoubleDouble(double high, double low) : hi(high), lo(low) {}
+
+    double toDouble() const { return hi + lo; }
+    std::string toString(int digits = DOUBLE_DOUBLE_DIGITS) const;
+};
+
+/**
+ * Return s = fl(a + b) and store the exact rounding error a + b - s in error.
+ */
+inline double twoSum(double a, double b, double & error)
+{
+    double s = a + b;
+    double v = s - a;
+    error = (a - (s - v)) + (b - v);
+    return s;
+}
+
+/**
+ * Return s = fl(a + b) and store the exact rounding error in error, where |a| >= |b| is required (three operations instead of six).
+ */
+inline double quickTwoSum(double a, double b, double & error)
+{
+    double s = a + b;
+    error = b - (s - a);
+    return s;
+}
+
+/**
+ * Return p = fl(a * b) and store the exact rounding error a * b - p in error.
+ */
+inline double twoProduct(double a, double b, double & error)
+{
+    double p = a * b;
+#ifdef FP_FAST_FMA
+    error = std::fma(a, b, -p);
+#else
+    double t = DOUBLE_DOUBLE_SPLITTER * a, a_high = t - (t - a), a_low = a - a_high;
+    t = DOUBLE_DOUBLE_SPLITTER * b;
+    double b_high = t - (t - b), b_low = b - b_high;
+    error = ((a_high * b_high - p) + a_high * b_low + a_low * b_high) + a_low * b_low;
+#endif
+    return p;
+}
+
+inline DoubleDouble operator - (const DoubleDouble & u) { return { -u.hi, -u.lo }; }
+
+inline DoubleDouble operator + (const DoubleDouble & u, const DoubleDouble & v)
+{
+    double e = 0.0, f = 0.0;
+    double s = twoSum(u.hi, v.hi, e);
+    double t = twoSum(u.lo, v.lo, f);
+    e += t;
+    s = quickTwoSum(s, e, e);
+    e += f;
+    s = quickTwoSum(s, e, e);
+    return { s, e };
+}
+
+inline DoubleDouble operator + (const DoubleDouble & u, double c)
+{
+    double e = 0.0;
+    double s = twoSum(u.hi, c, e);
+    e += u.lo;
+    s = quickTwoSum(s, e, e);
+    return { s, e };
+}
+
+inline DoubleDouble operator - (const DoubleDouble & u, const DoubleDouble & v) { return u + (-v); }
+
+inline DoubleDouble operator * (const DoubleDouble & u, const DoubleDouble & v)
+{
+    double e = 0.0;
+    double p = twoProduct(u.hi, v.hi, e);
+    e += u.hi * v.lo + u.lo * v.hi;
+    p = quickTwoSum(p, e, e);
+    return { p, e };
+}
+
+inline DoubleDouble operator * (const DoubleDouble & u, double c)
+{
+    double e = 0.0;
+    double p = twoProduct(u.hi, c, e);
+    e += u.lo * c;
+    p = quickTwoSum(p, e, e);
+    return { p, e };
+}
+
+/**
+ * Return u / v by long division: each of the three quotient digits q = r.hi / v.hi removes about 53 bits of the remainder r.
+ */
+inline DoubleDouble operator / (const DoubleDouble & u, const DoubleDouble & v)
+{
+    double q1 = u.hi / v.hi;
+    DoubleDouble r = u - v * q1;
+    double q2 = r.hi / v.hi;
+    r = r - v * q2;
+    double q3 = r.hi / v.hi;
+    double e = 0.0;
+    q1 = quickTwoSum(q1, q2, e);
+    return DoubleDouble(q1, e) + q3;
+}
+
+inline DoubleDouble & operator += (DoubleDouble & u, const DoubleDouble & v) { return u = u + v; }
+inline DoubleDouble & operator -= (DoubleDouble & u, const DoubleDouble & v) { return u = u - v; }
+inline DoubleDouble & operator *= (DoubleDouble & u, const DoubleDouble & v) { return u = u * v; }
+inline DoubleDouble & operator /= (DoubleDouble & u, const DoubleDouble & v) { return u = u / v; }
+
+inline bool operator < (const DoubleDouble & u, const DoubleDouble & v) { return (u.hi < v.hi) || ((u.hi == v.hi) && (u.lo < v.lo)); }
+inline bool operator > (const DoubleDouble & u, const DoubleDouble & v) { return v < u; }
+inline bool operator <= (const DoubleDouble & u, const DoubleDouble & v) { return !(v < u); }
+inline bool operator >= (const DoubleDouble & u, const DoubleDouble & v) { return !(u < v); }
+inline bool operator == (const DoubleDouble & u, const DoubleDouble & v) { return (u.hi == v.hi) && (u.lo == v.lo); }
+inline bool operator != (const DoubleDouble & u, const DoubleDouble & v) { return !(u == v); }
+
+inline DoubleDouble fabs(const DoubleDouble & u) { return (u.hi < 0) ? -u : u; }
+
+// Define the data type for a kernel which computes y[k] = f(x[k]) for k = 0, 1, ..., count - 1 in DoubleDouble arithmetic.
+using DoubleDoubleBatchKernel = std::function<void(const DoubleDouble * x, DoubleDouble * y, long long count)>;
+
+/** function prototypes */
+DoubleDouble sqrt(const DoubleDouble & x);
+DoubleDouble sine(const DoubleDouble & x);
+DoubleDouble cosine(const DoubleDouble & x);
+void sineAndCosine(const DoubleDouble & x, DoubleDouble & sine_of_x, DoubleDouble & cosine_of_x);
+DoubleDouble arctangent(const DoubleDouble & x);
+DoubleDouble power_of_e_to_x(const DoubleDouble & x);
+DoubleDouble ln(const DoubleDouble & x);
+
+#endif // DOUBLE_DOUBLE_H
@@ -0,0 +1,215 @@
+/**
+ * file: evaluation_cache.cpp
+ * type: C++ (source file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+/** preprocessing directives */
+#include <iostream> // standard output (std::cout)
+#include <cmath> // std::isnan
+#include <cstring> // std::memcpy
+#include "evaluation_cache.h" // EvaluationCache, function prototypes
+
+/**
+ * Return the bit pattern of x (so that x values are compared exactly, e.g. 0.1 + 0.2 and 0.3 are different keys).
+ */
+static std::uint64_t bitsOf(double x)
+{
+    std::uint64_t bits = 0;
+    std::memcpy(&bits, &x, sizeof(bits));
+    return bits;
+}
+
+/**
+ * Return a hash of key whose low bits depend on every bit of key (the finalizer of the SplitMix64 generator),
+ * so that nearby x values (which differ only in their low mantissa bits) spread over the whole table.
+ */
+static std::uint64_t hashOf(std::uint64_t key)
+{
+    key ^= key >> 30;
+    key *= 0xBF58476D1CE4E5B9ULL;
+    key ^= key >> 27;
+    key *= 0x94D049BB133111EBULL;
+    key ^= key >> 31;
+    return key;
+}
+
+/**
+ * Construct an empty EvaluationCache which keeps up to capacity pairs (x, f(x)).
+ *
+ * If capacity is out of range, capacity is reset to DEFAULT_EVALUATION_CACHE_CAPACITY.
+ */
+EvaluationCache::EvaluationCache(std::size_t capacity)
+{
+    // Set capacity to the default value if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((capacity < 1) || (capacity > MAXIMUM_EVALUATION_CACHE_CAPACITY))
+    {
+        std::cout << "\n\nThe evaluation cache capacity was out of range. Hence, the capacity has been reset to " << DEFAULT_EVALUATION_CACHE_CAPACITY << ".";
+        capacity = DEFAULT_EVALUATION_CACHE_CAPACITY;
+    }
+
+    // Allocate a hash table with at least twice as many slots as entries (so that probe sequences stay short).
+    std::size_t slot_count = 1;
+    while (slot_count < 2 * capacity) slot_count <<= 1;
+    entries.resize(capacity);
+    slots.assign(slot_count, -1);
+    mask = slot_count - 1;
+}
+
+/**
+ * Return the slot which holds key (or the empty slot at which the search for key stopped).
+ */
+std::size_t EvaluationCache::slotOf(std::uint64_t key) const
+{
+    std::size_t slot = hashOf(key) & mask;
+    while ((slots[slot] >= 0) && (entries[slots[slot]].key != key)) slot = (slot + 1) & mask;
+    return slot;
+}
+
+/**
+ * Remove entry from the list of entries which is ordered from the most recently used to the least recently used.
+ */
+void EvaluationCache::unlink(std::int32_t entry)
+{
+    if (entries[entry].newer >= 0) entries[entries[entry].newer].older = entries[entry].older;
+    else newest = entries[entry].older;
+    if (entries[entry].older >= 0) entries[entries[entry].older].newer = entries[entry].newer;
+    else oldest = entries[entry].newer;
+}
+
+/**
+ * Insert entry at the most recently used end of the list.
+ */
+void EvaluationCache::linkAsNewest(std::int32_t entry)
+{
+    entries[entry].newer = -1;
+    entries[entry].older = newest;
+    if (newest >= 0) entries[newest].newer = entry;
+    newest = entry;
+    if (oldest < 0) oldest = entry;
+}
+
+/**
+ * Empty slot and shift each later entry of the same probe sequence back into the gap (so that no tombstones are needed).
+ */
+void EvaluationCache::eraseSlot(std::size_t slot)
+{
+    std::size_t gap = slot;
+    for (std::size_t next = (gap + 1) & mask; slots[next] >= 0; next = (next + 1) & mask)
+    {
+        // An entry may move back into the gap only if its home slot is not between the gap and its current slot.
+        std::size_t home = hashOf(entries[slots[next]].key) & mask;
+        bool home_between = (gap <= next) ? ((gap < home) && (home <= next)) : ((gap < home) || (home <= next));
+        if (!home_between)
+        {
+            slots[gap] = slots[next];
+            gap = next;
+        }
+    }
+    slots[gap] = -1;
+}
+
+/**
+ * If a pair (x, f(x)) is stored, store f(x) in y, mark the pair as the most recently used, and return true.
+ * Otherwise return false.
+ */
+bool EvaluationCache::find(double x, double & y)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    std::size_t slot = slotOf(bitsOf(x));
+    if (slots[slot] < 0)
+    {
+        miss_count += 1;
+        return false;
+    }
+    std::int32_t entry = slots[slot];
+    if (entry != newest)
+    {
+        unlink(entry);
+        linkAsNewest(entry);
+    }
+    y = entries[entry].value;
+    hit_count += 1;
+    return true;
+}
+
+/**
+ * Store the pair (x, y) as the most recently used pair (evicting the least recently used pair if the cache is full).
+ */
+void EvaluationCache::insert(double x, double y)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    const std::uint64_t key = bitsOf(x);
+    std::size_t slot = slotOf(key);
+    std::int32_t entry = slots[slot];
+    if (entry >= 0)
+    {
+        // Update a pair which another thread inserted after this thread's call of find.
+        entries[entry].value = y;
+        unlink(entry);
+        linkAsNewest(entry);
+        return;
+    }
+
+    if (count == entries.size())
+    {
+        // Reuse the entry of the least recently used pair.
+        entry = oldest;
+        eraseSlot(slotOf(entries[entry].key));
+        unlink(entry);
+        slot = slotOf(key);
+    }
+    else
+    {
+        entry = static_cast<std::int32_t>(count);
+        count += 1;
+    }
+    entries[entry].key = key;
+    entries[entry].value = y;
+    slots[slot] = entry;
+    linkAsNewest(entry);
+}
+
+/**
+ * Remove every stored pair (and reset the hit and miss counts).
+ */
+void EvaluationCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    slots.assign(slots.size(), -1);
+    count = 0;
+    newest = oldest = -1;
+    hit_count = miss_count = 0;
+}
+
+/**
+ * This function returns a Function type object which returns the same values as func but which remembers (up to capacity of)
+ * the values it has computed, so that f is evaluated only once per distinct x (as long as that x stays among the capacity most recently used).
+ *
+ * Memoization only pays off when f is expensive (e.g. a nested integral) compared to one lookup (roughly 20 to 50 nanoseconds).
+ */
+Function memoize(const Function & func, std::size_t capacity)
+{
+    return memoize(func, std::make_shared<EvaluationCache>(capacity));
+}
+
+/**
+ * This function returns a Function type object which returns the same values as func but which looks up and stores its
+ * values in cache (which may be shared with other memoized Functions of the same f, and whose hits() and misses() can be inspected).
+ *
+ * f is called without holding the lock of the cache (so f may itself call memoized Functions), and NaN arguments are never stored.
+ */
+Function memoize(const Function & func, const std::shared_ptr<EvaluationCache> & cache)
+{
+    return [func, cache](double x) -> double
+    {
+        double y = 0.0;
+        if (std::isnan(x)) return func(x);
+        if (cache->find(x, y)) return y;
+        y = func(x);
+        cache->insert(x, y);
+        return y;
+    };
+}
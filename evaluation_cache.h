@@ -0,0 +1,77 @@
+/**
+ * file: evaluation_cache.h
+ * type: C++ (header file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+#ifndef EVALUATION_CACHE_H
+#define EVALUATION_CACHE_H
+
+/** preprocessing directives */
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t, std::int32_t
+#include <memory> // std::shared_ptr
+#include <mutex> // std::mutex
+#include <vector> // std::vector
+#include "reimann_sum.h" // Function
+#define DEFAULT_EVALUATION_CACHE_CAPACITY 65536 // constant which represents the default number of (x, f(x)) pairs which an EvaluationCache keeps
+#define MAXIMUM_EVALUATION_CACHE_CAPACITY 16777216 // constant which represents the maximum number of (x, f(x)) pairs which an EvaluationCache keeps
+
+/**
+ * An EvaluationCache remembers up to capacity pairs (x, f(x)) of one single variable function, y = f(x).
+ *
+ * The pairs are found through a flat open-addressing hash table (with linear probing) which is keyed by the exact bit pattern
+ * of x and which is never more than half full. Once capacity pairs are stored, inserting another pair evicts the least
+ * recently used pair (the pairs are linked from the most recently used to the least recently used).
+ *
+ * find and insert lock a mutex, so one EvaluationCache may be shared by several threads.
+ */
+class EvaluationCache
+{
+public:
+    explicit EvaluationCache(std::size_t capacity = DEFAULT_EVALUATION_CACHE_CAPACITY);
+
+    bool find(double x, double & y);
+    void insert(double x, double y);
+    void clear();
+
+    std::size_t size() const { return count; }
+    std::size_t capacity() const { return entries.size(); }
+    long long hits() const { return hit_count; }
+    long long misses() const { return miss_count; }
+
+private:
+    /**
+     * One stored pair (x is stored as its bit pattern) and the indices of the next more recently used and the next
+     * less recently used entries (or -1).
+     */
+    struct Entry {
+        std::uint64_t key;
+        double value;
+        std::int32_t newer;
+        std::int32_t older;
+    };
+
+    std::size_t slotOf(std::uint64_t key) const;
+    void unlink(std::int32_t entry);
+    void linkAsNewest(std::int32_t entry);
+    void eraseSlot(std::size_t slot);
+
+    std::vector<Entry> entries;
+    std::vector<std::int32_t> slots; // the entry index stored in each slot of the hash table (or -1 if the slot is empty)
+    std::size_t mask = 0;
+    std::size_t count = 0;
+    std::int32_t newest = -1;
+    std::int32_t oldest = -1;
+    long long hit_count = 0;
+    long long miss_count = 0;
+    std::mutex mutex;
+};
+
+/** function prototypes */
+Function memoize(const Function & func, std::size_t capacity = DEFAULT_EVALUATION_CACHE_CAPACITY);
+Function memoize(const Function & func, const std::shared_ptr<EvaluationCache> & cache);
+
+#endif // EVALUATION_CACHE_H
@@ -0,0 +1,384 @@
+/**
+ * file: exponential_kernels.h
+ * type: C++ (header file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+#ifndef EXPONENTIAL_KERNELS_H
+#define EXPONENTIAL_KERNELS_H
+
+/** preprocessing directives */
+#include <bit> // std::bit_cast
+#include <cstdint> // std::uint64_t, std::int64_t
+#include "double_double.h" // twoSum
+#define EXPONENTIAL_TABLE_LENGTH 128 // constant which represents the number of values 2 ^ (j / 128) in the table of exponentialKernel
+#define LOGARITHM_TABLE_LENGTH 128 // constant which represents the number of subintervals of [0.6875, 1.375) in the table of logarithmKernel
+#define MAXIMUM_EXPONENTIAL_KERNEL_x 708 // constant which represents the largest |x| for which exponentialKernel(x) is a normal double
+#define MAXIMUM_EXPONENTIAL_BASE_TWO_KERNEL_x 1021 // constant which represents the largest |x| for which exponentialBaseTwoKernel(x) is a normal double
+#define WHOLE_NUMBER_SHIFTER 6755399441055744.0 // constant which represents 1.5 * 2 ^ 52 (adding and then subtracting it rounds a double whose magnitude is below 2 ^ 51 to the nearest whole number)
+#define ONE_TWENTY_EIGHTH_OVER_LN_2 184.6649652337873 // constant which represents 128 / ln(2)
+#define LN_2_OVER_128_HIGH 0.0054152123482253955 // constant which represents the first 35 bits of ln(2) / 128 (so that n * LN_2_OVER_128_HIGH is exact for |n| < 2 ^ 18)
+#define LN_2_OVER_128_LOW -1.0082281460997769e-13 // constant which represents ln(2) / 128 - LN_2_OVER_128_HIGH
+#define LN_2_HIGH 0.6931471805598903 // constant which represents the first 42 bits of ln(2) (so that k * LN_2_HIGH is exact for every exponent k of a double)
+#define LN_2_LOW 5.497923018708371e-14 // constant which represents ln(2) - LN_2_HIGH
+#define LN_2_LONG 0.693147180559945309417232121458176568L // constant which represents ln(2) (to the precision of a long double)
+#define LN_10_LONG 2.302585092994045684017991454684364208L // constant which represents ln(10) (to the precision of a long double)
+#define LN_2 0.6931471805599453 // constant which represents ln(2) (rounded to the nearest double)
+#define INVERSE_LN_2_HIGH 1.4426950216293335 // constant which represents the first 26 bits of 1 / ln(2) (so that its product with a double of 26 bits is exact)
+#define INVERSE_LN_2_LOW 1.9259629911266175e-08 // constant which represents 1 / ln(2) - INVERSE_LN_2_HIGH
+#define INVERSE_LN_10_HIGH 0.4342944771051407 // constant which represents the first 26 bits of 1 / ln(10) (so that its product with a double of 26 bits is exact)
+#define INVERSE_LN_10_LOW 4.798111141615973e-09 // constant which represents 1 / ln(10) - INVERSE_LN_10_HIGH
+#define HIGH_HALF_MASK 0xFFFFFFFFF8000000ULL // constant which represents the bits of a double which store its sign, its exponent, and the first 26 bits of its significand
+#define LOG_10_OF_2_HIGH 0.30102999566395283 // constant which represents the first 42 bits of log_10(2) (so that k * LOG_10_OF_2_HIGH is exact for every exponent k of a double)
+#define LOG_10_OF_2_LOW 2.8363394551044964e-14 // constant which represents log_10(2) - LOG_10_OF_2_HIGH
+#define LOGARITHM_TABLE_OFFSET 0x3FE5F00000000000ULL // constant which represents the bits of 0.6875 minus one half of a subinterval of the table of logarithmKernel
+
+/** function prototypes */
+constexpr long double exponentialSeries(long double x);
+constexpr long double logarithmSeries(long double x);
+inline double scaledExponential(double shifted, double r, double & correction);
+inline double exponentialScale(double x, double & correction);
+inline double exponentialKernel(double x);
+inline double exponentialMinusOneKernel(double x);
+inline double exponentialBaseTwoKernel(double x);
+inline double logarithmReduction(double x, double x_low, double & k, std::uint64_t & i);
+inline double logarithmOfOnePlusPolynomial(double r);
+inline double scaledByInverse(double r, double inverse_high, double inverse_low, double & error);
+inline double logarithmKernel(double x, double x_low = 0.0);
+inline double logarithmTwoPartKernel(double x, double & low);
+inline double logarithmOfOnePlusKernel(double x);
+inline double logarithmBaseTwoKernel(double x);
+inline double logarithmBaseTenKernel(double x);
+
+/**
+ * The kernels in this file compute e ^ x, e ^ x - 1, 2 ^ x, ln(x), ln(1 + x), log_2(x), and log_10(x) to within about one or two units
+ * in the last place with a table lookup and a short polynomial (instead of with the long Taylor series of power_of_e_to_x or the 3-term float approximation of ln).
+ *
+ * They contain no branch (and no division), so a loop which calls them for each element of an array is vectorized by the compiler.
+ * In return, they do not check their arguments: the callers (such as the hyperbolic functions) keep the arguments in the documented
+ * ranges and handle zero, infinity, "not a number", and overflow separately.
+ *
+ * The tables are computed by the compiler (in long double arithmetic, so that each value is stored as a pair of doubles whose sum
+ * is accurate to about 64 bits). The kernels of the same family share one table and one range reduction (e.g. 2 ^ x only differs
+ * from e ^ x in how x is split into n / 128 and r), so each specialized kernel costs about as much as e ^ x or ln(x) itself.
+ */
+
+/**
+ * Return e ^ x for |x| <= ln(2) (from its Taylor series in long double arithmetic, which is only used to compute the tables).
+ */
+constexpr long double exponentialSeries(long double x)
+{
+    long double term = 1.0L, sum = 1.0L;
+    for (int n = 1; n < 40; n += 1)
+    {
+        term *= x / n;
+        sum += term;
+    }
+    return sum;
+}
+
+/**
+ * Return ln(x) for x in [0.5, 2] (from ln(x) = 2 * (u + u ^ 3 / 3 + u ^ 5 / 5 + ...) where u = (x - 1) / (x + 1), in long double
+ * arithmetic, which is only used to compute the tables).
+ */
+constexpr long double logarithmSeries(long double x)
+{
+    long double u = (x - 1.0L) / (x + 1.0L), u_squared = u * u, power = u, sum = 0.0L;
+    for (int n = 1; n < 80; n += 2)
+    {
+        sum += power / n;
+        power *= u_squared;
+    }
+    return 2.0L * sum;
+}
+
+/**
+ * An ExponentialTable stores 2 ^ (j / EXPONENTIAL_TABLE_LENGTH) for j = 0, 1, ..., EXPONENTIAL_TABLE_LENGTH - 1 as the double
+ * high[j] and the relative correction relative_low[j] (i.e. 2 ^ (j / EXPONENTIAL_TABLE_LENGTH) ≈ high[j] * (1 + relative_low[j])).
+ */
+struct ExponentialTable {
+    double high[EXPONENTIAL_TABLE_LENGTH];
+    double relative_low[EXPONENTIAL_TABLE_LENGTH];
+};
+
+/**
+ * A LogarithmTable stores, for each of the LOGARITHM_TABLE_LENGTH subintervals of [0.6875, 1.375) (which are equally wide in the bits
+ * of a double), the center c of the subinterval, 1 / c (rounded to a double), and ln(c), log_2(c), and log_10(c) as pairs of doubles
+ * (e.g. ln(c) = ln_high + ln_low).
+ *
+ * The subintervals are shifted by one half of their width, so that 1 is the center of a subinterval (and ln(c) = 0 there, which keeps
+ * ln(x) accurate to its last bit for x next to 1).
+ */
+struct LogarithmTable {
+    double center[LOGARITHM_TABLE_LENGTH];
+    double inverse_center[LOGARITHM_TABLE_LENGTH];
+    double ln_high[LOGARITHM_TABLE_LENGTH];
+    double ln_low[LOGARITHM_TABLE_LENGTH];
+    double log2_high[LOGARITHM_TABLE_LENGTH];
+    double log2_low[LOGARITHM_TABLE_LENGTH];
+    double log10_high[LOGARITHM_TABLE_LENGTH];
+    double log10_low[LOGARITHM_TABLE_LENGTH];
+};
+
+/**
+ * Return the ExponentialTable (which the compiler computes if the result initializes a constexpr variable).
+ */
+constexpr ExponentialTable makeExponentialTable()
+{
+    ExponentialTable table = {};
+    for (int j = 0; j < EXPONENTIAL_TABLE_LENGTH; j += 1)
+    {
+        long double value = exponentialSeries(j * LN_2_LONG / EXPONENTIAL_TABLE_LENGTH);
+        table.high[j] = static_cast<double>(value);
+        table.relative_low[j] = static_cast<double>((value - table.high[j]) / table.high[j]);
+    }
+    return table;
+}
+
+/**
+ * Return the LogarithmTable (which the compiler computes if the result initializes a constexpr variable).
+ */
+constexpr LogarithmTable makeLogarithmTable()
+{
+    LogarithmTable table = {};
+    for (int i = 0; i < LOGARITHM_TABLE_LENGTH; i += 1)
+    {
+        double center = std::bit_cast<double>(LOGARITHM_TABLE_OFFSET + (static_cast<std::uint64_t>(i) << 45) + (1ULL << 44));
+        long double logarithm_of_center = logarithmSeries(center);
+        table.center[i] = center;
+        table.inverse_center[i] = static_cast<double>(1.0L / center);
+        table.ln_high[i] = static_cast<double>(logarithm_of_center);
+        table.ln_low[i] = static_cast<double>(logarithm_of_center - table.ln_high[i]);
+        table.log2_high[i] = static_cast<double>(logarithm_of_center / LN_2_LONG);
+        table.log2_low[i] = static_cast<double>(logarithm_of_center / LN_2_LONG - table.log2_high[i]);
+        table.log10_high[i] = static_cast<double>(logarithm_of_center / LN_10_LONG);
+        table.log10_low[i] = static_cast<double>(logarithm_of_center / LN_10_LONG - table.log10_high[i]);
+    }
+    return table;
+}
+
+// The tables are computed at compile time.
+inline constexpr ExponentialTable EXPONENTIAL_TABLE = makeExponentialTable();
+inline constexpr LogarithmTable LOGARITHM_TABLE = makeLogarithmTable();
+
+/**
+ * Return 2 ^ (n / 128) and store e ^ r * (2 ^ (j / 128) / high[j]) - 1 in correction, where n is stored in the low bits of
+ * shifted = n + WHOLE_NUMBER_SHIFTER (so 2 ^ (n / 128) * e ^ r = scale * (1 + correction)).
+ *
+ * scale is the table value 2 ^ (j / 128) (where j = n modulo 128) whose exponent field is increased by n / 128 with an integer
+ * addition, so that no conversion between integers and doubles is needed. e ^ r - 1 is its Taylor polynomial of degree 5
+ * (whose truncation error is below r ^ 6 / 720 < 5e-19 for |r| <= ln(2) / 256).
+ *
+ * n / 128 is assumed to be in [-1022, 1023] (so that scale is a normal double).
+ */
+inline double scaledExponential(double shifted, double r, double & correction)
+{
+    std::uint64_t n_bits = std::bit_cast<std::uint64_t>(shifted);
+    std::uint64_t j = n_bits & (EXPONENTIAL_TABLE_LENGTH - 1);
+    std::uint64_t exponent_bits = (n_bits - j) << 45;
+    double scale = std::bit_cast<double>(std::bit_cast<std::uint64_t>(EXPONENTIAL_TABLE.high[j]) + exponent_bits);
+
+    double e_to_r_minus_one = r + r * r * (1.0 / 2 + r * (1.0 / 6 + r * (1.0 / 24 + r * (1.0 / 120))));
+    double relative_low = EXPONENTIAL_TABLE.relative_low[j];
+    correction = relative_low + e_to_r_minus_one + relative_low * e_to_r_minus_one;
+    return scale;
+}
+
+/**
+ * Write x = (n / 128) * ln(2) + r (where |r| <= ln(2) / 256) and e ^ x = 2 ^ (n / 128) * e ^ r = scale * (1 + correction).
+ * Return scale (which is exact) and store correction in correction.
+ *
+ * n is rounded with WHOLE_NUMBER_SHIFTER, and r is computed with the two-part ln(2) / 128 (whose high part times n is exact).
+ *
+ * |x| is assumed to be at most MAXIMUM_EXPONENTIAL_KERNEL_x (so that scale is a normal double).
+ */
+inline double exponentialScale(double x, double & correction)
+{
+    double shifted = x * ONE_TWENTY_EIGHTH_OVER_LN_2 + WHOLE_NUMBER_SHIFTER;
+    double n = shifted - WHOLE_NUMBER_SHIFTER;
+    double r = (x - n * LN_2_OVER_128_HIGH) - n * LN_2_OVER_128_LOW;
+    return scaledExponential(shifted, r, correction);
+}
+
+/**
+ * Return e ^ x for |x| <= MAXIMUM_EXPONENTIAL_KERNEL_x (to within about one unit in the last place).
+ */
+inline double exponentialKernel(double x)
+{
+    double correction = 0.0;
+    double scale = exponentialScale(x, correction);
+    return scale + scale * correction;
+}
+
+/**
+ * Return e ^ x - 1 for |x| <= MAXIMUM_EXPONENTIAL_KERNEL_x (to within about two units in the last place, also if x is close to zero,
+ * where computing e ^ x and then subtracting 1 would cancel most of the digits).
+ *
+ * If |x| < ln(2) / 256, then n = 0 and scale = 1, so the result is the Taylor polynomial of e ^ x - 1 itself. Otherwise,
+ * scale - 1 is exact whenever scale is in [0.5, 2] (and has only a small relative rounding error when it is not).
+ */
+inline double exponentialMinusOneKernel(double x)
+{
+    double correction = 0.0;
+    double scale = exponentialScale(x, correction);
+    return (scale - 1.0) + scale * correction;
+}
+
+/**
+ * Return 2 ^ x for |x| <= MAXIMUM_EXPONENTIAL_BASE_TWO_KERNEL_x (to within about one unit in the last place).
+ *
+ * x = n / 128 + d is split with WHOLE_NUMBER_SHIFTER (where d = x - n / 128 is exact, because x and n / 128 are both whole multiples of
+ * the last place of x and |d| <= 1 / 256), so 2 ^ x = 2 ^ (n / 128) * e ^ r with r = d * ln(2). The table and the polynomial are those
+ * of exponentialKernel (and, unlike e ^ x, no two-part constant is needed to reduce x).
+ */
+inline double exponentialBaseTwoKernel(double x)
+{
+    double shifted = x * EXPONENTIAL_TABLE_LENGTH + WHOLE_NUMBER_SHIFTER;
+    double n = shifted - WHOLE_NUMBER_SHIFTER;
+    double r = (x - n * (1.0 / EXPONENTIAL_TABLE_LENGTH)) * LN_2;
+    double correction = 0.0;
+    double scale = scaledExponential(shifted, r, correction);
+    return scale + scale * correction;
+}
+
+/**
+ * Split x + x_low (for a positive normal double x and a tiny x_low) into 2 ^ k * c * (1 + r), store k in k and the index of c in the
+ * LogarithmTable in i, and return r.
+ *
+ * x = 2 ^ k * m (where m is in [0.6875, 1.375)) is split by its bits, and m falls into the subinterval i of the LogarithmTable (which is
+ * read from the same bits). Then, for the natural logarithm (and likewise for the other bases),
+ *
+ * ln(x) = k * ln(2) + ln(c) + ln(1 + r)    where r = (m - c) / c
+ *
+ * and |r| <= 2 ^ -8. m - c is exact, and x_low is added to first order: ln(x + x_low) ≈ ln(x) + x_low / x = ln(x) + x_low * 2 ^ -k / (c * (1 + r)).
+ *
+ * The kernels of ln(x), log_2(x), and log_10(x) share this reduction (and the polynomial of ln(1 + r)) and only differ in the table
+ * columns and the constants with which they combine k, c, and r.
+ */
+inline double logarithmReduction(double x, double x_low, double & k, std::uint64_t & i)
+{
+    std::uint64_t bits = std::bit_cast<std::uint64_t>(x);
+    std::uint64_t offset_bits = bits - LOGARITHM_TABLE_OFFSET;
+    std::uint64_t exponent_bits = offset_bits & 0xFFF0000000000000ULL;
+    double m = std::bit_cast<double>(bits - exponent_bits);
+    double two_to_minus_k = std::bit_cast<double>(0x3FF0000000000000ULL - exponent_bits);
+    i = (offset_bits >> 45) & (LOGARITHM_TABLE_LENGTH - 1);
+    // k + 1023 is in [1, 2047], so it is read with a logical shift (SSE2 has no arithmetic shift of 64-bit integers) and converted by WHOLE_NUMBER_SHIFTER.
+    k = std::bit_cast<double>(std::bit_cast<std::uint64_t>(WHOLE_NUMBER_SHIFTER) + ((offset_bits + 0x3FF0000000000000ULL) >> 52)) - (WHOLE_NUMBER_SHIFTER + 1023);
+    return ((m - LOGARITHM_TABLE.center[i]) + x_low * two_to_minus_k) * LOGARITHM_TABLE.inverse_center[i];
+}
+
+/**
+ * Return ln(1 + r) - r for |r| <= 2 ^ -8 (from the Taylor polynomial of degree 7, which is accurate to 2 ^ -67).
+ */
+inline double logarithmOfOnePlusPolynomial(double r)
+{
+    return r * r * (-1.0 / 2 + r * (1.0 / 3 + r * (-1.0 / 4 + r * (1.0 / 5 + r * (-1.0 / 6 + r * (1.0 / 7))))));
+}
+
+/**
+ * Return r * (inverse_high + inverse_low) as the sum of the returned value and error (for a constant whose first 26 bits are inverse_high).
+ *
+ * r is split into its first 26 bits r_high (by its bits) and r - r_high, so r_high * inverse_high is exact and only the small products are
+ * rounded. (This is a cheaper version of twoProduct for a constant, without fused multiply-add instructions and without splitting the constant.)
+ */
+inline double scaledByInverse(double r, double inverse_high, double inverse_low, double & error)
+{
+    double r_high = std::bit_cast<double>(std::bit_cast<std::uint64_t>(r) & HIGH_HALF_MASK);
+    error = (r - r_high) * inverse_high + r * inverse_low;
+    return r_high * inverse_high;
+}
+
+/**
+ * Return ln(x + x_low) for a positive normal double x and a tiny x_low (such as the rounding error of x, which logarithmOfOnePlusKernel
+ * passes) to within about one unit in the last place.
+ *
+ * ln(x) = k * ln(2) + ln(c) + r + (ln(1 + r) - r) (see logarithmReduction), where k * LN_2_HIGH is exact and the rounding errors of the
+ * two leading sums are kept with twoSum.
+ */
+inline double logarithmKernel(double x, double x_low)
+{
+    double k = 0.0, first_error = 0.0, second_error = 0.0;
+    std::uint64_t i = 0;
+    double r = logarithmReduction(x, x_low, k, i);
+    double w = twoSum(k * LN_2_HIGH, LOGARITHM_TABLE.ln_high[i], first_error);
+    double sum = twoSum(w, r, second_error);
+    return sum + (((first_error + second_error) + logarithmOfOnePlusPolynomial(r)) + (k * LN_2_LOW + LOGARITHM_TABLE.ln_low[i]));
+}
+
+/**
+ * Return ln(x) rounded to a double for a positive normal double x and store its remaining error in low (so that the sum of the two parts
+ * is accurate to about 2 ^ -62 * |ln(x)|, which a caller needs where ln(x) is multiplied by a large number, as in x ^ y = e ^ (y * ln(x))).
+ *
+ * The terms are those of logarithmKernel, plus the rounding error of r = (m - c) * (1 / c): c has only 8 significant bits, so the products
+ * of c with the two halves of r (see scaledByInverse) are exact, m - c - r * c is exact, and dividing it by c gives the error of r to first order.
+ */
+inline double logarithmTwoPartKernel(double x, double & low)
+{
+    double k = 0.0, first_error = 0.0, second_error = 0.0;
+    std::uint64_t i = 0;
+    double r = logarithmReduction(x, 0.0, k, i);
+    std::uint64_t bits = std::bit_cast<std::uint64_t>(x);
+    double m = std::bit_cast<double>(bits - ((bits - LOGARITHM_TABLE_OFFSET) & 0xFFF0000000000000ULL));
+    double r_high = std::bit_cast<double>(std::bit_cast<std::uint64_t>(r) & HIGH_HALF_MASK);
+    double r_low = (((m - LOGARITHM_TABLE.center[i]) - r_high * LOGARITHM_TABLE.center[i]) - (r - r_high) * LOGARITHM_TABLE.center[i]) * LOGARITHM_TABLE.inverse_center[i];
+    double w = twoSum(k * LN_2_HIGH, LOGARITHM_TABLE.ln_high[i], first_error);
+    double sum = twoSum(w, r, second_error);
+    double tail = ((first_error + second_error) + (logarithmOfOnePlusPolynomial(r) + r_low * (1.0 - r))) + (k * LN_2_LOW + LOGARITHM_TABLE.ln_low[i]);
+    double high = sum + tail;
+    low = (sum - high) + tail;
+    return high;
+}
+
+/**
+ * Return ln(1 + x) for x in (-1, 2 ^ 1000] (to within about one unit in the last place, also if x is close to zero, where
+ * rounding 1 + x to a double would lose the digits of x).
+ *
+ * 1 + x is rounded to u, and its rounding error (which twoSum computes exactly) is passed to logarithmKernel as u_low.
+ */
+inline double logarithmOfOnePlusKernel(double x)
+{
+    double u_low = 0.0;
+    double u = twoSum(1.0, x, u_low);
+    return logarithmKernel(u, u_low);
+}
+
+/**
+ * Return log_2(x) for a positive normal double x (to within about one unit in the last place, and exactly k if x = 2 ^ k).
+ *
+ * log_2(x) = k + log_2(c) + r / ln(2) + (ln(1 + r) - r) / ln(2) (see logarithmReduction), so the exponent k is added exactly (instead of
+ * being multiplied by ln(2) and then divided by it again, as the change of base ln(x) / ln(2) does) and log_2(c) comes from the table.
+ * r / ln(2) is computed with scaledByInverse, and the rounding errors of the two leading sums are kept with twoSum.
+ */
+inline double logarithmBaseTwoKernel(double x)
+{
+    double k = 0.0, product_error = 0.0, first_error = 0.0, second_error = 0.0;
+    std::uint64_t i = 0;
+    double r = logarithmReduction(x, 0.0, k, i);
+    double product = scaledByInverse(r, INVERSE_LN_2_HIGH, INVERSE_LN_2_LOW, product_error);
+    double w = twoSum(k, LOGARITHM_TABLE.log2_high[i], first_error);
+    double sum = twoSum(w, product, second_error);
+    return sum + (((first_error + second_error) + (product_error + logarithmOfOnePlusPolynomial(r) * (INVERSE_LN_2_HIGH + INVERSE_LN_2_LOW))) + LOGARITHM_TABLE.log2_low[i]);
+}
+
+/**
+ * Return log_10(x) for a positive normal double x (to within about one unit in the last place).
+ *
+ * log_10(x) = k * log_10(2) + log_10(c) + r / ln(10) + (ln(1 + r) - r) / ln(10) (see logarithmReduction), where k * LOG_10_OF_2_HIGH is exact
+ * and r / ln(10) is computed with scaledByInverse (so the change of base adds no rounding error which matters, instead of the three
+ * rounding errors of ln(x) / ln(10)).
+ */
+inline double logarithmBaseTenKernel(double x)
+{
+    double k = 0.0, product_error = 0.0, first_error = 0.0, second_error = 0.0;
+    std::uint64_t i = 0;
+    double r = logarithmReduction(x, 0.0, k, i);
+    double product = scaledByInverse(r, INVERSE_LN_10_HIGH, INVERSE_LN_10_LOW, product_error);
+    double w = twoSum(k * LOG_10_OF_2_HIGH, LOGARITHM_TABLE.log10_high[i], first_error);
+    double sum = twoSum(w, product, second_error);
+    return sum + (((first_error + second_error) + (product_error + logarithmOfOnePlusPolynomial(r) * (INVERSE_LN_10_HIGH + INVERSE_LN_10_LOW))) + (k * LOG_10_OF_2_LOW + LOGARITHM_TABLE.log10_low[i]));
+}
+
+#endif // EXPONENTIAL_KERNELS_H
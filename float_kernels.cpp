@@ -0,0 +1,124 @@
+/**
+ * file: float_kernels.cpp
+ * type: C++ (source file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+/** preprocessing directives */
+#include <bit> // std::bit_cast
+#include <cstdint> // std::uint32_t
+#include <cmath> // std::sin, std::cos, std::log, std::exp, std::pow, std::isfinite
+#include "float_kernels.h" // sineFloatKernel, cosineFloatKernel, lnFloatKernel, powerOfEToXFloatKernel, powerFloatKernel, evaluateWithFixUp, BATCH_TARGETS, function prototypes
+#define SMALLEST_NORMAL_FLOAT_BITS 0x00800000U // constant which represents the bits of 2 ^ -126 (the smallest positive float which lnFloatKernel accepts)
+#define LARGEST_FLOAT_BITS 0x7F7FFFFFU // constant which represents the bits of the largest finite float
+
+/**
+ * Return 1 if |x| is larger than MAXIMUM_x (or if x is "not a number") and 0 otherwise.
+ */
+static inline std::uint32_t isOutsideFloatMaximum(float x)
+{
+    return magnitudeAbove(x, static_cast<float>(MAXIMUM_x));
+}
+
+/**
+ * Return true if x is in [(-1 * MAXIMUM_x), MAXIMUM_x].
+ */
+static inline bool isWithinFloatMaximum(float x)
+{
+    return (x >= (-1 * MAXIMUM_x)) && (x <= MAXIMUM_x);
+}
+
+/**
+ * Return 1 if x is not a positive normal float in (0, MAXIMUM_x] (i.e. if x is negative, zero, subnormal, above MAXIMUM_x, or "not a number")
+ * and 0 otherwise (with two integer subtractions, as isOutsideLogarithmKernelRange of logarithm.cpp does for doubles).
+ */
+static inline std::uint32_t isOutsideLnFloatKernelRange(float x)
+{
+    std::uint32_t bits = std::bit_cast<std::uint32_t>(x);
+    return ((bits - SMALLEST_NORMAL_FLOAT_BITS) | (std::bit_cast<std::uint32_t>(static_cast<float>(MAXIMUM_x)) - bits)) >> 31;
+}
+
+/**
+ * Return 1 if x is not a positive finite float (i.e. if x is negative, zero, infinite, or "not a number") and 0 otherwise.
+ */
+static inline std::uint32_t isOutsidePowerFloatKernelRange(float x)
+{
+    std::uint32_t bits = std::bit_cast<std::uint32_t>(x);
+    return ((bits - 1) | (LARGEST_FLOAT_BITS - bits)) >> 31;
+}
+
+/**
+ * Return sin(x), cos(x), ln(x), and e ^ x for the special values which the batch kernels do not pass to the inline kernels (i.e. "not a number",
+ * subnormal floats, and |x| > MAXIMUM_EXPONENTIAL_FLOAT_KERNEL_x, where e ^ x overflows to infinity or is a subnormal float or zero).
+ */
+static float sineFloatUnchecked(float x) { return std::sin(x); }
+static float cosineFloatUnchecked(float x) { return std::cos(x); }
+static float lnFloatUnchecked(float x) { return std::log(x); }
+static float powerOfEToXFloatUnchecked(float x) { return std::exp(x); }
+
+/**
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ *
+ * The batch kernels below compute y[k] = f(x[k]) for k = 0, 1, ..., count - 1 for f = sin, cos, ln, and e ^ x (and y[k] = base[k] ^ exponent)
+ * with the inline kernels of float_kernels.h in their vectorized main loops. Each x[k] which is out of range is reset to 1 (and one message per
+ * call counts those values), as in the batch kernels of the double functions.
+ *
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * Store sin(x[k]) in y[k] for k = 0, 1, ..., count - 1 (where each x[k] is constrained to be in [(-1 * MAXIMUM_x), MAXIMUM_x]).
+ */
+BATCH_TARGETS void sineFloatBatch(const float * x, float * y, long long count)
+{
+    evaluateWithFixUp("sineFloatBatch", x, y, count, sineFloatKernel, isOutsideFloatMaximum, isWithinFloatMaximum, 1.0f, sineFloatUnchecked);
+}
+
+/**
+ * Store cos(x[k]) in y[k] for k = 0, 1, ..., count - 1 (where each x[k] is constrained to be in [(-1 * MAXIMUM_x), MAXIMUM_x]).
+ */
+BATCH_TARGETS void cosineFloatBatch(const float * x, float * y, long long count)
+{
+    evaluateWithFixUp("cosineFloatBatch", x, y, count, cosineFloatKernel, isOutsideFloatMaximum, isWithinFloatMaximum, 1.0f, cosineFloatUnchecked);
+}
+
+/**
+ * Store ln(x[k]) in y[k] for k = 0, 1, ..., count - 1 (where each x[k] is constrained to be in (0, MAXIMUM_x]).
+ */
+BATCH_TARGETS void lnFloatBatch(const float * x, float * y, long long count)
+{
+    auto in_range = [](float x) { return (x > 0) && (x <= MAXIMUM_x); };
+    evaluateWithFixUp("lnFloatBatch", x, y, count, lnFloatKernel, isOutsideLnFloatKernelRange, in_range, 1.0f, lnFloatUnchecked);
+}
+
+/**
+ * Store e ^ x[k] in y[k] for k = 0, 1, ..., count - 1 (where each x[k] is constrained to be in [(-1 * MAXIMUM_x), MAXIMUM_x]; e ^ x[k] overflows
+ * to infinity if x[k] is larger than about 88.72).
+ */
+BATCH_TARGETS void powerOfEToXFloatBatch(const float * x, float * y, long long count)
+{
+    auto is_special = [](float x) { return magnitudeAbove(x, static_cast<float>(MAXIMUM_EXPONENTIAL_FLOAT_KERNEL_x)); };
+    evaluateWithFixUp("powerOfEToXFloatBatch", x, y, count, powerOfEToXFloatKernel, is_special, isWithinFloatMaximum, 1.0f, powerOfEToXFloatUnchecked);
+}
+
+/**
+ * Store base[k] ^ exponent in y[k] for k = 0, 1, ..., count - 1 (e.g. the gamma correction y[k] = base[k] ^ (1 / 2.2) of each value of an image).
+ *
+ * Each base[k] is constrained to be in [0, MAXIMUM_x] (0 ^ exponent is 0 for a positive exponent and infinity for a negative exponent). If exponent
+ * is infinite or "not a number", every y[k] is computed by std::pow.
+ */
+BATCH_TARGETS void powerFloatBatch(const float * base, float exponent, float * y, long long count)
+{
+    auto kernel = [exponent](float x) { return powerFloatKernel(x, exponent); };
+    auto unchecked = [exponent](float x) { return std::pow(x, exponent); };
+    auto is_special = [](float x) { return isOutsidePowerFloatKernelRange(x) | isOutsideFloatMaximum(x); };
+    auto in_range = [](float x) { return (x >= 0) && (x <= MAXIMUM_x); };
+    if (!std::isfinite(exponent))
+    {
+        for (long long k = 0; k < count; k += 1) y[k] = unchecked(base[k]);
+        return;
+    }
+    evaluateWithFixUp("powerFloatBatch", base, y, count, kernel, is_special, in_range, 1.0f, unchecked);
+}
@@ -0,0 +1,214 @@
+/**
+ * file: float_kernels.h
+ * type: C++ (header file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+#ifndef FLOAT_KERNELS_H
+#define FLOAT_KERNELS_H
+
+/** preprocessing directives */
+#include <bit> // std::bit_cast
+#include <cstdint> // std::uint32_t, std::int32_t
+#include <cmath> // std::copysign
+#include "trigonometric_batch.h" // selectedBy, negatedIf, magnitudeAbove, evaluateWithFixUp, BATCH_TARGETS, MAXIMUM_x
+#include "accuracy_tiers.h" // reducedBySquareRootOfTwo, scaledByPowerOfTwo, INVERSE_LN_2, WHOLE_NUMBER_SHIFTER, LN_2, LN_2_HIGH, LN_2_LOW
+#define FLOAT_WHOLE_NUMBER_SHIFTER 12582912.0f // constant which represents 1.5 * 2 ^ 23 (adding and then subtracting it rounds a float whose magnitude is below 2 ^ 22 to the nearest whole number)
+#define TWO_OVER_PI_FLOAT 0.636619747f // constant which represents 2 / Pi (rounded to the nearest float)
+#define PI_OVER_TWO_FLOAT_FIRST 1.5703125f // constant which represents the first 11 bits of Pi / 2 (so that n * PI_OVER_TWO_FLOAT_FIRST is exact for |n| < 2 ^ 13)
+#define PI_OVER_TWO_FLOAT_SECOND 4.837512970e-04f // constant which represents the second 11 bits of Pi / 2
+#define PI_OVER_TWO_FLOAT_THIRD 7.549533620e-08f // constant which represents the third 11 bits of Pi / 2
+#define PI_OVER_TWO_FLOAT_TAIL 2.563344068e-12f // constant which represents Pi / 2 - PI_OVER_TWO_FLOAT_FIRST - PI_OVER_TWO_FLOAT_SECOND - PI_OVER_TWO_FLOAT_THIRD
+#define INVERSE_LN_2_FLOAT 1.44269502f // constant which represents 1 / ln(2) (rounded to the nearest float)
+#define LN_2_HIGH_FLOAT 0.693145752f // constant which represents the first 16 bits of ln(2) (so that k * LN_2_HIGH_FLOAT is exact for every exponent k of a float)
+#define LN_2_LOW_FLOAT 1.428606765e-06f // constant which represents ln(2) - LN_2_HIGH_FLOAT
+#define SQUARE_ROOT_OF_ONE_HALF_FLOAT_BITS 0x3F3504F3U // constant which represents the bits of sqrt(0.5) (the lower end of the interval to which lnFloatKernel reduces x)
+#define MAXIMUM_EXPONENTIAL_FLOAT_KERNEL_x 86 // constant which represents the largest |x| for which powerOfEToXFloatKernel(x) is a normal float
+#define MAXIMUM_POWER_FLOAT_KERNEL_PRODUCT 200 // constant which represents the largest |exponent * ln(base)| which powerFloatKernel evaluates (beyond about 104, the float result is infinity or zero in any case)
+
+/** function prototypes */
+inline float reduceFloatByPiOverTwo(float x, std::uint32_t & quadrant);
+inline float reducedFloatSine(float r);
+inline float reducedFloatCosine(float r);
+inline float sineFloatKernel(float x);
+inline float cosineFloatKernel(float x);
+inline float lnFloatKernel(float x);
+inline float powerOfEToXFloatKernel(float x);
+inline float powerFloatKernel(float base, float exponent);
+void sineFloatBatch(const float * x, float * y, long long count);
+void cosineFloatBatch(const float * x, float * y, long long count);
+void lnFloatBatch(const float * x, float * y, long long count);
+void powerOfEToXFloatBatch(const float * x, float * y, long long count);
+void powerFloatBatch(const float * base, float exponent, float * y, long long count);
+
+/**
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ *
+ * The kernels below compute sin(x), cos(x), ln(x), e ^ x, and base ^ exponent for float arguments and results (for callers which only need
+ * the precision of a float but need many values, e.g. an audio oscillator which computes sin(x) at 48000 samples per second for each of
+ * thousands of voices, or the gamma correction of every pixel of an image).
+ *
+ * They use the reductions of the float ln of logarithm.h and of the double kernels (x = 2 ^ k * m with m read from the bits of x, and
+ * x = n * (Pi / 2) + r or n * ln(2) + r with n rounded by a shifter) in float arithmetic, and each evaluates one short minimax polynomial, so
+ * that the results are within 1.6 units in the last place of a float for sin(x) and cos(x), 1.2 for ln(x), and 1 for e ^ x (instead of the
+ * 4.5e-4 absolute error of the float ln of logarithm.h).
+ *
+ * A vector register holds twice as many floats as doubles (4 with SSE2, 8 with AVX2, and 16 with AVX-512), and a loop which calls these
+ * kernels has no branch, so it is vectorized by the compiler. The batch kernels of float_kernels.cpp are compiled for AVX-512, for AVX2, and
+ * for the baseline instruction set, and the machine which runs them selects one of those versions (so they process 16 or 8 floats per
+ * instruction without KARBYTES_MATH_NATIVE). powerFloatKernel is the exception: it computes in double lanes, and powerFloatBatch is
+ * outside the throughput target of the others (see powerFloatKernel).
+ *
+ * Like the other kernels, these kernels do not check their arguments (the batch kernels do).
+ *
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * The coefficients of the minimax polynomials sin(r) ≈ r + r * z * S(z) and cos(r) ≈ 1 - z / 2 + z ^ 2 * C(z) (where z = r ^ 2) on
+ * [-Pi / 4, Pi / 4] (whose relative errors are below 3.8e-9 and 1.2e-10).
+ */
+inline constexpr float SINE_FLOAT_S[3] = { -1.666665524e-01f, 8.332160302e-03f, -1.951528247e-04f };
+inline constexpr float COSINE_FLOAT_C[3] = { 4.166664556e-02f, -1.388731645e-03f, 2.443315680e-05f };
+
+/**
+ * The coefficients of the minimax polynomials e ^ r ≈ 1 + r + r ^ 2 * E(r) on [-ln(2) / 2, ln(2) / 2] and ln(1 + f) ≈ f - f ^ 2 / 2 + f ^ 3 * L(f)
+ * on [sqrt(0.5) - 1, sqrt(2) - 1] (whose relative errors are below 3.1e-9 and 5.9e-9).
+ */
+inline constexpr float EXPONENTIAL_FLOAT_E[5] = { 4.999999404e-01f, 1.666652113e-01f, 4.166838899e-02f, 8.368710056e-03f, 1.381461276e-03f };
+inline constexpr float LN_FLOAT_L[8] = { 3.333333135e-01f, -2.500081956e-01f, 2.000122666e-01f, -1.662335694e-01f, 1.420175731e-01f, -1.316018254e-01f, 1.276157647e-01f, -7.634496689e-02f };
+
+/**
+ * The coefficients of the minimax polynomial ln((1 + s) / (1 - s)) ≈ 2 * s + s * w * A(w) (where w = s ^ 2) for |s| <= (sqrt(2) - 1) / (sqrt(2) + 1)
+ * (whose relative error is below 4.8e-12), which powerFloatKernel evaluates in double arithmetic.
+ */
+inline constexpr double POWER_FLOAT_LN_A[4] = { 6.66666656486456732e-01, 4.00003345345885553e-01, 2.85373469637240362e-01, 2.35814722594107767e-01 };
+
+/**
+ * Write x = n * (Pi / 2) + r (where r is in [-Pi / 4, Pi / 4]), store n modulo 4 in quadrant, and return r.
+ *
+ * Pi / 2 is split into three 11-bit parts and one 24-bit tail (as reduceByPiOverTwo of trigonometric_batch.h splits it into 33-bit parts), so each
+ * product of n with an 11-bit part is exact for every |x| <= MAXIMUM_x (where |n| < 2 ^ 13) and r keeps its relative accuracy where x is close to
+ * a multiple of Pi / 2.
+ */
+inline float reduceFloatByPiOverTwo(float x, std::uint32_t & quadrant)
+{
+    float shifted = x * TWO_OVER_PI_FLOAT + FLOAT_WHOLE_NUMBER_SHIFTER;
+    quadrant = std::bit_cast<std::uint32_t>(shifted) & 3;
+    float n = shifted - FLOAT_WHOLE_NUMBER_SHIFTER;
+
+    // The first two subtractions are exact (their results are multiples of 2 ^ -22 below 4), and the rounding error of the third one is added
+    // back together with the tail (so that r is rounded once).
+    float r = (x - n * PI_OVER_TWO_FLOAT_FIRST) - n * PI_OVER_TWO_FLOAT_SECOND;
+    float third = n * PI_OVER_TWO_FLOAT_THIRD;
+    float reduced = r - third;
+    return reduced + (((r - reduced) - third) - n * PI_OVER_TWO_FLOAT_TAIL);
+}
+
+/**
+ * Return sin(r) and cos(r) for r in [-Pi / 4, Pi / 4].
+ */
+inline float reducedFloatSine(float r)
+{
+    float z = r * r;
+    return r + (r * z) * (SINE_FLOAT_S[0] + z * (SINE_FLOAT_S[1] + z * SINE_FLOAT_S[2]));
+}
+
+inline float reducedFloatCosine(float r)
+{
+    float z = r * r;
+    return (1.0f - 0.5f * z) + (z * z) * (COSINE_FLOAT_C[0] + z * (COSINE_FLOAT_C[1] + z * COSINE_FLOAT_C[2]));
+}
+
+/**
+ * Return sin(x) for x in [(-1 * MAXIMUM_x), MAXIMUM_x].
+ *
+ * sin(r) and cos(r) are both computed and the quadrant n modulo 4 selects one of them and its sign (without a branch, as in tieredSine).
+ */
+inline float sineFloatKernel(float x)
+{
+    std::uint32_t quadrant = 0;
+    float r = reduceFloatByPiOverTwo(x, quadrant);
+    return negatedIf(quadrant >> 1, selectedBy(quadrant & 1, reducedFloatCosine(r), reducedFloatSine(r)));
+}
+
+/**
+ * Return cos(x) for x in [(-1 * MAXIMUM_x), MAXIMUM_x] (cos(x) = cos(r), -sin(r), -cos(r), sin(r) for n modulo 4 = 0, 1, 2, 3).
+ */
+inline float cosineFloatKernel(float x)
+{
+    std::uint32_t quadrant = 0;
+    float r = reduceFloatByPiOverTwo(x, quadrant);
+    return negatedIf(((quadrant + 1) >> 1) & 1, selectedBy(quadrant & 1, reducedFloatSine(r), reducedFloatCosine(r)));
+}
+
+/**
+ * Return ln(x) for a positive normal float x.
+ *
+ * x = 2 ^ k * m (where m is in [sqrt(0.5), sqrt(2))) is split by its bits (as in reducedBySquareRootOfTwo, and with an arithmetic shift of the
+ * 32-bit difference, which every x86-64 machine has as a vector instruction), and ln(x) = k * ln(2) + ln(1 + f) where f = m - 1 is exact.
+ * ln(2) is split in two parts, so ln(x) keeps its relative accuracy for x close to 1 (where k = 0).
+ */
+inline float lnFloatKernel(float x)
+{
+    std::uint32_t bits = std::bit_cast<std::uint32_t>(x);
+    std::uint32_t offset_bits = bits - SQUARE_ROOT_OF_ONE_HALF_FLOAT_BITS;
+    float m = std::bit_cast<float>(bits - (offset_bits & 0xFF800000U));
+    float k = static_cast<float>(std::bit_cast<std::int32_t>(offset_bits) >> 23);
+    float f = m - 1.0f, z = f * f;
+    float l = LN_FLOAT_L[1] + f * (LN_FLOAT_L[2] + f * (LN_FLOAT_L[3] + f * (LN_FLOAT_L[4] + f * (LN_FLOAT_L[5] + f * (LN_FLOAT_L[6] + f * LN_FLOAT_L[7])))));
+    return k * LN_2_HIGH_FLOAT + ((f - 0.5f * z) + ((z * f) * (LN_FLOAT_L[0] + f * l) + k * LN_2_LOW_FLOAT));
+}
+
+/**
+ * Return e ^ x for |x| <= MAXIMUM_EXPONENTIAL_FLOAT_KERNEL_x.
+ *
+ * e ^ x = 2 ^ n * e ^ r where n is the whole number nearest to x / ln(2) and r = x - n * ln(2) is in [-ln(2) / 2, ln(2) / 2]. 2 ^ n is added to the
+ * exponent field of e ^ r with an integer addition (as in scaledByPowerOfTwo).
+ */
+inline float powerOfEToXFloatKernel(float x)
+{
+    float shifted = x * INVERSE_LN_2_FLOAT + FLOAT_WHOLE_NUMBER_SHIFTER;
+    float n = shifted - FLOAT_WHOLE_NUMBER_SHIFTER;
+    float r = (x - n * LN_2_HIGH_FLOAT) - n * LN_2_LOW_FLOAT;
+    float e = EXPONENTIAL_FLOAT_E[0] + r * (EXPONENTIAL_FLOAT_E[1] + r * (EXPONENTIAL_FLOAT_E[2] + r * (EXPONENTIAL_FLOAT_E[3] + r * EXPONENTIAL_FLOAT_E[4])));
+    float p = 1.0f + (r + (r * r) * e);
+    return std::bit_cast<float>(std::bit_cast<std::uint32_t>(p) + (std::bit_cast<std::uint32_t>(shifted) << 23));
+}
+
+/**
+ * Return base ^ exponent = e ^ (exponent * ln(base)) for a positive float base (including subnormal floats) and a finite float exponent.
+ *
+ * The absolute error of exponent * ln(base) becomes the relative error of the result, and |exponent * ln(base)| is up to about 104 where the result
+ * is a normal float, so exponent * ln(base) is computed in double arithmetic (as the powf of the GNU C library does): ln(base) = k * ln(2) + ln(m)
+ * with ln(m) = ln((1 + s) / (1 - s)) where s = (m - 1) / (m + 1), and e ^ (exponent * ln(base)) = 2 ^ n * e ^ r (as in tieredPowerOfEToX).
+ * The result is within 0.55 units in the last place of a float (i.e. it is almost always the correctly rounded float), and rounds to infinity
+ * or to zero (or to a subnormal float) where the exact result does.
+ *
+ * A vector register holds half as many doubles as floats, so this kernel processes 4 or 8 elements per instruction with AVX2 or AVX-512.
+ *
+ * Hence powerFloatBatch is outside the throughput target of the other float batch kernels (more than 1e9 elements per second on one core):
+ * it computes about 6e8 elements per second on one core of a 2.1 GHz AVX-512 machine (where sineFloatBatch computes about 2.4e9). Keeping
+ * the whole computation in float lanes (with ln(base) as a float head and tail, an exact float product of exponent with it, and e ^ x in
+ * float) was measured on the same machine at about 6e8 to 8e8 elements per second for the same accuracy, because each exact float product
+ * and sum takes several instructions more than the double operation which it replaces.
+ */
+inline float powerFloatKernel(float base, float exponent)
+{
+    double k = 0.0;
+    double f = reducedBySquareRootOfTwo(static_cast<double>(base), k);
+    double s = f / (2.0 + f), w = s * s;
+    double ln_base = k * LN_2 + (2.0 * s + (s * w) * (POWER_FLOAT_LN_A[0] + w * (POWER_FLOAT_LN_A[1] + w * (POWER_FLOAT_LN_A[2] + w * POWER_FLOAT_LN_A[3]))));
+    double t = static_cast<double>(exponent) * ln_base;
+    // Keep |t| <= MAXIMUM_POWER_FLOAT_KERNEL_PRODUCT (so that 2 ^ n is a normal double) with bit operations, because ?: (or std::min) would be a branch.
+    t = selectedBy(magnitudeAbove(t, MAXIMUM_POWER_FLOAT_KERNEL_PRODUCT), std::copysign(1.0 * MAXIMUM_POWER_FLOAT_KERNEL_PRODUCT, t), t);
+    double shifted = t * INVERSE_LN_2 + WHOLE_NUMBER_SHIFTER;
+    double n = shifted - WHOLE_NUMBER_SHIFTER;
+    double r = (t - n * LN_2_HIGH) - n * LN_2_LOW;
+    double e = EXPONENTIAL_FLOAT_E[0] + r * (EXPONENTIAL_FLOAT_E[1] + r * (EXPONENTIAL_FLOAT_E[2] + r * (EXPONENTIAL_FLOAT_E[3] + r * EXPONENTIAL_FLOAT_E[4])));
+    return static_cast<float>(scaledByPowerOfTwo(shifted, 1.0 + (r + (r * r) * e)));
+}
+
+#endif // FLOAT_KERNELS_H
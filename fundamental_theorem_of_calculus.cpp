@@ -7,190 +7,12 @@
  */
 
 /** preprocessing directives */
-#include <iostream> // standard input (std::cin), standard output (std::cout)
-#include <fstream> // file input, file output, file open, file close
-#include <cmath> // sine function (sin(x)), cosine function (cos(x)), square root function (sqrt(x))
-#include <functional> // define custom Function type
-#include <array> // returning an array of Function type values
-#define MINIMUM_a -100 // constant which represents the minimum a value
-#define MAXIMUM_a 100 // constant which represents the maximum a value
-#define MINIMUM_b -100 // constant which represents the minimum b value
-#define MAXIMUM_b 100 // constant which represents the maximum b value
-#define MINIMUM_n 1 // constant which represents the minimum n value
-#define MAXIMUM_n 1000 // constant which represents the maximum n value
-
-// Define the data type for an object which represents a single variable function (in the format y = f(x)).
-using Function = std::function<double(double)>;
-
-/** 
- * The following code struct definition was copied from the C++ source code file featured on the following
- * tutorial web page:
- * 
- * https://karbytesforlifeblog.wordpress.com/reimann_sum/
- * 
- * The Reimann Sum is an approximation of an integral (and an integral, in the context of this program,
- * is a two-dimensional area whose boundaries are y = 0, x = a, x = b, and some function, y = f(x)).
- * 
- * As n approaches infinity, the Reiman Sum approaches the integral.
- *-------------------------------------------------------------------------------------------------------------------
- * Define a struct-type variable named Parameters which stores the three variables needed to take the Reimann Sum 
- * of some single-variable function (whose dependent variable is x) over some positive-length interval of the x-axis
- * of a Cartesian grid
- * where the left end of that interval is represented by a double-type variable named a,
- * where the right end of that interval is represented by a double-type variable named b,
- * and where the natural number of times which that interval is divided into equally-sized partitions 
- * is represented by an int-type variable named n.
- */
-struct Parameters { 
-    double a; 
-    double b; 
-    int n; 
-};
-
-/** function prototypes */
-std::array<Function, 6> generate_array_of_functions();
-Parameters selectPartitioningValues(std::ofstream & file);
-Function selectFunctionFromListOfFunctions(std::ofstream & file);
-double selectIntervalPoint(Parameters params, std::ofstream & file);
-Function derivative(Function f, double h = 1e-5);
-double computeRiemannSum(Function func, double a, double b, int n, const std::string& method);
-Function integral(Function f, double a, double b);
-
-/** program entry point */
-int main()
-{
-    // Declare a file output stream object.
-    std::ofstream file;
-
-    // Set the number of digits of floating-point numbers which are printed to the command line terminal to 100 digits.
-    std::cout.precision(100);
-
-    // Set the number of digits of floating-point numbers which are printed to the file output stream to 100 digits.
-    file.precision(100);
-
-    /**
-     * If the file named fundamental_theorem_of_calculus_output.txt does not already exist 
-     * inside of the same file directory as the file named fundamental_theorem_of_calculus.cpp, 
-     * create a new file named fundamental_theorem_of_calculus_output.txt in that directory.
-     * 
-     * Open the plain-text file named fundamental_theorem_of_calculus_output.txt
-     * and set that file to be overwritten with program data.
-     */
-    file.open("fundamental_theorem_of_calculus_output.txt");
-
-    // Print an opening message to the command line terminal.
-    std::cout << "\n\n--------------------------------";
-    std::cout << "\nStart Of Program";
-    std::cout << "\n--------------------------------";
-
-    // Print an opening message to the file output stream.
-    file << "--------------------------------";
-    file << "\nStart Of Program";
-    file << "\n--------------------------------";
-
-    // Print "This C++ program demonstrates the Fundamental Theorem of Calculus." to the command line terminal and to the file output stream.
-    std::cout << "\n\nThis C++ program demonstrates the Fundamental Theorem of Calculus.";
-    file << "\n\nThis C++ program demonstrates the Fundamental Theorem of Calculus.";
-
-    // Print a horizontal divider line to the command line terminal and to the file output stream.
-    std::cout << "\n\n--------------------------------";
-    file << "\n\n--------------------------------";
-
-    /**
-     * Prompt the user to select one of multiple single-variable functions from a list.
-     * Store the selected function in a Function type variable named func.
-     */
-    Function func = selectFunctionFromListOfFunctions(file);
-
-    // Print a horizontal divider line to the command line terminal and to the file output stream.
-    std::cout << "\n\n--------------------------------";
-    file << "\n\n--------------------------------";
-
-    /**
-     * Prompt the user to select end-point values for an interval of the x-axis, [a,b], 
-     * Store the selected x-axis interval end-point values in a Parameters type variable named params.
-     */
-    Parameters params = selectPartitioningValues(file);
-
-    // Print a horizontal divider line to the command line terminal and to the file output stream.
-    std::cout << "\n\n--------------------------------";
-    file << "\n\n--------------------------------";
-
-    /**
-     * Prompt the user to select an value inside of the x-axis interval, [a,b].
-     * Store the selected x-value in a double type variable named x.
-     */
-    double x = selectIntervalPoint(params, file);
-
-    // Print a horizontal divider line to the command line terminal and to the file output stream.
-    std::cout << "\n\n--------------------------------";
-    file << "\n\n--------------------------------";
-
-    // Obtain the value of f(x).
-    double func_of_x = func(x);
-
-    // Obtain the derivative of the selected function, f'.
-    Function func_prime = derivative(func);
-
-    // Obtain the value of f'(x).
-    double func_prime_of_x = func_prime(x);
-
-    // Print the value of f(x) to the command line terminal and to the file output stream.
-    std::cout << "\n\nf(x) = f(" << x << ") ≈ " << func_of_x << ".";
-    file << "\n\nf(x) = f(" << x << ") ≈ " << func_of_x << ".";
-
-    // Print the value of f'(x) to the command line terminal and to the file output stream.
-    std::cout << "\n\nf'(x) = f'(" << x << ") ≈ " << func_prime_of_x << ". // derivative";
-    file << "\n\nf'(x) = f'(" << x << ") ≈ " << func_prime_of_x << ". // derivative";
-
-    // Print a horizontal divider line to the command line terminal and to the file output stream.
-    std::cout << "\n\n--------------------------------";
-    file << "\n\n--------------------------------";
-
-    // Obtain the value of the definite integral of y = f(t) on the x-axis interval [a,b].
-    Function integ = integral(func, params.a, params.b);
-
-    // Obtain the value of the definite integral of y = f(t) on the x-axis interval [a,b].
-    double whole_interval_area = integ(params.b);
-
-    // Obtain the value of the definite integral of y = f(t) on the x-axis interval [a,x].
-    double selected_interval_area = integ(x);
-
-    // Print the value of the definite integral (of y = f(t) on the x-axis interval [a,b]) to the command line terminal and to the output file stream.
-    std::cout << "\n\nwhole_interval_area ≈ " << whole_interval_area << " // value of the definite integral of y = f(t) on the x-axis interval [a,b]";
-    file << "\n\nwhole_interval_area ≈ " << whole_interval_area << " // value of the definite integral of y = f(t) on the x-axis interval [a,b]";
-
-    // Print the value of the definite integral (of y = f(t) on the x-axis interval [x,b]) to the command line terminal and to the output file stream.
-    std::cout << "\n\nS f(x) dt (where dt is the interval [a,b]) = selected_interval_area = " << selected_interval_area << " // value of the definite integral of y = f(t) on the x-axis interval [a,x]";
-    file << "\n\nS f(x) dt (where dt is the interval [a,b]) = selected_interval_area = " << selected_interval_area << " // value of the definite integral of y = f(t) on the x-axis interval [a,x]";
-
-    // Print a horizontal divider line to the command line terminal and to the file output stream.
-    std::cout << "\n\n--------------------------------";
-    file << "\n\n--------------------------------";
-
-    // Obtain the value which represents f(x) = d/dx ( S integ(t) dt ) = ( S integ(t) dt )'.
-    Function original_function = derivative(integ, x);
-
-    // Print the derivative of the integral at x to the command line terminal and to the output file stream.
-    std::cout << "\n\noriginal_function ≈ derivative(integ, x) --> original_function(x) ≈ " << "original_function(" << x << ") = " << original_function(x) << "  // f(x) = d/dx ( S integ(t) dt ) = ( S integ(t) dt )'";
-    file << "\n\noriginal_function ≈ derivative(integ, x) --> original_function(x) ≈ " << "original_function(" << x << ") = " << original_function(x) << "  // f(x) = d/dx ( S integ(t) dt ) = ( S integ(t) dt )'";
-
-    // Print a closing message to the command line terminal.
-    std::cout << "\n\n--------------------------------";
-    std::cout << "\nEnd Of Program";
-    std::cout << "\n--------------------------------\n\n";
-
-    // Print a closing message to the file output stream.
-    file << "\n\n--------------------------------";
-    file << "\nEnd Of Program";
-    file << "\n--------------------------------";
-
-    // Close the file output stream.
-    file.close();
-
-    // Exit the program.
-    return 0; 
-}
+#include <cmath> // sine function (sin(x)), cosine function (cos(x)), square root function (sqrt(x)), std::floor, std::fabs, std::isfinite
+#include "fundamental_theorem_of_calculus.h" // Function, computeRiemannSum, function prototypes
+#include "gauss_legendre.h" // integrateGaussLegendre, gaussLegendreRule, GaussLegendreNodes, DEFAULT_GAUSS_LEGENDRE_ORDER, DEFAULT_GAUSS_LEGENDRE_PANEL_WIDTH
+#include "tanh_sinh.h" // integrateTanhSinh
+#include "evaluation_cache.h" // memoize
+#define ENDPOINT_SINGULARITY_TOLERANCE 1e-9 // constant which represents the relative difference between the 4-point and the 8-point probe of an end-point above which integral(f, a, b) treats f as singular there
 
 /**
  * This function returns an array of six Function type objects.
@@ -256,311 +78,32 @@ std::array<Function, 6> generate_array_of_functions()
 }
 
 /**
- * The following code struct definition was slightly modified after being copied from the C++ source code file 
- * featured on the following tutorial web page:
- * 
- * https://karbytesforlifeblog.wordpress.com/reimann_sum/
- *-------------------------------------------------------------------------------------------------------------------
- * This function displays a list of single-variable algebraic functions
- * on the command line terminal and in the output file stream and
- * prompts the program user to input an option number which corresponds
- * with exactly one of the aforementioned functions. 
- * 
- * After the user enters some value, the corresponding Function type
- * object is returned.
+ * This function returns an array of six IntervalFunction type objects which are the interval versions of the six Function type objects
+ * of generate_array_of_functions (in the same order). Each one returns an Interval which is guaranteed to contain f(x) for every x in its
+ * input Interval (e.g. for computeRiemannSumEnclosure).
  */
-Function selectFunctionFromListOfFunctions(std::ofstream & file)
+std::array<IntervalFunction, 6> generate_array_of_interval_functions()
 {
-    // Define an array of six Function type objects (which corresponds with the menu interface below).
-    std::array<Function, 6> functions_array = generate_array_of_functions();
-
-    // Initialize option to represent 0 (which is the associated with the first function in the array above).
-    int option = 0;
+    // interval_function_0: y = f(x) = x ^ 2 (which is never negative, even on an Interval which contains zero)
+    IntervalFunction interval_function_0 = [](const Interval & x) { return square(x); };
 
-    // Print menu options and the instruction to input an option number to the command line terminal.
-    std::cout << "\n\nEnter the number which corresponds with one of the following functions:";
-    std::cout << "\n\n0 --> f(x) = x^2";
-    std::cout << "\n\n1 --> f(x) = x^3";
-    std::cout << "\n\n2 --> f(x) = sin(x)";
-    std::cout << "\n\n3 --> f(x) = cos(x)";
-    std::cout << "\n\n4 --> f(x) = sqrt(x)";
-    std::cout << "\n\n5 --> f(x) = 2x + 3";
-    std::cout << "\n\nEnter Option Here: ";
+    // interval_function_1: y = f(x) = x ^ 3
+    IntervalFunction interval_function_1 = [](const Interval & x) { return cube(x); };
 
-    // Print menu options and the instruction to input an option number to the file output stream.
-    file << "\n\nEnter the number which corresponds with one of the following functions:";
-    file << "\n\n0 --> f(x) = x^2";
-    file << "\n\n1 --> f(x) = x^3";
-    file << "\n\n2 --> f(x) = sin(x)";
-    file << "\n\n3 --> f(x) = cos(x)";
-    file << "\n\n4 --> f(x) = sqrt(x)";
-    file << "\n\n5 --> f(x) = 2x + 3";
-    file << "\n\nEnter Option Here: ";
+    // interval_function_2: y = f(x) = sin(x)
+    IntervalFunction interval_function_2 = [](const Interval & x) { return sine(x); };
 
-    /**
-     * Scan the command line terminal for the most recent keyboard input value. 
-     * Store that value (which is coerced to be of type int upon storage) in the variable named option.
-     */
-    std::cin >> option;
-
-    // Print "The value which was entered for option is {option}." to the command line terminal.
-    std::cout << "\nThe value which was entered for option is " << option << ".";
+    // interval_function_3: y = f(x) = cos(x)
+    IntervalFunction interval_function_3 = [](const Interval & x) { return cosine(x); };
 
-    // Print "The value which was entered for option is {option}." to the file output stream.
-    file << "\n\nThe value which was entered for option is " << option << ".";
-
-    /**
-     * If option is smaller than 0 or if option is larger than 5, set option to 0
-     * and print a message stating that fact to the command line terminal and to the output file stream.
-     */
-    if ((option < 0) || (option > 5))
-    {
-        option = 0;
-        std::cout << "\n\noption was set to 0 by default due to the fact that the value input by the user was not recognized.";
-        file << "\n\noption was set to 0 by default due to the fact that the value input by the user was not recognized.";
-    }
+    // interval_function_4: y = f(x) = sqrt(x)
+    IntervalFunction interval_function_4 = [](const Interval & x) { return sqrt(x); };
 
-    /**
-     * Print a message about which function was selected by the user to the command line terminal and to the file output stream 
-     * and return that selected function's corresponding Function type object.
-     */
-    if (option == 0) 
-    {
-        std::cout << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = x^2.";
-        file << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = x^2.";
-        return functions_array[0];
-    }
-    if (option == 1) 
-    {
-        std::cout << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = x^3.";
-        file << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = x^3.";
-        return functions_array[1];
-    }
-    if (option == 2) 
-    {
-        std::cout << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = sin(x).";
-        file << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = sin(x).";
-        return functions_array[2];
-    }
-    if (option == 3) 
-    {
-        std::cout << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = cos(x).";
-        file << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = cos(x).";
-        return functions_array[3];
-    }
-    if (option == 4) 
-    {
-        std::cout << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = sqrt(x).";
-        file << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = sqrt(x).";
-        return functions_array[4];
-    }
-    if (option == 5) 
-    {
-        std::cout << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = 2x + 3.";
-        file << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = 2x + 3.";
-        return functions_array[5];
-    }
+    // interval_function_5: y = f(x) = (2 * x) + 3
+    IntervalFunction interval_function_5 = [](const Interval & x) { return Interval(2.0) * x + Interval(3.0); };
 
-    // This statement should never be executed.
-    return functions_array[0];
-}
-
-/**
- * The following code struct definition was slightly modified after being copied from the C++ source code file 
- * featured on the following tutorial web page:
- * 
- * https://karbytesforlifeblog.wordpress.com/reimann_sum/
- *-------------------------------------------------------------------------------------------------------------------
- * This function prompts the user to input three numerical values related to partitioning the x-axis of a Cartesian grid
- * for the purpose of using each those partitions to instantiate a rectangle whose width is the partition length
- * and whose height is where that rectangle's top left corner intersects with the graph of some single-variable function y = f(x).
- * 
- * a represents the left-most point of the aforementioned x-axis partition.
- * 
- * b represents the right-most point of the aforementioned x-axis partition.
- * 
- * n represents the number of equally-sized partitions to divide the x-axis partition, [a,b], into.
- * 
- * If an invalid input to this function is detected, then this function will return a Parameters instance with default values as follows:
- * 
- * { a : 0.0, b : 1.0, n : 10 }.
- */
-Parameters selectPartitioningValues(std::ofstream & file)
-{
-    // Define two double-type variables for storing values which represent the end points of an x-axis interval.
-    double a = 0.0, b = 0.0;
-
-    // Define one int-type variable for storing the number of equally sized partitions to divide the aforementioned x-axis interval into.
-    int n = 1000;
-
-    // Define a read-only default Parameters value to use as a reference to replace invalid user-input values with correct values.
-    const Parameters default_params = { 0.0, 1.0, n };
-
-    /*****************************/
-    /* Get User Input: a         */
-    /*****************************/
-
-    // Print a message to the command line terminal which prompts the user to input a value to store in the variable named a.
-    std::cout << "\n\nEnter a value to store in double-type variable a (which represents the left end of the x-axis interval): ";
-
-    // Print a message to the output file stream which prompts the user to input a value to store in the variable named a.
-    file << "\n\nEnter a value to store in double-type variable a (which represents the left end of the x-axis interval): ";
-
-    /**
-     * Scan the command line terminal for the most recent keyboard input value. 
-     * Store that value in the variable named a.
-     */
-    std::cin >> a;
-
-    // Print "The value which was entered for a is {a}." to the command line terminal.
-    std::cout << "\nThe value which was entered for a is " << a << ".";
-
-    // Print "The value which was entered for a is {a}." to the file output stream.
-    file << "\n\nThe value which was entered for a is " << a << ".";
-
-    /**
-     * Print an error message to the command line terminal and to the output file stream if
-     * a is smaller than MINIMUM_a or if
-     * a is larger than MAXIMUM_a
-     * and return a default Parameters instance.
-     */
-    if ((a < MINIMUM_a) || (a > MAXIMUM_a))
-    {
-        std::cout << "\n\nInvalid interval end-point. a is required to be within range [" << MINIMUM_a << "," << MAXIMUM_a << "].";
-        std::cout << "\n\nHence, default program values are being used to replace user inputs for the Reimann Sum partitioning parameters.";
-        file << "\n\nInvalid interval end-point. a is required to be within range [" << MINIMUM_a << "," << MAXIMUM_a << "].";
-        file << "\n\nHence, default program values are being used to replace user inputs for the Reimann Sum partitioning parameters.";
-        return default_params;
-    }
-
-    /*****************************/
-    /* Get User Input: b         */
-    /*****************************/
-
-    // Print a message to the command line terminal which prompts the user to input a value to store in the variable named b.
-    std::cout << "\n\nEnter a value to store in double-type variable b (which represents the right end of the x-axis interval): ";
-
-    // Print a message to the output file stream which prompts the user to input a value to store in the variable named b.
-    file << "\n\nEnter a value to store in double-type variable b (which represents the right end of the x-axis interval): ";
-
-    /**
-     * Scan the command line terminal for the most recent keyboard input value. 
-     * Store that value in the variable named a.
-     */
-    std::cin >> b;
-
-    // Print "The value which was entered for b is {b}." to the command line terminal.
-    std::cout << "\nThe value which was entered for b is " << b << ".";
-
-    // Print "The value which was entered for b is {b}." to the file output stream.
-    file << "\n\nThe value which was entered for b is " << b << ".";
-
-    /**
-     * Print an error message to the command line terminal and to the output file stream if
-     * b is smaller than or equal to a or if
-     * a is larger than MAXIMUM_a
-     * and return a default Parameters instance.
-     */
-    if ((b <= a) || (b > MAXIMUM_a))
-    {
-        std::cout << "\n\nInvalid interval end-point. b is required to be within range (" << a << "," << MAXIMUM_a << "].";
-        std::cout << "\n\nHence, default program values are being used to replace user inputs for the Reimann Sum partitioning parameters.";
-        file << "\n\nInvalid interval end-point. b is required to be within range (" << a << "," << MAXIMUM_a << "].";
-        file << "\n\nHence, default program values are being used to replace user inputs for the Reimann Sum partitioning parameters.";
-        return default_params;
-    }
-
-    /*****************************/
-    /* Get User Input: n         */
-    /*****************************/
-
-    // Print a message to the command line terminal which prompts the user to input a value to store in the variable named n.
-    // std::cout << "\n\nEnter a value to store in int-type variable n (which represents the number of equally-sized partitions to divide x-axis interval [a,b] into): ";
-
-    // Print a message to the output file stream which prompts the user to input a value to store in the variable named n.
-    // file << "\n\nEnter a value to store in int-type variable n (which represents the number of equally-sized partitions to divide x-axis interval [a,b] into): ";
-
-    /**
-     * Scan the command line terminal for the most recent keyboard input value. 
-     * Store that value in the variable named a.
-     */
-    // std::cin >> n;
-
-    // Print "The value which was entered for n is {n}." to the command line terminal.
-    // std::cout << "\nThe value which was entered for n is " << n << ".";
-
-    // Print "The value which was entered for n is {n}." to the file output stream.
-    // file << "\n\nThe value which was entered for n is " << n << ".";
-
-    /**
-     * Print an error message to the command line terminal and to the output file stream if
-     * n is smaller than one or if
-     * n is larger than MAXIMUM_a
-     * and return a default Parameters instance.
-     */
-    // if ((n < 1) || (n > MAXIMUM_a))
-    // {
-    //    std::cout << "\n\nInvalid partition number. n is required to be a natural number within range [1," << MAXIMUM_a << "].";
-    //    std::cout << "\n\nHence, default program values are being used to replace user inputs for the Reimann Sum partitioning parameters.";
-    //    file << "\n\nInvalid partition number. n is required to be a natural number within range [1," << MAXIMUM_a << "].";
-    //    file << "\n\nHence, default program values are being used to replace user inputs for the Reimann Sum partitioning parameters.";
-    //    return default_params;
-    // }
-
-    /**
-     * Print a message about which x-axis interval and partition number were selected 
-     * by the user to the command line terminal and to the file output stream.
-     */
-    // std::cout << "\n\nThe x-axis interval which was selected to partition is [" << a << "," << b << "].";
-    // std::cout << "\n\nThe selected number of equally-sized partitions to divide that interval into is " << n << ".";
-    // file << "\n\nThe x-axis interval which was selected to partition is [" << a << "," << b << "].";
-    // file << "\n\nThe selected number of equally-sized partitions to divide that interval into is " << n << ".";
-
-    // Return a struct whose data type is Parameters and whose data attributes are the values which the user entered during a runtime instance of this function.
-    return {a, b, n};
-}
-
-/**
- * This function prompts the user to select a value inside of the x-axis interval, [a,b].
- * 
- * If the entered value is not within those bounds, then set that value to b.
- */
-double selectIntervalPoint(Parameters params, std::ofstream & file)
-{
-    // Declare one double type variable named x for storing floating-point number values.
-    double x = 0.0;
-
-    // Print a message to the command line terminal which prompts the user to input a value to store in the variable named x.
-    std::cout << "\n\nEnter a value to store in double-type variable x (which represents a point inside of the selected x-axis interval): ";
-
-    // Print a message to the output file stream which prompts the user to input a value to store in the variable named x.
-    file << "\n\nEnter a value to store in double-type variable x (which represents a point inside of the selected x-axis interval): ";
-
-    /**
-     * Scan the command line terminal for the most recent keyboard input value. 
-     * Store that value in the variable named x.
-     */
-    std::cin >> x;
-
-    // Print "The value which was entered for x is {x}." to the command line terminal.
-    std::cout << "\nThe value which was entered for x is " << x << ".";
-
-    // Print "The value which was entered for x is {x}." to the file output stream.
-    file << "\n\nThe value which was entered for x is " << x << ".";
-
-    /**
-     * If x is smaller than a or larger than b, set x to b 
-     * and print a resulting message to the command line terminal and file output stream.
-     */
-    if ((x < params.a) || (x > params.b))
-    {
-        x = params.b;
-        std::cout << "\n\nThe value entered for x was either smaller than " << params.a << " or else larger than " << params.b << ".";
-        std::cout << "\n\nHence, x has been reset to " << params.b << ".";
-    }
-
-    // Return the validated value of x.
-    return x;
+    // Return the static array of the aforementioned six IntervalFunction type objects.
+    return {interval_function_0, interval_function_1, interval_function_2, interval_function_3, interval_function_4, interval_function_5};
 }
 
 /**
@@ -607,161 +150,128 @@ Function derivative(Function f, double h)
 }
 
 /**
- * The following code struct definition was slightly modified after being copied from the C++ source code file 
- * featured on the following tutorial web page:
- * 
- * https://karbytesforlifeblog.wordpress.com/reimann_sum/
- *-------------------------------------------------------------------------------------------------------------------
- * This function computes the Reimann sum for some arbitrary interval of the x-axis, 
- * some arbitrary number of equally sized partitions of the x-axis, 
- * some arbitrary single variable function (whose dependent variable is x), 
- * and the option to generate rectangles whose left sides either align with 
- * the left end point, 
- * right end point, 
- * or middle point of that rectangle's respective x-axis partition.
+ * Return true if f does not look smooth at the end-point e of an integral (i.e. if f is infinite or "not a number" near e, or if its derivative
+ * is unbounded at e, as the derivative of sqrt(x) is at x = 0).
+ *
+ * The probe integrates f over the short interval [e, e + direction * DEFAULT_GAUSS_LEGENDRE_PANEL_WIDTH / 64] with the 4-point and with the
+ * 8-point Gauss-Legendre rule (12 evaluations of f, none of them at e). Those two estimates agree to about machine precision if f is smooth
+ * near e (the 4-point rule is exact for every polynomial of degree 7 or less), but they disagree in about their fourth digit if f behaves like
+ * sqrt(x - e) there.
  */
-double computeRiemannSum(Function func, double a, double b, int n, const std::string& method) 
+static bool isSingularAtEndPoint(const Function & f, double e, double direction)
 {
-    // Initialize sum, dx, and x to each store the value zero.
-    double sum = 0.0, dx = 0.0, x = 0.0;
-
-    /**
-     * Print an error message to the console window (and output file) if
-     * a is smaller than MINIMUM_a or if
-     * a is larger than MAXIMUM_a
-     * and exit the function by returning zero.
-     */
-    if ((a < MINIMUM_a) || (a > MAXIMUM_a))
-    {
-        // std::cout << "\n\nInvalid interval end-point. a is required to be within range [" << MINIMUM_a << "," << MAXIMUM_a << "].";
-        // file << "\n\nInvalid interval end-point. a is required to be within range [" << MINIMUM_a << "," << MAXIMUM_a << "].";
-        return 0.0;
-    }
-
-    /**
-     * Print an error message to the console window (and output file) if
-     * b is smaller than or equal to a or if
-     * b is larger than MAXIMUM_b
-     * and exit the function by returning zero.
-     */
-    if ((b <= a) || (b > MAXIMUM_b))
-    {
-        // std::cout << "\n\nInvalid interval. b is required to represent a value which is larger than a and no larger than " << MAXIMUM_b << ".";
-        // file << "\n\nInvalid interval. b is required to represent a value which is larger than a and no larger than " << MAXIMUM_b << ".";
-        return 0.0;
-    }
-
-    /**
-     * Print an error message to the console window (and output file) if
-     * n is smaller than one (or larger than MAXIMUM_a)
-     * and exit the function by returning zero.
-     */
-    if ((n < 1) || (n > MAXIMUM_n))
-    {
-        // std::cout << "Invalid partition number. n is required to represent a natural number no larger than " << MAXIMUM_n << ".";
-        // file << "Invalid partition number. n is required to represent a natural number no larger than " << MAXIMUM_n << ".";
-        return 0.0;
-    }
+    const double end = e + direction * (DEFAULT_GAUSS_LEGENDRE_PANEL_WIDTH / 64.0);
+    const double coarse = integrateGaussLegendre(f, e, end, gaussLegendreRule(4));
+    const double fine = integrateGaussLegendre(f, e, end, gaussLegendreRule(8));
+    if (!std::isfinite(coarse) || !std::isfinite(fine)) return true;
+    return std::fabs(fine - coarse) > (ENDPOINT_SINGULARITY_TOLERANCE * std::fabs(fine));
+}
 
-    // Set dx to represent the length of each one of the n equally-sized partitions of the x-axis interval [a,b].
-    dx = (b - a) / n;
+/**
+ * The following function computes the (approximate) definite integral of a single variable function, y = f(x),
+ * on the x-axis interval whose lower boundary is x = a and whose upper boundary is x = b.
+ * 
+ * The integral of y = f(x) on the x-axis interval [a,b] is the area of the region bounded by
+ * y = f(x), x = a, x = b, and y = 0.
+ *
+ * The returned Function uses Gauss-Legendre quadrature with one 20-point panel per DEFAULT_GAUSS_LEGENDRE_PANEL_WIDTH
+ * (i.e. 16) units of x-axis (instead of a 1000-sample midpoint Reimann Sum), so an interval no wider than 16 costs 20
+ * evaluations of f and the widest interval of the program, [-100,100], costs 260 (i.e. about 4 times fewer than the Reimann Sum).
+ * That is exact for polynomials of degree 39 or less and accurate to about machine precision for smooth functions such as sin(x) and cos(x).
+ *
+ * If f is not smooth at a or at b (e.g. sqrt(x) at x = 0, whose derivative is unbounded there), the panel which touches that end-point
+ * is integrated by tanh-sinh quadrature instead (which never evaluates f at the end-point and reaches about 1e-13 in about 65 evaluations
+ * for sqrt(x) on [0,16], whereas one Gauss-Legendre panel is off by about 1e-5 there). Each end-point is probed once (see isSingularAtEndPoint).
+ *
+ * The Gauss-Legendre rule is obtained once (so that each panel does not lock the table of gaussLegendreRule). The panels are aligned to a grid
+ * which starts at x = a (i.e. [a, a + 16], [a + 16, a + 32], ... followed by one partial panel which ends at x), and every call of the returned
+ * Function shares one EvaluationCache of up to cache_capacity values of f. Hence repeated queries (e.g. integ(x) after integ(b), or the two
+ * nearby queries of derivative(integ)) skip the evaluations of f which earlier queries already made.
+ *
+ * The cache is disabled by default (cache_capacity = DEFAULT_INTEGRAL_CACHE_CAPACITY = 0), because a cache of 65536 values occupies about 2 MB
+ * and adds a locked hash table lookup to every evaluation, which costs more than evaluating a cheap f such as x * x or sin(x). Pass a capacity
+ * (e.g. DEFAULT_EVALUATION_CACHE_CAPACITY) only if each evaluation of f is expensive (e.g. if f solves an equation or runs a simulation).
+ */
+Function integral(Function f, double a, double b, std::size_t cache_capacity)
+{
+    // Place an evaluation cache between the integral and f (unless the cache is disabled).
+    Function cached_f = (cache_capacity > 0) ? memoize(f, cache_capacity) : f;
 
-    // Print the value of dx and the above equation to the command line terminal and to the output file stream.
-    // std::cout << "\n\ndx = (b - a) / n = (" << b << " - " << a << ") / " << n << " = " << dx << ". // the length of each of the n equally-sized partitions of x-axis interval, [a,b]";
-    // file << "\n\ndx = (b - a) / n = (" << b << " - " << a << ") / " << n << " = " << dx << ". // the length of each of the n equally-sized partitions of x-axis interval, [a,b]";
-   
-    // Print a horizontal divider line to the command line terminal and to the file output stream.
-    // std::cout << "\n\n~~~~~~~~~~~~~~";
-    // file << "\n\n~~~~~~~~~~~~~~";
+    // Obtain the Gauss-Legendre rule once and probe each end-point of [a,b] once.
+    const GaussLegendreNodes * rule = &gaussLegendreRule(DEFAULT_GAUSS_LEGENDRE_ORDER);
+    const bool singular_at_a = isSingularAtEndPoint(cached_f, a, (b >= a) ? 1.0 : -1.0);
+    const bool singular_at_b = isSingularAtEndPoint(cached_f, b, (b >= a) ? -1.0 : 1.0);
 
-    /**
-     * For each one of the n equally-sized partitions of the x-axis,
-     * compute the approximate area of the region bounded by y = f(x) = func,
-     * the x-axis, and the vertical lines which intersect with the endpoints (or mid points)
-     * of the respective x-axis partition.
-     *
-     * Then add that area (which is the area of some rectangle) to sum.
-     */
-    for (int i = 0; i < n; ++i) 
+    // Return a lambda function which calculates the integral of f using Gauss-Legendre quadrature (and tanh-sinh quadrature next to a singular end-point).
+    return [cached_f, a, b, rule, singular_at_a, singular_at_b](double x) -> double
     {
-        // Print the value of i to the command line terminal and to the output file stream.
-        // std::cout << "\n\ni = " << i << ". // current iteration of the for loop (of " << n << " iterations)";
-        // file << "\n\ni = " << i << ". // current iteration of the for loop (of " << n << " iterations)";
-
-        if (method == "left") 
-        {
-            // Determine the left end-point of the ith partition of [a,b].
-            x = a + i * dx;
+        const double direction = (x >= a) ? 1.0 : -1.0;
+        const double width = direction * (x - a);
+        const double full_panels = std::floor(width / DEFAULT_GAUSS_LEGENDRE_PANEL_WIDTH);
+        if (full_panels >= MAXIMUM_GAUSS_LEGENDRE_PANELS) return integrateGaussLegendre(cached_f, a, x, *rule, MAXIMUM_GAUSS_LEGENDRE_PANELS);
 
-            // Print the value of x and the above equation to the command line terminal and to the output file stream.
-            // std::cout << "\n\nx = a + i * dx = " << a << " + " << i << " * " << dx << " = " << x << ". // the left end-point of the ith partition of [a,b].";
-            // file << "\n\nx = a + i * dx = " << a << " + " << i << " * " << dx << " = " << x << ". // the left end-point of the ith partition of [a,b].";
-        } 
-        else if (method == "right") 
+        // Integrate one panel (by tanh-sinh quadrature if the panel starts at a singular a or ends within one panel width of a singular b).
+        auto integratePanel = [&](double start, double end) -> double
         {
-            // Determine the right end-point of the ith partition of [a,b].
-            x = a + (i + 1) * dx;
+            bool singular = (singular_at_a && (start == a)) || (singular_at_b && (std::fabs(b - end) < DEFAULT_GAUSS_LEGENDRE_PANEL_WIDTH));
+            return singular ? integrateTanhSinh(cached_f, start, end).estimate : integrateGaussLegendre(cached_f, start, end, *rule);
+        };
 
-            // Print the value of x and the above equation to the command line terminal and to the output file stream.
-            // std::cout << "\n\nx = a + (i + 1) * dx = " << a << " + (" << i << " + 1) * " << dx << " = " << x << ". // the right end-point of the ith partition of [a,b].";
-            // file << "\n\nx = a + (i + 1) * dx = " << a << " + (" << i << " + 1) * " << dx << " = " << x << ". // the right end-point of the ith partition of [a,b].";
-        } 
-        else if (method == "midpoint") 
+        // Sum the whole panels of the grid, then the partial panel which ends at x.
+        double result = 0.0;
+        for (int panel = 0; panel < static_cast<int>(full_panels); panel += 1)
         {
-            // Determine the middle point of the ith partition of [a,b].
-            x = a + (i + 0.5) * dx;
-
-            // Print the value of x and the above equation to the command line terminal and to the output file stream.
-            // std::cout << "\n\nx = a + (i + 0.5) * dx = " << a << " + (" << i << " + 0.5) * " << dx << " = " << x << ". // the middle point of the ith partition of [a,b].";
-            // file << "\n\nx = a + (i + 0.5) * dx = " << a << " + (" << i << " + 0.5) * " << dx << " = " << x << ". // the middle point of the ith partition of [a,b].";
-        }
-
-        /**
-         * Print an error message to the console window if 
-         * method is not either 'left', 'right', or 'midpoint'
-         * and exit the function by returning the value 0.0.
-         */
-        else 
-        {
-            std::cout << "\n\nInvalid method. Use 'left', 'right', or 'midpoint'.";
-            return 0.0;
+            double panel_start = a + direction * panel * DEFAULT_GAUSS_LEGENDRE_PANEL_WIDTH;
+            result += integratePanel(panel_start, panel_start + direction * DEFAULT_GAUSS_LEGENDRE_PANEL_WIDTH);
         }
+        double partial_start = a + direction * full_panels * DEFAULT_GAUSS_LEGENDRE_PANEL_WIDTH;
+        if (partial_start != x) result += integratePanel(partial_start, x);
+        return result;
+    };
+}
 
-        // Add the area of the current rectangle to the running total sum.
-        sum += func(x) * dx; 
-
-        // Print the right-hand value of the above equation to the command line terminal and to the output file stream.
-        // std::cout << "\n\nrectangle_area_x = func(x) * dx = " << func(x) << " * " << dx << " = " << (func(x) * dx) << ". // area of the ith rectangle";
-        // file << "\n\nrectangle_area_x = func(x) * dx = " << func(x) << " * " << dx << " = " << (func(x) * dx) << ". // area of the ith rectangle";
-
-        // Print the running total obtained by adding the area of the ith rectangle to the value stored in the variable named sum to the command line terminal and to the output file stream.
-        // std::cout << "\n\nsum += rectangle_x; // Add rectangle_x to sum and store the result in sum (in the C++ program).";
-        // std::cout << "\n\nsum = " << sum << ". // the current value stored in the variable named sum";
-        // file << "\n\nsum += rectangle_x; // Add rectangle_x to sum and store the result in sum (in the C++ program).";
-        // file << "\n\nsum = " << sum << ". // the current value stored in the variable named sum";
-
-        // Print a horizontal divider line to the command line terminal and to the file output stream.
-        // std::cout << "\n\n~~~~~~~~~~~~~~";
-        // file << "\n\n~~~~~~~~~~~~~~";
-    }
-
-    // Return the Reimann sum obtained by adding each of the n rectangle areas.
-    return sum;
+/**
+ * This function returns a Function type object which represents the derivative of f, the function which was fitted by expansion
+ * (on the x-axis interval [expansion.lowerBound(), expansion.upperBound()]).
+ *
+ * The derivative expansion is computed once (from the Chebyshev coefficients, without calling f again), so each call of the
+ * returned Function at an x inside of [expansion.lowerBound(), expansion.upperBound()] costs O(degree) operations and has no step size h
+ * (hence no cancellation error).
+ *
+ * The expansion is not accurate outside of the interval on which it was fitted (its extrapolation grows like x to the power of its degree),
+ * so the returned Function calculates the derivative of f at an x outside of that interval by the central difference of derivative(f) instead.
+ */
+Function derivative(const ChebyshevExpansion & expansion, Function f)
+{
+    // Return a lambda function which evaluates the derivative of the Chebyshev expansion (or the central difference of f outside of the fitted interval).
+    ChebyshevExpansion expansion_prime = expansion.derivative();
+    Function f_prime = derivative(f);
+    return [expansion_prime, f_prime](double x) -> double
+    {
+        if ((x < expansion_prime.lowerBound()) || (x > expansion_prime.upperBound())) return f_prime(x);
+        return expansion_prime(x);
+    };
 }
 
 /**
- * The following function computes the (approximate) definite integral of a single variable function, y = f(x),
- * on the x-axis interval whose lower boundary is x = a and whose upper boundary is x = b.
- * 
- * The integral of y = f(x) on the x-axis interval [a,b] is the area of the region bounded by
- * y = f(x), x = a, x = b, and y = 0.
+ * This function returns a Function type object which represents the definite integral of f, the function which was fitted by expansion,
+ * on the x-axis interval [a,x] (where a is expansion.lowerBound()).
+ *
+ * The integral expansion is computed once (from the Chebyshev coefficients, without calling f again), so each call of the
+ * returned Function at an x inside of [expansion.lowerBound(), expansion.upperBound()] costs O(degree) operations (instead of one quadrature of f per call).
+ *
+ * The expansion is not accurate outside of the interval on which it was fitted (e.g. the integral of sin(x) fitted on [-100,100] is extrapolated
+ * to about -3e+50 at x = 120), so the returned Function calculates the integral of f on [a,x] for an x outside of that interval by the
+ * quadrature of integral(f, a, b) instead.
  */
-Function integral(Function f, double a, double b)
+Function integral(const ChebyshevExpansion & expansion, Function f)
 {
-    // Return a lambda function which calculates the integral of f using the Reimann Sum.
-    return [f, a](double x) -> double
+    // Return a lambda function which evaluates the integral of the Chebyshev expansion (or the quadrature of f outside of the fitted interval).
+    ChebyshevExpansion antiderivative = expansion.integral();
+    Function quadrature = integral(f, expansion.lowerBound(), expansion.upperBound());
+    return [antiderivative, quadrature](double x) -> double
     {
-        double result = computeRiemannSum(f, a, x, 1000, "midpoint");
-        return result;
+        if ((x < antiderivative.lowerBound()) || (x > antiderivative.upperBound())) return quadrature(x);
+        return antiderivative(x);
     };
-}
\ No newline at end of file
+}
@@ -0,0 +1,28 @@
+/**
+ * file: fundamental_theorem_of_calculus.h
+ * type: C++ (header file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+#ifndef FUNDAMENTAL_THEOREM_OF_CALCULUS_H
+#define FUNDAMENTAL_THEOREM_OF_CALCULUS_H
+
+/** preprocessing directives */
+#include <array> // returning an array of Function type values
+#include <cstddef> // std::size_t
+#include "reimann_sum.h" // Function, Parameters, computeRiemannSum
+#include "chebyshev.h" // ChebyshevExpansion
+#include "interval.h" // Interval, IntervalFunction
+#define DEFAULT_INTEGRAL_CACHE_CAPACITY 0 // constant which represents the default number of values of f which one integral(f, a, b) Function remembers (none, i.e. the cache is only used if the caller asks for it)
+
+/** function prototypes */
+std::array<Function, 6> generate_array_of_functions();
+std::array<IntervalFunction, 6> generate_array_of_interval_functions();
+Function derivative(Function f, double h = 1e-5);
+Function integral(Function f, double a, double b, std::size_t cache_capacity = DEFAULT_INTEGRAL_CACHE_CAPACITY);
+Function derivative(const ChebyshevExpansion & expansion, Function f);
+Function integral(const ChebyshevExpansion & expansion, Function f);
+
+#endif // FUNDAMENTAL_THEOREM_OF_CALCULUS_H
@@ -0,0 +1,435 @@
+/**
+ * file: fundamental_theorem_of_calculus_main.cpp
+ * type: C++ (source file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+/** preprocessing directives */
+#include <iostream> // standard input (std::cin), standard output (std::cout)
+#include "fundamental_theorem_of_calculus.h" // Function, Parameters, ChebyshevExpansion, generate_array_of_functions, derivative, integral
+#include "tee_output.h" // TeeOutput
+#define MINIMUM_a -100 // constant which represents the minimum a value
+#define MAXIMUM_a 100 // constant which represents the maximum a value
+#define MINIMUM_b -100 // constant which represents the minimum b value
+#define MAXIMUM_b 100 // constant which represents the maximum b value
+#define MINIMUM_n 1 // constant which represents the minimum n value
+#define MAXIMUM_PROBE_CHEBYSHEV_DEGREE 1024 // constant which represents the largest degree of the Chebyshev fit which the program tries before it falls back to quadrature
+
+/** function prototypes */
+Parameters selectPartitioningValues(TeeOutput & output);
+Function selectFunctionFromListOfFunctions(TeeOutput & output);
+double selectIntervalPoint(Parameters params, TeeOutput & output);
+
+/** program entry point */
+int main()
+{
+    /**
+     * If the file named fundamental_theorem_of_calculus_output.txt does not already exist 
+     * inside of the same file directory as the program, 
+     * create a new file named fundamental_theorem_of_calculus_output.txt in that directory.
+     * 
+     * Open the plain-text file named fundamental_theorem_of_calculus_output.txt
+     * and set that file to be overwritten with program data.
+     * 
+     * Every value which is printed through output is formatted only once (as the shortest decimal number which converts back 
+     * to exactly the same double) and is then copied to the command line terminal and to the (buffered) file output stream.
+     */
+    TeeOutput output("fundamental_theorem_of_calculus_output.txt");
+
+    // Print an opening message to the command line terminal.
+    output.console << "\n\n--------------------------------";
+    output.console << "\nStart Of Program";
+    output.console << "\n--------------------------------";
+
+    // Print an opening message to the file output stream.
+    output.file << "--------------------------------";
+    output.file << "\nStart Of Program";
+    output.file << "\n--------------------------------";
+
+    // Print "This C++ program demonstrates the Fundamental Theorem of Calculus." to the command line terminal and to the file output stream.
+    output << "\n\nThis C++ program demonstrates the Fundamental Theorem of Calculus.";
+
+    // Print a horizontal divider line to the command line terminal and to the file output stream.
+    output << "\n\n--------------------------------";
+
+    /**
+     * Prompt the user to select one of multiple single-variable functions from a list.
+     * Store the selected function in a Function type variable named func.
+     */
+    Function func = selectFunctionFromListOfFunctions(output);
+
+    // Print a horizontal divider line to the command line terminal and to the file output stream.
+    output << "\n\n--------------------------------";
+
+    /**
+     * Prompt the user to select end-point values for an interval of the x-axis, [a,b], 
+     * Store the selected x-axis interval end-point values in a Parameters type variable named params.
+     */
+    Parameters params = selectPartitioningValues(output);
+
+    // Print a horizontal divider line to the command line terminal and to the file output stream.
+    output << "\n\n--------------------------------";
+
+    /**
+     * Prompt the user to select an value inside of the x-axis interval, [a,b].
+     * Store the selected x-value in a double type variable named x.
+     */
+    double x = selectIntervalPoint(params, output);
+
+    // Print a horizontal divider line to the command line terminal and to the file output stream.
+    output << "\n\n--------------------------------";
+
+    // Obtain the value of f(x).
+    double func_of_x = func(x);
+
+    /**
+     * Fit a Chebyshev expansion to f on [a,b] once. If the fit converged (i.e. if f is smooth on [a,b]), the derivative and the
+     * integral of f are computed from that expansion (so f is not sampled again for each query point); otherwise (e.g. for
+     * f(x) = sqrt(x) on an interval which contains x = 0) the central difference and Gauss-Legendre quadrature are used.
+     * A query outside of [a,b] (e.g. derivative(integ, x) below, which evaluates integ at 2 * x) is also answered by the central difference
+     * and by Gauss-Legendre quadrature, because the expansion is only accurate on [a,b].
+     *
+     * The degree of that fit is capped at MAXIMUM_PROBE_CHEBYSHEV_DEGREE (which is more than enough for every smooth function of the
+     * list on [-100,100], e.g. sin(x) converges at degree 256 there), so a function which does not converge costs at most 1025 evaluations
+     * of f (instead of the 65537 evaluations and the FFTs of length 131072 of MAXIMUM_CHEBYSHEV_DEGREE) before the fallback is used.
+     */
+    ChebyshevExpansion expansion(func, params.a, params.b, MAXIMUM_PROBE_CHEBYSHEV_DEGREE);
+
+    // Obtain the derivative of the selected function, f'.
+    Function func_prime = expansion.isConverged() ? derivative(expansion, func) : derivative(func);
+
+    // Obtain the value of f'(x).
+    double func_prime_of_x = func_prime(x);
+
+    // Print the value of f(x) to the command line terminal and to the file output stream.
+    output << "\n\nf(x) = f(" << x << ") ≈ " << func_of_x << ".";
+
+    // Print the value of f'(x) to the command line terminal and to the file output stream.
+    output << "\n\nf'(x) = f'(" << x << ") ≈ " << func_prime_of_x << ". // derivative";
+
+    // Print a horizontal divider line to the command line terminal and to the file output stream.
+    output << "\n\n--------------------------------";
+
+    // Obtain the value of the definite integral of y = f(t) on the x-axis interval [a,b].
+    Function integ = expansion.isConverged() ? integral(expansion, func) : integral(func, params.a, params.b);
+
+    // Print the degree of the Chebyshev expansion (if it was used) to the command line terminal and to the file output stream.
+    if (expansion.isConverged()) output << "\n\nf was fitted on [a,b] by a Chebyshev expansion of degree " << expansion.degree() << " (using " << expansion.evaluations() << " evaluations of f).";
+
+    // Obtain the value of the definite integral of y = f(t) on the x-axis interval [a,b].
+    double whole_interval_area = integ(params.b);
+
+    // Obtain the value of the definite integral of y = f(t) on the x-axis interval [a,x].
+    double selected_interval_area = integ(x);
+
+    // Print the value of the definite integral (of y = f(t) on the x-axis interval [a,b]) to the command line terminal and to the output file stream.
+    output << "\n\nwhole_interval_area ≈ " << whole_interval_area << " // value of the definite integral of y = f(t) on the x-axis interval [a,b]";
+
+    // Print the value of the definite integral (of y = f(t) on the x-axis interval [x,b]) to the command line terminal and to the output file stream.
+    output << "\n\nS f(x) dt (where dt is the interval [a,b]) = selected_interval_area = " << selected_interval_area << " // value of the definite integral of y = f(t) on the x-axis interval [a,x]";
+
+    // Print a horizontal divider line to the command line terminal and to the file output stream.
+    output << "\n\n--------------------------------";
+
+    // Obtain the value which represents f(x) = d/dx ( S integ(t) dt ) = ( S integ(t) dt )'.
+    Function original_function = derivative(integ, x);
+
+    // Print the derivative of the integral at x to the command line terminal and to the output file stream.
+    output << "\n\noriginal_function ≈ derivative(integ, x) --> original_function(x) ≈ " << "original_function(" << x << ") = " << original_function(x) << "  // f(x) = d/dx ( S integ(t) dt ) = ( S integ(t) dt )'";
+
+    // Print a closing message to the command line terminal.
+    output.console << "\n\n--------------------------------";
+    output.console << "\nEnd Of Program";
+    output.console << "\n--------------------------------\n\n";
+
+    // Print a closing message to the file output stream.
+    output.file << "\n\n--------------------------------";
+    output.file << "\nEnd Of Program";
+    output.file << "\n--------------------------------";
+
+    // Write the remaining buffered program data to the file output stream and close that file.
+    output.close();
+
+    // Exit the program.
+    return 0; 
+}
+
+/**
+ * The following code struct definition was slightly modified after being copied from the C++ source code file 
+ * featured on the following tutorial web page:
+ * 
+ * https://karbytesforlifeblog.wordpress.com/reimann_sum/
+ *-------------------------------------------------------------------------------------------------------------------
+ * This function displays a list of single-variable algebraic functions
+ * on the command line terminal and in the output file stream and
+ * prompts the program user to input an option number which corresponds
+ * with exactly one of the aforementioned functions. 
+ * 
+ * After the user enters some value, the corresponding Function type
+ * object is returned.
+ */
+Function selectFunctionFromListOfFunctions(TeeOutput & output)
+{
+    // Define an array of six Function type objects (which corresponds with the menu interface below).
+    std::array<Function, 6> functions_array = generate_array_of_functions();
+
+    // Initialize option to represent 0 (which is the associated with the first function in the array above).
+    int option = 0;
+
+    // Print menu options and the instruction to input an option number to the command line terminal and to the file output stream.
+    output << "\n\nEnter the number which corresponds with one of the following functions:";
+    output << "\n\n0 --> f(x) = x^2";
+    output << "\n\n1 --> f(x) = x^3";
+    output << "\n\n2 --> f(x) = sin(x)";
+    output << "\n\n3 --> f(x) = cos(x)";
+    output << "\n\n4 --> f(x) = sqrt(x)";
+    output << "\n\n5 --> f(x) = 2x + 3";
+    output << "\n\nEnter Option Here: ";
+
+    /**
+     * Scan the command line terminal for the most recent keyboard input value. 
+     * Store that value (which is coerced to be of type int upon storage) in the variable named option.
+     */
+    std::cin >> option;
+
+    // Print "The value which was entered for option is {option}." to the command line terminal.
+    output.console << "\nThe value which was entered for option is " << option << ".";
+
+    // Print "The value which was entered for option is {option}." to the file output stream.
+    output.file << "\n\nThe value which was entered for option is " << option << ".";
+
+    /**
+     * If option is smaller than 0 or if option is larger than 5, set option to 0
+     * and print a message stating that fact to the command line terminal and to the output file stream.
+     */
+    if ((option < 0) || (option > 5))
+    {
+        option = 0;
+        output << "\n\noption was set to 0 by default due to the fact that the value input by the user was not recognized.";
+    }
+
+    /**
+     * Print a message about which function was selected by the user to the command line terminal and to the file output stream 
+     * and return that selected function's corresponding Function type object.
+     */
+    if (option == 0) 
+    {
+        output << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = x^2.";
+        return functions_array[0];
+    }
+    if (option == 1) 
+    {
+        output << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = x^3.";
+        return functions_array[1];
+    }
+    if (option == 2) 
+    {
+        output << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = sin(x).";
+        return functions_array[2];
+    }
+    if (option == 3) 
+    {
+        output << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = cos(x).";
+        return functions_array[3];
+    }
+    if (option == 4) 
+    {
+        output << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = sqrt(x).";
+        return functions_array[4];
+    }
+    if (option == 5) 
+    {
+        output << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = 2x + 3.";
+        return functions_array[5];
+    }
+
+    // This statement should never be executed.
+    return functions_array[0];
+}
+
+/**
+ * The following code struct definition was slightly modified after being copied from the C++ source code file 
+ * featured on the following tutorial web page:
+ * 
+ * https://karbytesforlifeblog.wordpress.com/reimann_sum/
+ *-------------------------------------------------------------------------------------------------------------------
+ * This function prompts the user to input three numerical values related to partitioning the x-axis of a Cartesian grid
+ * for the purpose of using each those partitions to instantiate a rectangle whose width is the partition length
+ * and whose height is where that rectangle's top left corner intersects with the graph of some single-variable function y = f(x).
+ * 
+ * a represents the left-most point of the aforementioned x-axis partition.
+ * 
+ * b represents the right-most point of the aforementioned x-axis partition.
+ * 
+ * n represents the number of equally-sized partitions to divide the x-axis partition, [a,b], into.
+ * 
+ * If an invalid input to this function is detected, then this function will return a Parameters instance with default values as follows:
+ * 
+ * { a : 0.0, b : 1.0, n : 10 }.
+ */
+Parameters selectPartitioningValues(TeeOutput & output)
+{
+    // Define two double-type variables for storing values which represent the end points of an x-axis interval.
+    double a = 0.0, b = 0.0;
+
+    // Define one int-type variable for storing the number of equally sized partitions to divide the aforementioned x-axis interval into.
+    int n = 1000;
+
+    // Define a read-only default Parameters value to use as a reference to replace invalid user-input values with correct values.
+    const Parameters default_params = { 0.0, 1.0, n };
+
+    /*****************************/
+    /* Get User Input: a         */
+    /*****************************/
+
+    // Print a message to the command line terminal which prompts the user to input a value to store in the variable named a.
+    output << "\n\nEnter a value to store in double-type variable a (which represents the left end of the x-axis interval): ";
+
+    /**
+     * Scan the command line terminal for the most recent keyboard input value. 
+     * Store that value in the variable named a.
+     */
+    std::cin >> a;
+
+    // Print "The value which was entered for a is {a}." to the command line terminal.
+    output.console << "\nThe value which was entered for a is " << a << ".";
+
+    // Print "The value which was entered for a is {a}." to the file output stream.
+    output.file << "\n\nThe value which was entered for a is " << a << ".";
+
+    /**
+     * Print an error message to the command line terminal and to the output file stream if
+     * a is smaller than MINIMUM_a or if
+     * a is larger than MAXIMUM_a
+     * and return a default Parameters instance.
+     */
+    if ((a < MINIMUM_a) || (a > MAXIMUM_a))
+    {
+        output << "\n\nInvalid interval end-point. a is required to be within range [" << MINIMUM_a << "," << MAXIMUM_a << "].";
+        output << "\n\nHence, default program values are being used to replace user inputs for the Reimann Sum partitioning parameters.";
+        return default_params;
+    }
+
+    /*****************************/
+    /* Get User Input: b         */
+    /*****************************/
+
+    // Print a message to the command line terminal which prompts the user to input a value to store in the variable named b.
+    output << "\n\nEnter a value to store in double-type variable b (which represents the right end of the x-axis interval): ";
+
+    /**
+     * Scan the command line terminal for the most recent keyboard input value. 
+     * Store that value in the variable named a.
+     */
+    std::cin >> b;
+
+    // Print "The value which was entered for b is {b}." to the command line terminal.
+    output.console << "\nThe value which was entered for b is " << b << ".";
+
+    // Print "The value which was entered for b is {b}." to the file output stream.
+    output.file << "\n\nThe value which was entered for b is " << b << ".";
+
+    /**
+     * Print an error message to the command line terminal and to the output file stream if
+     * b is smaller than or equal to a or if
+     * a is larger than MAXIMUM_a
+     * and return a default Parameters instance.
+     */
+    if ((b <= a) || (b > MAXIMUM_a))
+    {
+        output << "\n\nInvalid interval end-point. b is required to be within range (" << a << "," << MAXIMUM_a << "].";
+        output << "\n\nHence, default program values are being used to replace user inputs for the Reimann Sum partitioning parameters.";
+        return default_params;
+    }
+
+    /*****************************/
+    /* Get User Input: n         */
+    /*****************************/
+
+    // Print a message to the command line terminal which prompts the user to input a value to store in the variable named n.
+    // std::cout << "\n\nEnter a value to store in int-type variable n (which represents the number of equally-sized partitions to divide x-axis interval [a,b] into): ";
+
+    // Print a message to the output file stream which prompts the user to input a value to store in the variable named n.
+    // file << "\n\nEnter a value to store in int-type variable n (which represents the number of equally-sized partitions to divide x-axis interval [a,b] into): ";
+
+    /**
+     * Scan the command line terminal for the most recent keyboard input value. 
+     * Store that value in the variable named a.
+     */
+    // std::cin >> n;
+
+    // Print "The value which was entered for n is {n}." to the command line terminal.
+    // std::cout << "\nThe value which was entered for n is " << n << ".";
+
+    // Print "The value which was entered for n is {n}." to the file output stream.
+    // file << "\n\nThe value which was entered for n is " << n << ".";
+
+    /**
+     * Print an error message to the command line terminal and to the output file stream if
+     * n is smaller than one or if
+     * n is larger than MAXIMUM_a
+     * and return a default Parameters instance.
+     */
+    // if ((n < 1) || (n > MAXIMUM_a))
+    // {
+    //    std::cout << "\n\nInvalid partition number. n is required to be a natural number within range [1," << MAXIMUM_a << "].";
+    //    std::cout << "\n\nHence, default program values are being used to replace user inputs for the Reimann Sum partitioning parameters.";
+    //    file << "\n\nInvalid partition number. n is required to be a natural number within range [1," << MAXIMUM_a << "].";
+    //    file << "\n\nHence, default program values are being used to replace user inputs for the Reimann Sum partitioning parameters.";
+    //    return default_params;
+    // }
+
+    /**
+     * Print a message about which x-axis interval and partition number were selected 
+     * by the user to the command line terminal and to the file output stream.
+     */
+    // std::cout << "\n\nThe x-axis interval which was selected to partition is [" << a << "," << b << "].";
+    // std::cout << "\n\nThe selected number of equally-sized partitions to divide that interval into is " << n << ".";
+    // file << "\n\nThe x-axis interval which was selected to partition is [" << a << "," << b << "].";
+    // file << "\n\nThe selected number of equally-sized partitions to divide that interval into is " << n << ".";
+
+    // Return a struct whose data type is Parameters and whose data attributes are the values which the user entered during a runtime instance of this function.
+    return {a, b, n};
+}
+
+/**
+ * This function prompts the user to select a value inside of the x-axis interval, [a,b].
+ * 
+ * If the entered value is not within those bounds, then set that value to b.
+ */
+double selectIntervalPoint(Parameters params, TeeOutput & output)
+{
+    // Declare one double type variable named x for storing floating-point number values.
+    double x = 0.0;
+
+    // Print a message to the command line terminal which prompts the user to input a value to store in the variable named x.
+    output << "\n\nEnter a value to store in double-type variable x (which represents a point inside of the selected x-axis interval): ";
+
+    /**
+     * Scan the command line terminal for the most recent keyboard input value. 
+     * Store that value in the variable named x.
+     */
+    std::cin >> x;
+
+    // Print "The value which was entered for x is {x}." to the command line terminal.
+    output.console << "\nThe value which was entered for x is " << x << ".";
+
+    // Print "The value which was entered for x is {x}." to the file output stream.
+    output.file << "\n\nThe value which was entered for x is " << x << ".";
+
+    /**
+     * If x is smaller than a or larger than b, set x to b 
+     * and print a resulting message to the command line terminal and file output stream.
+     */
+    if ((x < params.a) || (x > params.b))
+    {
+        x = params.b;
+        output.console << "\n\nThe value entered for x was either smaller than " << params.a << " or else larger than " << params.b << ".";
+        output.console << "\n\nHence, x has been reset to " << params.b << ".";
+    }
+
+    // Return the validated value of x.
+    return x;
+}
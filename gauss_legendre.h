@@ -0,0 +1,111 @@
+/**
+ * file: gauss_legendre.h
+ * type: C++ (header file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+#ifndef GAUSS_LEGENDRE_H
+#define GAUSS_LEGENDRE_H
+
+/** preprocessing directives */
+#include <vector> // std::vector
+#include "reimann_sum.h" // Function
+#include "trigonometric_functions.h" // cosine (which is constexpr)
+#define MAXIMUM_GAUSS_LEGENDRE_ORDER 1024 // constant which represents the maximum number of nodes of one Gauss-Legendre rule
+#define DEFAULT_GAUSS_LEGENDRE_ORDER 20 // constant which represents the default number of nodes per panel of integrateGaussLegendre
+#define DEFAULT_GAUSS_LEGENDRE_PANEL_WIDTH 16 // constant which represents the widest x-axis interval which integral(f, a, b) covers with one Gauss-Legendre panel
+#define MAXIMUM_GAUSS_LEGENDRE_PANELS 1000000 // constant which represents the maximum number of panels of integrateGaussLegendre
+#define GAUSS_LEGENDRE_PI 3.141592653589793238462643383279502884 // constant which represents Pi (to more digits than a double can store)
+
+/**
+ * Store the n nodes (in increasing order) and the n weights of the n-point Gauss-Legendre rule on [-1, 1] in nodes[0], ..., nodes[n - 1]
+ * and weights[0], ..., weights[n - 1].
+ *
+ * Each node is a root of the Legendre polynomial P_n(x), which is found by Newton's method from the asymptotic estimate
+ *
+ * x_i ≈ (1 - 1 / (8 * n ^ 2) + 1 / (8 * n ^ 3)) * cos(Pi * (i - 0.25) / (n + 0.5))
+ *
+ * and each weight is w_i = 2 / ((1 - x_i ^ 2) * P_n'(x_i) ^ 2).
+ *
+ * The n-point rule integrates every polynomial of degree 2 * n - 1 or less exactly.
+ */
+constexpr void computeGaussLegendreRule(int n, double * nodes, double * weights)
+{
+    for (int i = 1; i <= (n + 1) / 2; i += 1)
+    {
+        double x = (1.0 - 1.0 / (8.0 * n * n) + 1.0 / (8.0 * n * n * n)) * cosine(GAUSS_LEGENDRE_PI * (i - 0.25) / (n + 0.5));
+        double derivative = 1.0;
+        for (int iteration = 0; iteration < 100; iteration += 1)
+        {
+            // Evaluate P_n(x) with the three-term recurrence (k + 1) * P_(k + 1) = (2 * k + 1) * x * P_k - k * P_(k - 1).
+            double p0 = 1.0, p1 = x;
+            for (int k = 1; k < n; k += 1)
+            {
+                double p2 = ((2 * k + 1) * x * p1 - k * p0) / (k + 1);
+                p0 = p1;
+                p1 = p2;
+            }
+            derivative = n * (x * p1 - p0) / (x * x - 1.0);
+            double step = p1 / derivative;
+            x -= step;
+            if ((step < 1e-17) && (step > -1e-17)) break;
+        }
+
+        // Refresh the derivative at the final x (so that the weight is computed at the converged node).
+        double p0 = 1.0, p1 = x;
+        for (int k = 1; k < n; k += 1)
+        {
+            double p2 = ((2 * k + 1) * x * p1 - k * p0) / (k + 1);
+            p0 = p1;
+            p1 = p2;
+        }
+        derivative = (n == 1) ? 1.0 : n * (x * p1 - p0) / (x * x - 1.0);
+        double weight = 2.0 / ((1.0 - x * x) * derivative * derivative);
+
+        // The nodes are symmetric about zero (the ith root from the right is the negative of the ith root from the left).
+        nodes[n - i] = x;
+        nodes[i - 1] = -x;
+        weights[n - i] = weight;
+        weights[i - 1] = weight;
+    }
+    if (n % 2 == 1) nodes[n / 2] = 0.0;
+}
+
+/**
+ * A GaussLegendreRule stores the N nodes and N weights of the N-point Gauss-Legendre rule on [-1, 1].
+ */
+template <int N> struct GaussLegendreRule {
+    double nodes[N];
+    double weights[N];
+};
+
+/**
+ * Return the N-point Gauss-Legendre rule (which the compiler computes if the result initializes a constexpr variable).
+ */
+template <int N> constexpr GaussLegendreRule<N> makeGaussLegendreRule()
+{
+    GaussLegendreRule<N> rule = {};
+    computeGaussLegendreRule(N, rule.nodes, rule.weights);
+    return rule;
+}
+
+// The tables of the most common orders are computed at compile time.
+template <int N> inline constexpr GaussLegendreRule<N> GAUSS_LEGENDRE_RULE = makeGaussLegendreRule<N>();
+
+/**
+ * Define a struct-type variable named GaussLegendreNodes which stores the nodes and the weights of a Gauss-Legendre rule
+ * of any order (in increasing order of the nodes).
+ */
+struct GaussLegendreNodes {
+    std::vector<double> nodes;
+    std::vector<double> weights;
+};
+
+/** function prototypes */
+const GaussLegendreNodes & gaussLegendreRule(int n);
+double integrateGaussLegendre(const Function & func, double a, double b, int n = DEFAULT_GAUSS_LEGENDRE_ORDER, int panels = 1);
+double integrateGaussLegendre(const Function & func, double a, double b, const GaussLegendreNodes & rule, int panels = 1);
+
+#endif // GAUSS_LEGENDRE_H
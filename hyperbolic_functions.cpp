@@ -0,0 +1,288 @@
+/**
+ * file: hyperbolic_functions.cpp
+ * type: C++ (source file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+/** preprocessing directives */
+#include <iostream> // standard output (std::cout)
+#include <bit> // std::bit_cast
+#include <cstdint> // std::uint64_t
+#include <cmath> // std::fabs, std::copysign, HUGE_VAL
+#include "hyperbolic_functions.h" // hyperbolic kernels, evaluateWithFixUp, BATCH_TARGETS, function prototypes
+#define LARGEST_HALVED_EXPONENT 1416 // constant which represents 2 * MAXIMUM_EXPONENTIAL_KERNEL_x (beyond which sinh(x) and cosh(x) overflow in any case)
+
+/**
+ * Return sinh(x) for any x (including |x| > MAXIMUM_EXPONENTIAL_KERNEL_x and "not a number") without checking whether x is in range.
+ *
+ * If |x| > MAXIMUM_EXPONENTIAL_KERNEL_x, then e ^ -|x| is negligible and sinh(x) = (e ^ (|x| / 2) / 2) * e ^ (|x| / 2) (with the sign of x), which is
+ * finite up to |x| ≈ 710.4758 (so e ^ |x| itself, which would overflow first, is never formed). Beyond LARGEST_HALVED_EXPONENT, the result is infinite.
+ */
+static double hyperbolicSineUnchecked(double x)
+{
+    double a = std::fabs(x);
+    if (x != x) return x;
+    if (a <= MAXIMUM_EXPONENTIAL_KERNEL_x) return hyperbolicSineKernel(x);
+    if (a > LARGEST_HALVED_EXPONENT) return std::copysign(HUGE_VAL, x);
+    double e_to_half_a = exponentialKernel(0.5 * a);
+    return std::copysign((0.5 * e_to_half_a) * e_to_half_a, x);
+}
+
+/**
+ * Return cosh(x) for any x (including |x| > MAXIMUM_EXPONENTIAL_KERNEL_x and "not a number") without checking whether x is in range
+ * (beyond MAXIMUM_EXPONENTIAL_KERNEL_x, cosh(x) = |sinh(x)| to double precision).
+ */
+static double hyperbolicCosineUnchecked(double x)
+{
+    if (std::fabs(x) <= MAXIMUM_EXPONENTIAL_KERNEL_x) return hyperbolicCosineKernel(x);
+    return std::fabs(hyperbolicSineUnchecked(x));
+}
+
+/**
+ * Return tanh(x), asinh(x), acosh(x), and atanh(x) (for x in the ranges of their kernels or "not a number") without checking whether x is in range.
+ */
+static double hyperbolicTangentUnchecked(double x) { return (x != x) ? x : hyperbolicTangentKernel(x); }
+static double inverseHyperbolicSineUnchecked(double x) { return (x != x) ? x : inverseHyperbolicSineKernel(x); }
+static double inverseHyperbolicCosineUnchecked(double x) { return (x != x) ? x : inverseHyperbolicCosineKernel(x); }
+static double inverseHyperbolicTangentUnchecked(double x) { return (x != x) ? x : inverseHyperbolicTangentKernel(x); }
+
+/**
+ * Return sinh(x) (which is also expressed as (e ^ x - e ^ -x) / 2).
+ *
+ * x can theoretically be any real number (but is constrained to be in [(-1 * MAXIMUM_x), MAXIMUM_x]). sinh(x) overflows to infinity
+ * (with the sign of x) if |x| is larger than about 710.4758.
+ */
+double hyperbolicSine(double x)
+{
+    // Set x to 1 if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((x < (-1 * MAXIMUM_x)) || (x > MAXIMUM_x))
+    {
+        x = 1;
+        std::cout << "\n\nThe number, x, in hyperbolicSine(x) was out of range. Hence, x has been reset to 1.";
+    }
+    return hyperbolicSineUnchecked(x);
+}
+
+/**
+ * Return cosh(x) (which is also expressed as (e ^ x + e ^ -x) / 2).
+ *
+ * x can theoretically be any real number (but is constrained to be in [(-1 * MAXIMUM_x), MAXIMUM_x]). cosh(x) overflows to infinity
+ * if |x| is larger than about 710.4758.
+ */
+double hyperbolicCosine(double x)
+{
+    // Set x to 1 if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((x < (-1 * MAXIMUM_x)) || (x > MAXIMUM_x))
+    {
+        x = 1;
+        std::cout << "\n\nThe number, x, in hyperbolicCosine(x) was out of range. Hence, x has been reset to 1.";
+    }
+    return hyperbolicCosineUnchecked(x);
+}
+
+/**
+ * Store sinh(x) in sinh_of_x and cosh(x) in cosh_of_x (with one exponential and one reciprocal for both values).
+ *
+ * x can theoretically be any real number (but is constrained to be in [(-1 * MAXIMUM_x), MAXIMUM_x]).
+ */
+void hyperbolicSineAndCosine(double x, double & sinh_of_x, double & cosh_of_x)
+{
+    // Set x to 1 if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((x < (-1 * MAXIMUM_x)) || (x > MAXIMUM_x))
+    {
+        x = 1;
+        std::cout << "\n\nThe number, x, in hyperbolicSineAndCosine(x) was out of range. Hence, x has been reset to 1.";
+    }
+    if (std::fabs(x) <= MAXIMUM_EXPONENTIAL_KERNEL_x) hyperbolicSineAndCosineKernel(x, sinh_of_x, cosh_of_x);
+    else
+    {
+        sinh_of_x = hyperbolicSineUnchecked(x);
+        cosh_of_x = std::fabs(sinh_of_x);
+    }
+}
+
+/**
+ * Return tanh(x) (which is also expressed as sinh(x) / cosh(x)).
+ *
+ * x can theoretically be any real number (but is constrained to be in [(-1 * MAXIMUM_x), MAXIMUM_x]).
+ */
+double hyperbolicTangent(double x)
+{
+    // Set x to 1 if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((x < (-1 * MAXIMUM_x)) || (x > MAXIMUM_x))
+    {
+        x = 1;
+        std::cout << "\n\nThe number, x, in hyperbolicTangent(x) was out of range. Hence, x has been reset to 1.";
+    }
+    return hyperbolicTangentUnchecked(x);
+}
+
+/**
+ * Return asinh(x) (i.e. the number whose hyperbolic sine is x).
+ *
+ * x can theoretically be any real number (but is constrained to be in [(-1 * MAXIMUM_x), MAXIMUM_x]).
+ */
+double inverseHyperbolicSine(double x)
+{
+    // Set x to 1 if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((x < (-1 * MAXIMUM_x)) || (x > MAXIMUM_x))
+    {
+        x = 1;
+        std::cout << "\n\nThe number, x, in inverseHyperbolicSine(x) was out of range. Hence, x has been reset to 1.";
+    }
+    return inverseHyperbolicSineUnchecked(x);
+}
+
+/**
+ * Return acosh(x) (i.e. the nonnegative number whose hyperbolic cosine is x).
+ *
+ * x can theoretically be any real number which is at least 1 (but is constrained to be in [1, MAXIMUM_x]).
+ */
+double inverseHyperbolicCosine(double x)
+{
+    // Set x to 1 if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((x < 1) || (x > MAXIMUM_x))
+    {
+        x = 1;
+        std::cout << "\n\nThe number, x, in inverseHyperbolicCosine(x) was out of range. Hence, x has been reset to 1.";
+    }
+    return inverseHyperbolicCosineUnchecked(x);
+}
+
+/**
+ * Return atanh(x) (i.e. the number whose hyperbolic tangent is x).
+ *
+ * x can theoretically be any real number whose magnitude is smaller than 1 (at which atanh(x) is infinite). If |x| is at least 1,
+ * x is reset to 0 (instead of to 1, which is itself out of range).
+ */
+double inverseHyperbolicTangent(double x)
+{
+    // Set x to 0 if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((x <= -1) || (x >= 1))
+    {
+        x = 0;
+        std::cout << "\n\nThe number, x, in inverseHyperbolicTangent(x) was out of range. Hence, x has been reset to 0.";
+    }
+    return inverseHyperbolicTangentUnchecked(x);
+}
+
+/**
+ * Return 1 if |x| is larger than the bound of the exponential kernel (or if x is "not a number") and 0 otherwise.
+ */
+static inline std::uint64_t isOutsideExponentialRange(double x)
+{
+    return magnitudeAbove(x, MAXIMUM_EXPONENTIAL_KERNEL_x);
+}
+
+/**
+ * Return 1 if |x| is larger than MAXIMUM_x (or if x is "not a number") and 0 otherwise.
+ */
+static inline std::uint64_t isOutsideMaximum(double x)
+{
+    return magnitudeAbove(x, MAXIMUM_x);
+}
+
+/**
+ * Return true if x is in [(-1 * MAXIMUM_x), MAXIMUM_x].
+ */
+static inline bool isWithinMaximum(double x)
+{
+    return (x >= (-1 * MAXIMUM_x)) && (x <= MAXIMUM_x);
+}
+
+/**
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ *
+ * The batch kernels below compute y[k] = f(x[k]) for k = 0, 1, ..., count - 1 (i.e. they have the signature of a BatchKernel)
+ * for f = sinh, cosh, tanh, asinh, acosh, and atanh (with the inline kernels of hyperbolic_functions.h in their vectorized main loops).
+ * They are compiled with BATCH_TARGETS (see trigonometric_batch.h), so their main loops use the widest vectors of the machine which runs them.
+ *
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * Store sinh(x[k]) in y[k] for k = 0, 1, ..., count - 1.
+ */
+BATCH_TARGETS void hyperbolicSineBatch(const double * x, double * y, long long count)
+{
+    evaluateWithFixUp("hyperbolicSineBatch", x, y, count, hyperbolicSineKernel, isOutsideExponentialRange, isWithinMaximum, 1.0, hyperbolicSineUnchecked);
+}
+
+/**
+ * Store cosh(x[k]) in y[k] for k = 0, 1, ..., count - 1.
+ */
+BATCH_TARGETS void hyperbolicCosineBatch(const double * x, double * y, long long count)
+{
+    evaluateWithFixUp("hyperbolicCosineBatch", x, y, count, hyperbolicCosineKernel, isOutsideExponentialRange, isWithinMaximum, 1.0, hyperbolicCosineUnchecked);
+}
+
+/**
+ * Store sinh(x[k]) in sinh_of_x[k] and cosh(x[k]) in cosh_of_x[k] for k = 0, 1, ..., count - 1 (with one exponential and one
+ * reciprocal per element for both values).
+ */
+BATCH_TARGETS void hyperbolicSineAndCosineBatch(const double * x, double * sinh_of_x, double * cosh_of_x, long long count)
+{
+    std::uint64_t special = 0;
+    long long out_of_range = 0;
+    for (long long k = 0; k < count; k += 1)
+    {
+        special += isOutsideExponentialRange(x[k]);
+        hyperbolicSineAndCosineKernel(x[k], sinh_of_x[k], cosh_of_x[k]);
+    }
+    for (long long k = 0; (special > 0) && (k < count); k += 1)
+    {
+        if (!isOutsideExponentialRange(x[k])) continue;
+        double value = x[k];
+        if (!isWithinMaximum(value) && (value == value))
+        {
+            value = 1;
+            out_of_range += 1;
+        }
+        sinh_of_x[k] = hyperbolicSineUnchecked(value);
+        cosh_of_x[k] = hyperbolicCosineUnchecked(value);
+    }
+    if (out_of_range > 0) std::cout << "\n\n" << out_of_range << " of the numbers, x[k], in hyperbolicSineAndCosineBatch(x, sinh_of_x, cosh_of_x, count) were out of range. Hence, each of those values of x[k] has been reset to 1.";
+}
+
+/**
+ * Store tanh(x[k]) in y[k] for k = 0, 1, ..., count - 1.
+ */
+BATCH_TARGETS void hyperbolicTangentBatch(const double * x, double * y, long long count)
+{
+    evaluateWithFixUp("hyperbolicTangentBatch", x, y, count, hyperbolicTangentKernel, isOutsideMaximum, isWithinMaximum, 1.0, hyperbolicTangentUnchecked);
+}
+
+/**
+ * Store asinh(x[k]) in y[k] for k = 0, 1, ..., count - 1.
+ */
+BATCH_TARGETS void inverseHyperbolicSineBatch(const double * x, double * y, long long count)
+{
+    evaluateWithFixUp("inverseHyperbolicSineBatch", x, y, count, inverseHyperbolicSineKernel, isOutsideMaximum, isWithinMaximum, 1.0, inverseHyperbolicSineUnchecked);
+}
+
+/**
+ * Store acosh(x[k]) in y[k] for k = 0, 1, ..., count - 1.
+ *
+ * x[k] is special if it is negative (i.e. its sign bit is set), if it is below 1, or if it is above MAXIMUM_x (or "not a number").
+ */
+BATCH_TARGETS void inverseHyperbolicCosineBatch(const double * x, double * y, long long count)
+{
+    auto is_special = [](double x) {
+        std::uint64_t bits = std::bit_cast<std::uint64_t>(x);
+        return ((bits | (bits - std::bit_cast<std::uint64_t>(1.0))) >> 63) | magnitudeAbove(x, MAXIMUM_x);
+    };
+    auto in_range = [](double x) { return (x >= 1) && (x <= MAXIMUM_x); };
+    evaluateWithFixUp("inverseHyperbolicCosineBatch", x, y, count, inverseHyperbolicCosineKernel, is_special, in_range, 1.0, inverseHyperbolicCosineUnchecked);
+}
+
+/**
+ * Store atanh(x[k]) in y[k] for k = 0, 1, ..., count - 1 (where each x[k] whose magnitude is at least 1 is reset to 0).
+ */
+BATCH_TARGETS void inverseHyperbolicTangentBatch(const double * x, double * y, long long count)
+{
+    auto is_special = [](double x) { return magnitudeAbove(x, LARGEST_DOUBLE_BELOW_ONE); };
+    auto in_range = [](double x) { return (x > -1) && (x < 1); };
+    evaluateWithFixUp("inverseHyperbolicTangentBatch", x, y, count, inverseHyperbolicTangentKernel, is_special, in_range, 0.0, inverseHyperbolicTangentUnchecked);
+}
@@ -0,0 +1,160 @@
+/**
+ * file: hyperbolic_functions.h
+ * type: C++ (header file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+#ifndef HYPERBOLIC_FUNCTIONS_H
+#define HYPERBOLIC_FUNCTIONS_H
+
+/** preprocessing directives */
+#include <bit> // std::bit_cast
+#include <cstdint> // std::uint64_t
+#include <cmath> // std::fabs, std::sqrt, std::copysign
+#include "exponential_kernels.h" // exponentialKernel, exponentialMinusOneKernel, logarithmOfOnePlusKernel, MAXIMUM_EXPONENTIAL_KERNEL_x
+#include "trigonometric_batch.h" // reciprocalWithoutDivision, selectedBy, negatedIf, magnitudeAbove, evaluateWithFixUp, BATCH_TARGETS, MAXIMUM_x
+#define HYPERBOLIC_TANGENT_SATURATION 22 // constant which represents the smallest whole number x for which tanh(x) rounds to 1
+#define LARGEST_DOUBLE_BELOW_ONE 0.99999999999999989 // constant which represents 1 - 2 ^ -53 (the largest |x| which inverseHyperbolicTangent accepts)
+
+/** function prototypes */
+inline double hyperbolicSineKernel(double x);
+inline double hyperbolicCosineKernel(double x);
+inline void hyperbolicSineAndCosineKernel(double x, double & sinh_of_x, double & cosh_of_x);
+inline double hyperbolicTangentKernel(double x);
+inline double inverseHyperbolicSineKernel(double x);
+inline double inverseHyperbolicCosineKernel(double x);
+inline double inverseHyperbolicTangentKernel(double x);
+double hyperbolicSine(double x);
+double hyperbolicCosine(double x);
+void hyperbolicSineAndCosine(double x, double & sinh_of_x, double & cosh_of_x);
+double hyperbolicTangent(double x);
+double inverseHyperbolicSine(double x);
+double inverseHyperbolicCosine(double x);
+double inverseHyperbolicTangent(double x);
+void hyperbolicSineBatch(const double * x, double * y, long long count);
+void hyperbolicCosineBatch(const double * x, double * y, long long count);
+void hyperbolicSineAndCosineBatch(const double * x, double * sinh_of_x, double * cosh_of_x, long long count);
+void hyperbolicTangentBatch(const double * x, double * y, long long count);
+void inverseHyperbolicSineBatch(const double * x, double * y, long long count);
+void inverseHyperbolicCosineBatch(const double * x, double * y, long long count);
+void inverseHyperbolicTangentBatch(const double * x, double * y, long long count);
+
+/**
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ *
+ * The kernels below compute the hyperbolic functions
+ *
+ * sinh(x) = (e ^ x - e ^ -x) / 2,    cosh(x) = (e ^ x + e ^ -x) / 2,    tanh(x) = sinh(x) / cosh(x)
+ *
+ * and their inverses
+ *
+ * asinh(x) = ln(x + sqrt(x ^ 2 + 1)),    acosh(x) = ln(x + sqrt(x ^ 2 - 1)),    atanh(x) = ln((1 + x) / (1 - x)) / 2
+ *
+ * from the table-driven kernels of exponential_kernels.h. Each formula is rearranged where evaluating it as written would cancel
+ * most of the digits (e.g. e ^ x - e ^ -x for x close to zero), and every reciprocal is computed with reciprocalWithoutDivision.
+ *
+ * The kernels contain no branch, so a loop which calls them for each element of an array is vectorized by the compiler (these
+ * inline kernels are the entry points for such loops). Such a loop should be compiled with -fno-math-errno (as CMakeLists.txt does),
+ * because std::sqrt otherwise needs a branch which sets errno for negative arguments. In return, the kernels do not check their
+ * arguments: the function which calls them keeps x in the documented range and handles "not a number" separately (as the scalar
+ * and batch functions do).
+ *
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * Return sinh(x) for x in [(-1 * MAXIMUM_EXPONENTIAL_KERNEL_x), MAXIMUM_EXPONENTIAL_KERNEL_x] (to within about two units in the last place).
+ *
+ * If |x| < 1, sinh(x) is the Taylor series x + x ^ 3 / 3! + x ^ 5 / 5! + ... + x ^ 17 / 17! (whose remaining terms are below 2 ^ -56 * sinh(x)),
+ * because e ^ |x| - e ^ -|x| would cancel the leading digits there. Otherwise, sinh(x) = (E - 1 / E) / 2 with E = e ^ |x| (and the sign of x).
+ * Both values are computed and one of them is selected, so that the loop which calls this function has no branch.
+ */
+inline double hyperbolicSineKernel(double x)
+{
+    double a = std::fabs(x), z = a * a;
+    double series = a + a * z * (1.0 / 6 + z * (1.0 / 120 + z * (1.0 / 5040 + z * (1.0 / 362880 + z * (1.0 / 39916800 + z * (1.0 / 6227020800 + z * (1.0 / 1307674368000 + z * (1.0 / 355687428096000))))))));
+    double e_to_a = exponentialKernel(a);
+    double difference = 0.5 * (e_to_a - reciprocalWithoutDivision(e_to_a));
+    std::uint64_t below_one = (std::bit_cast<std::uint64_t>(a) - std::bit_cast<std::uint64_t>(1.0)) >> 63;
+    return std::copysign(selectedBy(below_one, series, difference), x);
+}
+
+/**
+ * Return cosh(x) = (E + 1 / E) / 2 (where E = e ^ |x|) for x in [(-1 * MAXIMUM_EXPONENTIAL_KERNEL_x), MAXIMUM_EXPONENTIAL_KERNEL_x]
+ * (to within about two units in the last place; the two terms have the same sign, so nothing cancels).
+ */
+inline double hyperbolicCosineKernel(double x)
+{
+    double e_to_a = exponentialKernel(std::fabs(x));
+    return 0.5 * (e_to_a + reciprocalWithoutDivision(e_to_a));
+}
+
+/**
+ * Store sinh(x) in sinh_of_x and cosh(x) in cosh_of_x for x in [(-1 * MAXIMUM_EXPONENTIAL_KERNEL_x), MAXIMUM_EXPONENTIAL_KERNEL_x].
+ *
+ * The two values share one exponential and one reciprocal (so computing both costs about as much as computing either of them).
+ */
+inline void hyperbolicSineAndCosineKernel(double x, double & sinh_of_x, double & cosh_of_x)
+{
+    double a = std::fabs(x), z = a * a;
+    double series = a + a * z * (1.0 / 6 + z * (1.0 / 120 + z * (1.0 / 5040 + z * (1.0 / 362880 + z * (1.0 / 39916800 + z * (1.0 / 6227020800 + z * (1.0 / 1307674368000 + z * (1.0 / 355687428096000))))))));
+    double e_to_a = exponentialKernel(a);
+    double reciprocal = reciprocalWithoutDivision(e_to_a);
+    std::uint64_t below_one = (std::bit_cast<std::uint64_t>(a) - std::bit_cast<std::uint64_t>(1.0)) >> 63;
+    sinh_of_x = std::copysign(selectedBy(below_one, series, 0.5 * (e_to_a - reciprocal)), x);
+    cosh_of_x = 0.5 * (e_to_a + reciprocal);
+}
+
+/**
+ * Return tanh(x) = M / (M + 2) (where M = e ^ (2 * |x|) - 1, with the sign of x) for every finite x (to within about three units in the last place).
+ *
+ * M is computed with exponentialMinusOneKernel, which keeps its digits for x close to zero (where tanh(x) ≈ x). |x| is first limited to
+ * HYPERBOLIC_TANGENT_SATURATION, beyond which tanh(x) rounds to 1 (and e ^ (2 * |x|) would eventually overflow).
+ */
+inline double hyperbolicTangentKernel(double x)
+{
+    double a = selectedBy(magnitudeAbove(x, HYPERBOLIC_TANGENT_SATURATION), HYPERBOLIC_TANGENT_SATURATION, std::fabs(x));
+    double m = exponentialMinusOneKernel(2.0 * a);
+    return std::copysign(m * reciprocalWithoutDivision(m + 2.0), x);
+}
+
+/**
+ * Return asinh(x) for x in [(-1 * MAXIMUM_x), MAXIMUM_x] (to within about two units in the last place).
+ *
+ * For a = |x|, ln(a + sqrt(a ^ 2 + 1)) = ln(1 + t) where t = a + a ^ 2 / (1 + sqrt(a ^ 2 + 1)) (because sqrt(a ^ 2 + 1) - 1 = a ^ 2 / (sqrt(a ^ 2 + 1) + 1)),
+ * and ln(1 + t) is computed with logarithmOfOnePlusKernel, so that asinh(x) ≈ x keeps its digits for x close to zero.
+ */
+inline double inverseHyperbolicSineKernel(double x)
+{
+    double a = std::fabs(x), z = a * a;
+    double t = a + z * reciprocalWithoutDivision(1.0 + std::sqrt(z + 1.0));
+    return std::copysign(logarithmOfOnePlusKernel(t), x);
+}
+
+/**
+ * Return acosh(x) for x in [1, MAXIMUM_x] (to within about two units in the last place).
+ *
+ * With d = x - 1 (which is exact for x in [1, 2]), ln(x + sqrt(x ^ 2 - 1)) = ln(1 + d + sqrt(d * (x + 1))), which is computed with
+ * logarithmOfOnePlusKernel (so that acosh(x) ≈ sqrt(2 * d) keeps its digits for x close to 1).
+ */
+inline double inverseHyperbolicCosineKernel(double x)
+{
+    double d = x - 1.0;
+    return logarithmOfOnePlusKernel(d + std::sqrt(d * (x + 1.0)));
+}
+
+/**
+ * Return atanh(x) for x in [(-1 * LARGEST_DOUBLE_BELOW_ONE), LARGEST_DOUBLE_BELOW_ONE] (to within about three units in the last place).
+ *
+ * For a = |x|, ln((1 + a) / (1 - a)) / 2 = ln(1 + 2 * a / (1 - a)) / 2, which is computed with logarithmOfOnePlusKernel (so that
+ * atanh(x) ≈ x keeps its digits for x close to zero). 1 - a is exact for a in [0.5, 1].
+ */
+inline double inverseHyperbolicTangentKernel(double x)
+{
+    double a = std::fabs(x);
+    return std::copysign(0.5 * logarithmOfOnePlusKernel(2.0 * a * reciprocalWithoutDivision(1.0 - a)), x);
+}
+
+#endif // HYPERBOLIC_FUNCTIONS_H
@@ -0,0 +1,165 @@
+/**
+ * file: interval.cpp
+ * type: C++ (source file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+/** preprocessing directives */
+#include <iostream> // standard output (std::cout)
+#include <sstream> // std::ostringstream
+#include <iomanip> // std::setprecision
+#include <cmath> // std::sin, std::cos, std::atan, std::exp, std::log, std::floor, std::fabs, std::fmin, std::fmax, M_PI, INFINITY, NAN
+#include "interval.h" // Interval, roundedDown, roundedUp, function prototypes
+#include "trigonometric_functions.h" // MAXIMUM_x
+#define INTERVAL_LIBRARY_ULPS 2 // constant which represents the number of units in the last place by which each value of std::sin, std::cos, std::atan, std::exp, and std::log is widened
+#define INTERVAL_CRITICAL_POINT_MARGIN 1e-12 // constant which represents the relative margin by which an extremum of sine or cosine which is near an end-point of x is counted as inside of x
+
+/** function prototypes */
+static double libraryValueRoundedDown(double value);
+static double libraryValueRoundedUp(double value);
+static Interval enclosePeriodicFunction(const Interval & x, double value_at_lower, double value_at_upper, double phase_of_maximum);
+
+/**
+ * Return the Interval as "[lower, upper]" where each bound has 17 significant digits (so that it converts back to exactly the same double).
+ */
+std::string Interval::toString() const
+{
+    std::ostringstream stream;
+    stream << std::setprecision(17) << "[" << lower << ", " << upper << "]";
+    return stream.str();
+}
+
+/**
+ * Return a lower bound of the exact value of a function which the C++ standard library computed as value.
+ *
+ * The library functions are not correctly rounded, but glibc (and the other common implementations) document an error below
+ * one unit in the last place for std::sin, std::cos, std::atan, std::exp, and std::log, so moving the value outward by
+ * INTERVAL_LIBRARY_ULPS (i.e. 2) units in the last place gives a bound with a margin of one unit in the last place.
+ */
+static double libraryValueRoundedDown(double value)
+{
+    for (int i = 0; i < INTERVAL_LIBRARY_ULPS; i += 1) value = roundedDown(value);
+    return value;
+}
+
+/**
+ * Return an upper bound of the exact value of a function which the C++ standard library computed as value (see libraryValueRoundedDown).
+ */
+static double libraryValueRoundedUp(double value)
+{
+    for (int i = 0; i < INTERVAL_LIBRARY_ULPS; i += 1) value = roundedUp(value);
+    return value;
+}
+
+/**
+ * Return the range on x of a sinusoid of period 2 * pi whose maxima (of 1) are at phase_of_maximum + 2 * k * pi and whose minima
+ * (of -1) are at phase_of_maximum + pi + 2 * k * pi, given its values at the two end-points of x as computed by the standard library.
+ *
+ * Between two consecutive extrema a sinusoid is monotone, so its range on x is spanned by the two end-point values unless x
+ * contains an extremum. The extrema near x are located in double arithmetic, so an extremum which is within a relative distance
+ * of INTERVAL_CRITICAL_POINT_MARGIN of x is counted as inside of x (which can only widen the result to the exact value of 1 or -1).
+ */
+static Interval enclosePeriodicFunction(const Interval & x, double value_at_lower, double value_at_upper, double phase_of_maximum)
+{
+    // An Interval which is at least as wide as one period contains both a maximum and a minimum.
+    if (!(x.upper - x.lower < 2 * M_PI)) return { -1.0, 1.0 };
+
+    Interval result = { libraryValueRoundedDown(std::fmin(value_at_lower, value_at_upper)), libraryValueRoundedUp(std::fmax(value_at_lower, value_at_upper)) };
+    const double margin = INTERVAL_CRITICAL_POINT_MARGIN * (1.0 + std::fmax(std::fabs(x.lower), std::fabs(x.upper)));
+
+    // Check the three maxima (and the three minima) which are nearest to the lower end-point of x (the rounding of k can be off by one).
+    const double k = std::floor((x.lower - phase_of_maximum) / (2 * M_PI));
+    for (int j = -1; j <= 1; j += 1)
+    {
+        double maximum = phase_of_maximum + 2 * M_PI * (k + j);
+        double minimum = maximum + M_PI;
+        if ((maximum >= x.lower - margin) && (maximum <= x.upper + margin)) result.upper = 1.0;
+        if ((minimum >= x.lower - margin) && (minimum <= x.upper + margin)) result.lower = -1.0;
+    }
+
+    // Remove the parts of the widened end-point values which are outside of [-1, 1].
+    result.lower = std::fmax(result.lower, -1.0);
+    result.upper = std::fmin(result.upper, 1.0);
+    return result;
+}
+
+/**
+ * Return an Interval which contains sin(x) for every x in the Interval x (where x is in radians).
+ *
+ * If an end-point of x is out of range, x is reset to 1 (as in the double version of sine).
+ */
+Interval sine(const Interval & x)
+{
+    Interval y = x;
+    if ((x.lower < (-1 * MAXIMUM_x)) || (x.upper > MAXIMUM_x) || std::isnan(x.lower) || std::isnan(x.upper))
+    {
+        std::cout << "\n\nThe number of radians, x, in sine(x) was out of range. Hence, x has been reset to 1.";
+        y = Interval(1.0);
+    }
+    return enclosePeriodicFunction(y, std::sin(y.lower), std::sin(y.upper), M_PI / 2);
+}
+
+/**
+ * Return an Interval which contains cos(x) for every x in the Interval x (where x is in radians).
+ *
+ * If an end-point of x is out of range, x is reset to 1 (as in the double version of cosine).
+ */
+Interval cosine(const Interval & x)
+{
+    Interval y = x;
+    if ((x.lower < (-1 * MAXIMUM_x)) || (x.upper > MAXIMUM_x) || std::isnan(x.lower) || std::isnan(x.upper))
+    {
+        std::cout << "\n\nThe number of radians, x, in cosine(x) was out of range. Hence, x has been reset to 1.";
+        y = Interval(1.0);
+    }
+    return enclosePeriodicFunction(y, std::cos(y.lower), std::cos(y.upper), 0.0);
+}
+
+/**
+ * Return an Interval which contains arctan(x) for every x in the Interval x (arctangent is increasing, so only the end-points are evaluated).
+ *
+ * If an end-point of x is out of range, x is reset to 1 (as in the double version of arctangent).
+ */
+Interval arctangent(const Interval & x)
+{
+    Interval y = x;
+    if ((x.lower < (-1 * MAXIMUM_x)) || (x.upper > MAXIMUM_x) || std::isnan(x.lower) || std::isnan(x.upper))
+    {
+        std::cout << "\n\nThe number of radians, x, in arctangent(x) was out of range. Hence, x has been reset to 1.";
+        y = Interval(1.0);
+    }
+    return { libraryValueRoundedDown(std::atan(y.lower)), libraryValueRoundedUp(std::atan(y.upper)) };
+}
+
+/**
+ * Return an Interval which contains e ^ x for every x in the Interval x (e ^ x is increasing and positive).
+ */
+Interval power_of_e_to_x(const Interval & x)
+{
+    return { std::fmax(0.0, libraryValueRoundedDown(std::exp(x.lower))), libraryValueRoundedUp(std::exp(x.upper)) };
+}
+
+/**
+ * Return an Interval which contains ln(x) for every positive x in the Interval x (ln is increasing).
+ *
+ * The part of x which is not positive is ignored: if x contains zero, the lower bound is -infinity, and an Interval which is
+ * entirely below zero gives [NaN, NaN] (as std::log does for a negative number).
+ */
+Interval ln(const Interval & x)
+{
+    if (x.upper < 0.0) return { NAN, NAN };
+    double lower = (x.lower > 0.0) ? libraryValueRoundedDown(std::log(x.lower)) : -INFINITY;
+    return { lower, libraryValueRoundedUp(std::log(x.upper)) };
+}
+
+/**
+ * Return an Interval which contains log_b(x) = ln(x) / ln(b) for every x in the Interval x and every b in the Interval logarithmic_base.
+ *
+ * If logarithmic_base contains 1 (where ln(b) is zero), the result is unbounded and [-infinity, infinity] is returned.
+ */
+Interval logarithm(const Interval & x, const Interval & logarithmic_base)
+{
+    return ln(x) / ln(logarithmic_base);
+}
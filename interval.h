@@ -0,0 +1,185 @@
+/**
+ * file: interval.h
+ * type: C++ (header file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+#ifndef INTERVAL_H
+#define INTERVAL_H
+
+/** preprocessing directives */
+#include <cmath> // std::sqrt, std::fmin, std::fmax, INFINITY, NAN
+#include <cstdint> // std::uint64_t
+#include <cstring> // std::memcpy
+#include <functional> // std::function
+#include <limits> // std::numeric_limits
+#include <string> // std::string
+#include "double_double.h" // twoSum
+
+/**
+ * An Interval is the closed set of real numbers [lower, upper] (with lower <= upper) which is guaranteed to contain the exact
+ * value of whatever it represents. Every operation on Intervals rounds its lower bound toward -infinity and its upper bound
+ * toward +infinity (i.e. outward), so the result contains every value which the operation can take on the operand sets.
+ *
+ * The outward rounding is done without changing the floating-point rounding mode (which would be slow and which the compiler
+ * does not track): each bound is computed with the default round-to-nearest and is then moved outward by one unit in the last
+ * place (which bounds the rounding error of one correctly rounded operation). Sums use twoSum instead, which tells exactly
+ * whether the rounded sum is above or below the exact sum, so that exact sums (e.g. of grid points) are not widened at all.
+ */
+struct Interval {
+    double lower;
+    double upper;
+
+    Interval(double value = 0.0) : lower(value), upper(value) {}
+    Interval(double lower_bound, double upper_bound) : lower(lower_bound), upper(upper_bound) {}
+
+    double midpoint() const { return 0.5 * lower + 0.5 * upper; }
+    double width() const { return upper - lower; }
+    bool contains(double value) const { return (lower <= value) && (value <= upper); }
+    std::string toString() const;
+};
+
+/**
+ * Return the largest double which is smaller than x (or x itself if x is -infinity or NaN).
+ */
+inline double roundedDown(double x)
+{
+    if (!(x > -INFINITY)) return x;
+    if (x == 0.0) return -std::numeric_limits<double>::denorm_min();
+    std::uint64_t bits = 0;
+    std::memcpy(&bits, &x, sizeof(double));
+    bits = (x > 0.0) ? bits - 1 : bits + 1;
+    std::memcpy(&x, &bits, sizeof(double));
+    return x;
+}
+
+/**
+ * Return the smallest double which is larger than x (or x itself if x is +infinity or NaN).
+ */
+inline double roundedUp(double x) { return -roundedDown(-x); }
+
+/**
+ * Return a lower bound of a + b (which is fl(a + b) itself whenever that rounded sum is exact or was rounded down).
+ */
+inline double sumRoundedDown(double a, double b)
+{
+    double error = 0.0;
+    double s = twoSum(a, b, error);
+    if (s == INFINITY) return std::numeric_limits<double>::max();
+    return (error < 0.0) ? roundedDown(s) : s;
+}
+
+/**
+ * Return an upper bound of a + b (which is fl(a + b) itself whenever that rounded sum is exact or was rounded up).
+ */
+inline double sumRoundedUp(double a, double b)
+{
+    double error = 0.0;
+    double s = twoSum(a, b, error);
+    if (s == -INFINITY) return std::numeric_limits<double>::lowest();
+    return (error > 0.0) ? roundedUp(s) : s;
+}
+
+inline Interval operator - (const Interval & u) { return { -u.upper, -u.lower }; }
+
+inline Interval operator + (const Interval & u, const Interval & v) { return { sumRoundedDown(u.lower, v.lower), sumRoundedUp(u.upper, v.upper) }; }
+
+inline Interval operator - (const Interval & u, const Interval & v) { return { sumRoundedDown(u.lower, -v.upper), sumRoundedUp(u.upper, -v.lower) }; }
+
+/**
+ * Return the product of two Intervals. When both Intervals are non-negative (e.g. the width of a partition times a value of sqrt(x))
+ * only two products are needed; otherwise the smallest and the largest of the four products of the bounds are used.
+ */
+inline Interval operator * (const Interval & u, const Interval & v)
+{
+    if ((u.lower >= 0.0) && (v.lower >= 0.0)) return { roundedDown(u.lower * v.lower), roundedUp(u.upper * v.upper) };
+    double p0 = u.lower * v.lower, p1 = u.lower * v.upper, p2 = u.upper * v.lower, p3 = u.upper * v.upper;
+    double smallest = std::fmin(std::fmin(p0, p1), std::fmin(p2, p3));
+    double largest = std::fmax(std::fmax(p0, p1), std::fmax(p2, p3));
+    return { roundedDown(smallest), roundedUp(largest) };
+}
+
+/**
+ * Return the quotient of two Intervals. If the divisor contains zero, the quotient is unbounded and [-infinity, infinity] is returned.
+ */
+inline Interval operator / (const Interval & u, const Interval & v)
+{
+    if ((v.lower <= 0.0) && (v.upper >= 0.0)) return { -INFINITY, INFINITY };
+    double q0 = u.lower / v.lower, q1 = u.lower / v.upper, q2 = u.upper / v.lower, q3 = u.upper / v.upper;
+    double smallest = std::fmin(std::fmin(q0, q1), std::fmin(q2, q3));
+    double largest = std::fmax(std::fmax(q0, q1), std::fmax(q2, q3));
+    return { roundedDown(smallest), roundedUp(largest) };
+}
+
+inline Interval & operator += (Interval & u, const Interval & v) { return u = u + v; }
+inline Interval & operator -= (Interval & u, const Interval & v) { return u = u - v; }
+inline Interval & operator *= (Interval & u, const Interval & v) { return u = u * v; }
+inline Interval & operator /= (Interval & u, const Interval & v) { return u = u / v; }
+
+/**
+ * The comparisons of Intervals are certain: u < v means that every element of u is smaller than every element of v
+ * (so !(u < v) does not mean u >= v when the Intervals overlap).
+ */
+inline bool operator < (const Interval & u, const Interval & v) { return u.upper < v.lower; }
+inline bool operator > (const Interval & u, const Interval & v) { return v < u; }
+inline bool operator == (const Interval & u, const Interval & v) { return (u.lower == v.lower) && (u.upper == v.upper); }
+inline bool operator != (const Interval & u, const Interval & v) { return !(u == v); }
+
+/**
+ * Return the smallest Interval which contains both u and v.
+ */
+inline Interval hull(const Interval & u, const Interval & v) { return { std::fmin(u.lower, v.lower), std::fmax(u.upper, v.upper) }; }
+
+/**
+ * Return the range of x ^ 2 on x (which, unlike x * x, is never negative and is exact in the sign of the bounds).
+ */
+inline Interval square(const Interval & x)
+{
+    if (x.lower >= 0.0) return { roundedDown(x.lower * x.lower), roundedUp(x.upper * x.upper) };
+    if (x.upper <= 0.0) return { roundedDown(x.upper * x.upper), roundedUp(x.lower * x.lower) };
+    double largest = std::fmax(-x.lower, x.upper);
+    return { 0.0, roundedUp(largest * largest) };
+}
+
+/**
+ * Return the range of x ^ 3 on x (x ^ 3 is increasing, so only the two bounds are cubed, each with two outward roundings).
+ */
+inline Interval cube(const Interval & x)
+{
+    double lower_square = (x.lower >= 0.0) ? roundedDown(x.lower * x.lower) : roundedUp(x.lower * x.lower);
+    double upper_square = (x.upper >= 0.0) ? roundedUp(x.upper * x.upper) : roundedDown(x.upper * x.upper);
+    return { roundedDown(x.lower * lower_square), roundedUp(x.upper * upper_square) };
+}
+
+/**
+ * Return the range of the square root on x. IEEE 754 square roots are correctly rounded, so one unit in the last place is enough.
+ * The part of x which is below zero is ignored (and an Interval which is entirely below zero gives [NaN, NaN]).
+ */
+inline Interval sqrt(const Interval & x)
+{
+    if (x.upper < 0.0) return { NAN, NAN };
+    double lower = (x.lower > 0.0) ? std::fmax(0.0, roundedDown(std::sqrt(x.lower))) : 0.0;
+    return { lower, roundedUp(std::sqrt(x.upper)) };
+}
+
+inline Interval fabs(const Interval & x)
+{
+    if (x.lower >= 0.0) return x;
+    if (x.upper <= 0.0) return -x;
+    return { 0.0, std::fmax(-x.lower, x.upper) };
+}
+
+// Define the data type for an object which represents a single variable function evaluated on Intervals (which returns an Interval which contains f(x) for every x in its input).
+using IntervalFunction = std::function<Interval(const Interval &)>;
+
+/** function prototypes */
+Interval sine(const Interval & x);
+Interval cosine(const Interval & x);
+Interval arctangent(const Interval & x);
+Interval power_of_e_to_x(const Interval & x);
+Interval ln(const Interval & x);
+Interval logarithm(const Interval & x, const Interval & logarithmic_base);
+
+#endif // INTERVAL_H
@@ -0,0 +1,317 @@
+/**
+ * file: logarithm.h
+ * type: C++ (header file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+#ifndef LOGARITHM_H
+#define LOGARITHM_H
+
+/** preprocessing directives */
+#include <bit> // std::bit_cast
+#include <string> // std::string
+#define MAXIMUM_x 10000 // constant which represents maximum value of x
+#define MAXIMUM_logarithmic_base 10000 // constant which represents maximum value of logarithmic_base
+
+/** function prototypes */
+constexpr bool is_whole_number(double x);
+constexpr double absolute_value(double x);
+constexpr double power_of_e_to_x(double x);
+constexpr float ln(float x);
+constexpr double power(double base, double exponent);
+constexpr double logarithm(double x, double logarithmic_base);
+bool writeLogarithmTable(const std::string & file_name, const double * x, long long count, double logarithmic_base);
+double logarithmBaseTwo(double x);
+double logarithmBaseTen(double x);
+double logarithmOfOnePlus(double x);
+double powerOfTwoToX(double x);
+double powerOfEToXMinusOne(double x);
+void logarithmBaseTwoBatch(const double * x, double * y, long long count);
+void logarithmBaseTenBatch(const double * x, double * y, long long count);
+void logarithmOfOnePlusBatch(const double * x, double * y, long long count);
+void powerOfTwoToXBatch(const double * x, double * y, long long count);
+void powerOfEToXMinusOneBatch(const double * x, double * y, long long count);
+
+/**
+ * The kernels below are defined in this header (instead of in logarithm.cpp) and are constexpr, so that the compiler can evaluate them
+ * wherever their result initializes a constexpr variable (e.g. a table of powers is then stored in the program file and costs nothing
+ * at startup), while calls with run-time arguments compile to ordinary code.
+ */
+
+/**
+ * If x is determined to be a whole number, return true.
+ * Otherwise, return false.
+ * 
+ *--------------------------------------------------------------------------------------------------------------------
+ * 
+ * The following function was copied from the C++ source code file featured in the following tutorial web page:
+ * 
+ * https://karlinaobject.wordpress.com/exponentiation/
+ * 
+ *--------------------------------------------------------------------------------------------------------------------
+ */
+constexpr bool is_whole_number(double x)
+{
+    return (x == (long int) x); 
+}
+
+/**
+ * Return the absolute value of a real number input, x.
+ * 
+ *--------------------------------------------------------------------------------------------------------------------
+ * 
+ * The following function was copied from the C++ source code file featured in the following tutorial web page:
+ * 
+ * https://karlinaobject.wordpress.com/exponentiation/
+ * 
+ *--------------------------------------------------------------------------------------------------------------------
+ */
+constexpr double absolute_value(double x)
+{
+    if (x < 0) return -1 * x;
+    return x;
+}
+
+/**
+ * Return the approximate value of Euler's Number to the power of some real number x.
+ * 
+ * This function is essentially identical to the C++ library math.h function exp().
+ * 
+ *--------------------------------------------------------------------------------------------------------------------
+ * 
+ * The following function was copied from the C++ source code file featured in the following tutorial web page:
+ * 
+ * https://karlinaobject.wordpress.com/exponentiation/
+ * 
+ *--------------------------------------------------------------------------------------------------------------------
+ */
+constexpr double power_of_e_to_x(double x) {
+    double a = 1.0, e = a;
+    int n = 1;
+    int invert = x < 0;
+    x = absolute_value(x);
+    for (n = 1; e != e + a; n += 1) {
+        a = a * x / n;
+        e += a;
+    }
+    return invert ? (1 / e) : e;
+}
+
+/**
+ * Note that ln(x) below is an approximation (of the approximate tier, in the terms of accuracy_tiers.h): its absolute error is up to about
+ * 4.5e-4, so it keeps about three digits (and fewer significant digits of ln(x) for x close to 1, where ln(x) is close to zero).
+ * tieredLn<ACCURACY_APPROXIMATE>, tieredLn<ACCURACY_MEDIUM>, and tieredLn<ACCURACY_FULL> of accuracy_tiers.h select the accuracy explicitly.
+ */
+
+//--------------------------------------------------------------------------------------------------------------------
+// The following function and associated comments were not written by karbytes.
+//
+// The following function is essentially identical to the C++ library math.h function log().
+//
+//--------------------------------------------------------------------------------------------------------------------
+//
+// The following function was copied from the C++ source code file featured in the following tutorial web page:
+//
+// https://karlinaobject.wordpress.com/exponentiation/
+//
+//--------------------------------------------------------------------------------------------------------------------
+
+// ln.c
+//
+// simple, fast, accurate natural log approximation
+// when without 
+
+// featuring * floating point bit level hacking,
+//           * x=m*2^p => ln(x)=ln(m)+ln(2)p,
+//           * Remez algorithm
+
+// by Lingdong Huang, 2020. Public domain.
+
+// ============================================
+
+constexpr float ln(float x) {
+  unsigned int bx = std::bit_cast<unsigned int>(x);
+  unsigned int ex = bx >> 23;
+  signed int t = (signed int)ex-(signed int)127;
+  bx = 1065353216 | (bx & 8388607);
+  x = std::bit_cast<float>(bx);
+  return -1.49278+(2.11263+(-0.729104+0.10969*x)*x)*x+0.6931471806*t;
+}
+
+// done.
+
+//--------------------------------------------------------------------------------------------------------------------
+// End of code which was not written by karbytes. 
+//--------------------------------------------------------------------------------------------------------------------
+
+/**
+ * Reverse engineer the cmath pow() function 
+ * using the following properties of natural logarithms:
+ * 
+ * ln(x ^ y) = y * ln(x).
+ * 
+ * ln(e ^ x) = x. // e is approximately Euler's Number.
+ * 
+ * Note that the base of the logarithmic function 
+ * used by the cmath log() function is e.
+ * 
+ * Hence, log(x) is approximately the 
+ * natural log of x (i.e. ln(x)).
+ * 
+ * Note that the base of the exponential function
+ * used by the cmath exp() function is
+ * (approximately) Euler's Number.
+ * 
+ * Hence, exp(x) is approximately 
+ * x ^ e (where e is approximately Euler's Number).
+ * 
+ * Note that any number, x, raised to the power of 0 is 1.
+ * In more succinct terms, x ^ 0 = 1.
+ * 
+ * Note that any number, x, raised to the power of 1 is x.
+ * In more succinct terms, x ^ 1 = x.
+ * 
+ * Note that any whole number, x, 
+ * raised to the power of a positive whole number exponent, y, 
+ * is x multiplied by itself y times.
+ * For example, if x is 2 and y is 3, 
+ * 2 ^ 3 = power(2, 3) = 2 * 2 * 2 = 8.
+ * 
+ * Note that any whole number, x, 
+ * raised to the power of a negative exponent, y, 
+ * is 1 / (x ^ (-1 * y)).
+ * For example, if x is 2 and y is -3,
+ * 2 ^ -3 = power(2, -3) = 1 / (2 * 2 * 2) = 1 / 8 = 0.125.
+ * 
+ *----------------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * The following function was copied (and slightly edited) from the C++ source code file featured in the following tutorial web page:
+ * 
+ * https://karlinaobject.wordpress.com/exponentiation/
+ * 
+ * (The data types of the function parameters have been changed from double to float).
+ *
+ *----------------------------------------------------------------------------------------------------------------------------------------
+ */
+constexpr double power(double base, double exponent)
+{
+    double output = 1.0;
+    if (exponent == 0) return 1; 
+    if (exponent == 1) return base;
+    // if ((base == 0) && (exponent < 0)) return -666; // Technically 0 raised to the power of some negative exponent is undefined (i.e. not a number).
+    if (is_whole_number(exponent))
+    {
+        if (exponent > 0)
+        {
+            while (exponent > 0) 
+            {
+                output *= base;
+                exponent -= 1;
+            }
+            return output;
+        }
+        else 
+        {
+            exponent = absolute_value(exponent);
+            while (exponent > 0)
+            {
+                output *= base;
+                exponent -= 1;
+            }
+            return 1 / output;
+        }
+    }
+    if (exponent > 0) return power_of_e_to_x(ln(base) * exponent); // Return e ^ (ln(base) * exponent).
+    return power_of_e_to_x(power_of_e_to_x(ln(base) * absolute_value(exponent))); // Return e ^ (e ^ (ln(base) * absolute_value(exponent))).
+}
+
+// Function to compute logarithm base logarithmic_base of x
+
+/**
+ * This function returns the result of the following calculation: 
+ * log_b(x) where log_b is the logarithmic function whose base is b (and where b is logarithmic_base).
+ * 
+ * A logarithm is the inverse of exponentiation. 
+ * 
+ * For example, ln(x) = y is the inverse of (e ^ y) = x 
+ * given that the logarithmic base of the function ln(x) is Euler's Number, e 
+ * (which is approximately equal to 2.71828182845904524019865766693015984856174327433109283447265625).
+ * 
+ * Note that the base of a logarithm cannot be 1 because
+ * 
+ * log_1(x) = y implies (1 ^ y) = x only if x and y are identical and equal to 1.
+ * 
+ * log_1(2) = y implies (1 ^ y) = 2 when multiplying 1 by itself by any number of times should always yield the result 1; not 2 (or some other non-one number).
+ * 
+ * As an aside, any non-zero number to the power of zero is one due to the following:
+ * 
+ * Let a be any non-zero number. Then
+ * 
+ * (a ^ 3) = a * a * a
+ * 
+ * and 
+ * 
+ * (a ^ 2) = a * a
+ * 
+ * and 
+ * 
+ * (a ^ 1) = a.
+ * 
+ * Also, according to the rule of exponents, dividing a power by the base gives the next lower power. Hence,
+ * 
+ * (a ^ 2) = (a ^ 3) / a = (a ^ 2)
+ * 
+ * and
+ * 
+ * (a ^ 1) = (a ^ 2) / a
+ * 
+ * and, similarly,
+ * 
+ * (a ^ 0) = (a ^ 1) / a = a / a = 1.
+ * 
+ * ((0 ^ 1) = 0 * 1 = 0 but (0 ^ 0) = (0 ^ 1) / 0 = 0 / 0 which is technically "not a number").
+ * 
+ * (Dividing a number by zero is theoretically impossible while multiplying that number by zero (which results in zero) 
+ * is theoretically possible because to say that some number is multiplied by zero is logically equivalent to saying 
+ * that number occurs zero times. By contrast, dividing some number by zero is logically equivalent to saying that
+ * number is compartmentalized into zero equally-sized parts (and none of those parts apparently have any non-zero size and
+ * infinitely many of such parts take up any space of any size (whether that size is zero or some positive quantity))).
+ * 
+ *--------------------------------------------------------------------------------------------------------------------
+ * 
+ * An algorithm for computing the approximate value of Euler's Number is implemented by the C++ program 
+ * featured in the following tutorial web page:
+ * 
+ * https://karlinaobject.wordpress.com/eulers_number_approximation/
+ * 
+ *--------------------------------------------------------------------------------------------------------------------
+ * 
+ * Note that the equation (e ^ y) = x is functionally identical to power(e, y) = x 
+ * and essentially states that x is the product of multiplying e by itself y times.
+ * 
+ * x is required to be a positive real number.
+ * 
+ * logarithmic_base is required to be a positive real number other than one.
+ * 
+ * This function works by utilizing the following Change of Base (for Logarithms) formula:
+ * 
+ * log_b = ln(x) / ln(b)
+ *
+ * (For the bases 2 and 10, and for ln(1 + x) with x close to zero, the specialized functions logarithmBaseTwo, logarithmBaseTen,
+ * and logarithmOfOnePlus of logarithm.cpp are accurate to about one unit in the last place of a double, whereas ln is a float
+ * approximation whose result is off by up to about 0.00045. That accuracy has a cost for single calls: one call of logarithmBaseTen(x)
+ * (or logarithmBaseTwo(x)) is slower than one call of logarithm(x, 10), because each call of those functions also checks its range and
+ * handles subnormal values. For arrays, logarithmBaseTwoBatch and logarithmBaseTenBatch check the range in a vectorized loop without
+ * branches, so they are about as fast per value as logarithm(x, 10) and faster than both the accurate change of base
+ * logarithmKernel(x) / ln(10) and std::log10.
+ * benchmark_math_kernels prints the timings of each of those on the machine which runs it.)
+ */
+constexpr double logarithm(double x, double logarithmic_base) {
+    if ((x <= 0) || (x > MAXIMUM_x)) x = 1; // Set x to 1 by default if x is out of range.
+    if ((logarithmic_base <= 0) || (logarithmic_base == 1) || (logarithmic_base > MAXIMUM_logarithmic_base)) logarithmic_base = 2; // Set logarithmic_base to 2 if logarithmic_base is out of range.
+    return ln(x) / ln(logarithmic_base);
+}
+
+#endif // LOGARITHM_H
@@ -0,0 +1,134 @@
+/**
+ * file: logarithm_main.cpp
+ * type: C++ (source file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+/** preprocessing directives */
+#include <iostream> // standard input (std::cin), standard output (std::cout)
+#include "logarithm.h" // MAXIMUM_x, MAXIMUM_logarithmic_base, logarithm, power
+#include "tee_output.h" // TeeOutput
+#include "big_float.h" // BigFloat, DEFAULT_BIG_FLOAT_DIGITS
+
+/** program entry point */
+int main()
+{
+    // Define three double type variables for storing floating-point number values.
+    double x = 0.0, logarithmic_base = 0.0, result = 0.0;
+
+    // Declare a variable for storing the program user's answer of whether or not to continue inputting values.
+    int input_additional_values = 1;
+
+    /**
+     * If the file named logarithm_output.txt does not already exist 
+     * inside of the same file directory as the program, 
+     * create a new file named logarithm_output.txt in that directory.
+     * 
+     * Open the plain-text file named logarithm_output.txt
+     * and set that file to be overwritten with program data.
+     * 
+     * Every value which is printed through output is formatted only once (as the shortest decimal number which converts back 
+     * to exactly the same double) and is then copied to the command line terminal and to the (buffered) file output stream.
+     */
+    TeeOutput output("logarithm_output.txt");
+
+    // Print an opening message to the command line terminal.
+    output.console << "\n\n--------------------------------";
+    output.console << "\nStart Of Program";
+    output.console << "\n--------------------------------";
+
+    // Print an opening message to the file output stream.
+    output.file << "--------------------------------";
+    output.file << "\nStart Of Program";
+    output.file << "\n--------------------------------";
+
+    // Print "This C++ program computes the (approximate) logarithm of x in some given logarithmic base." to the command line terminal and to the file output stream.
+    output << "\n\nThis C++ program computes the (approximate) logarithm of x in some given logarithmic base.";
+
+    // Execute the code inside of the while loop block at least once (and until the program user inputs a value specifying to exit the program).
+    while (input_additional_values != 0)
+    {
+        // Print a horizontal divider line to the command line terminal and to the file output stream.
+        output << "\n\n--------------------------------";
+
+        // Prompt the user to enter an input value for x (and print that prompt to the command line terminal and to the file output stream).
+        output << "\n\nEnter a positive real number, x, to take the logarithm of and which is no larger than " << MAXIMUM_x << ": ";
+
+        // Scan the command line terminal for the most recent keyboard input value. Store that value in x.
+        std::cin >> x;
+
+        // Print "The value which was entered for x is {x}." to the command line terminal and to the file output stream.
+        output.console << "\nThe value which was entered for x is " << x << ".";
+        output.file << "\n\nThe value which was entered for x is " << x << ".";
+
+        // Print a horizontal divider line to the command line terminal and to the file output stream.
+        output << "\n\n--------------------------------";
+
+        // Prompt the user to enter an input value for logarithmic_base (and print that prompt to the command line terminal and to the file output stream).
+        output << "\n\nEnter a positive real number, logarithmic_base, which is a positive real number other than one and which is no larger than " << MAXIMUM_logarithmic_base << ": ";
+
+        // Scan the command line terminal for the most recent keyboard input value. Store that value in logarithmic_base.
+        std::cin >> logarithmic_base;
+
+        // Print "The value which was entered for logarithmic_base is {logarithmic_base}." to the command line terminal and to the file output stream.
+        output.console << "\nThe value which was entered for logarithmic_base is " << logarithmic_base << ".";
+        output.file << "\n\nThe value which was entered for logarithmic_base is " << logarithmic_base << ".";
+
+        // Print a horizontal divider line to the command line terminal and to the file output stream.
+        output << "\n\n--------------------------------";
+
+        // Set x to 1 by default if x is out of range (and specify that such a change occurred in the command line terminal and output file stream).
+        if ((x <= 0) || (x > MAXIMUM_x)) 
+        {
+            x = 1; 
+            output << "\n\nDue to fact that x was determined to be either less than or equal to zero or else greater than " << MAXIMUM_x << ", x was set to the default value 1.";
+        }
+
+        // Set logarithmic_base to 2 if logarithmic_base is out of range (and specify that such a change occurred in the command line terminal and output file stream).
+        if ((logarithmic_base <= 0) || (logarithmic_base == 1) || (logarithmic_base > MAXIMUM_logarithmic_base)) 
+        {
+            logarithmic_base = 2; 
+            output << "\n\nDue to fact that logarithmic_base was determined to be either less than or equal to zero or else equal to one or else greater than " << MAXIMUM_logarithmic_base << ", logarithmic_base was set to the default value 2.";
+        }
+
+        // Obtain the result of log_b(x) where b is logarithmic_base.
+        result = logarithm(x, logarithmic_base);
+
+        // Print the result of the logarithmic function to the command line terminal and to the file output stream.
+        output << "\n\nresult = logarithm(x, logarithmic_base) = logarithm(" << x << ", " << logarithmic_base << ") = " << result << ".";
+
+        // Print the same logarithm to DEFAULT_BIG_FLOAT_DIGITS correct significant digits (computed with BigFloat arithmetic instead of double arithmetic).
+        output << "\n\nlogarithm(BigFloat(x), BigFloat(logarithmic_base)) = " << logarithm(BigFloat(x), BigFloat(logarithmic_base)).toString(DEFAULT_BIG_FLOAT_DIGITS) << ". // to " << DEFAULT_BIG_FLOAT_DIGITS << " significant digits";
+
+        // Print the inverse of the logarithmic expression to the command line terminal and to the file output stream.
+        output << "\n\nx = logarithmic_base ^ result --> " << x << " = " << logarithmic_base << " ^ " << result << ".";
+        output << "\n\nx = power(logarithmic_base, result) = power(" << logarithmic_base << ", " << result << ") = " << power(logarithmic_base, result) << ".";
+
+        // Print a horizontal divider line to the command line terminal and to the file output stream.
+        output << "\n\n--------------------------------";
+
+        // Ask the user whether or not to continue inputing values.
+        output.console << "\n\nWould you like to continue inputting program values? (Enter 1 if YES. Enter 0 if NO): ";
+
+        // Scan the command line terminal for the most recent keyboard input value.
+        std::cin >> input_additional_values;
+    }
+
+    // Print a closing message to the command line terminal.
+    output.console << "\n\n--------------------------------";
+    output.console << "\nEnd Of Program";
+    output.console << "\n--------------------------------\n\n";
+
+    // Print a closing message to the file output stream.
+    output.file << "\n\n--------------------------------";
+    output.file << "\nEnd Of Program";
+    output.file << "\n--------------------------------";
+
+    // Write the remaining buffered program data to the file output stream and close that file.
+    output.close();
+
+    // Exit the program.
+    return 0; 
+}
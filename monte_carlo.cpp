@@ -0,0 +1,441 @@
+/**
+ * file: monte_carlo.cpp
+ * type: C++ (source file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+/** preprocessing directives */
+#include <iostream> // standard output (std::cout)
+#include <cmath> // std::sqrt
+#include "monte_carlo.h" // MonteCarloOptions, MonteCarloResult, PhiloxGenerator, function prototypes
+#define MONTE_CARLO_CHUNK_LENGTH 4096 // constant which represents the number of samples in one chunk of work (the partial sums of the chunks are added in chunk order)
+#define PHILOX_M0 0xD2511F53u // constant which represents the first Philox multiplier
+#define PHILOX_M1 0xCD9E8D57u // constant which represents the second Philox multiplier
+#define PHILOX_W0 0x9E3779B9u // constant which represents the first Philox key increment (the golden ratio)
+#define PHILOX_W1 0xBB67AE85u // constant which represents the second Philox key increment (sqrt(3) - 1)
+
+/**
+ * Store the four random 32-bit integers which Philox4x32-10 assigns to the 128-bit counter (counter_high, counter_low) in output.
+ */
+void PhiloxGenerator::generate(std::uint64_t counter_low, std::uint64_t counter_high, std::uint32_t output[4]) const
+{
+    std::uint32_t c0 = static_cast<std::uint32_t>(counter_low), c1 = static_cast<std::uint32_t>(counter_low >> 32);
+    std::uint32_t c2 = static_cast<std::uint32_t>(counter_high), c3 = static_cast<std::uint32_t>(counter_high >> 32);
+    std::uint32_t k0 = key[0], k1 = key[1];
+    for (int round = 0; round < 10; round += 1)
+    {
+        std::uint64_t product0 = static_cast<std::uint64_t>(PHILOX_M0) * c0;
+        std::uint64_t product1 = static_cast<std::uint64_t>(PHILOX_M1) * c2;
+        std::uint32_t n0 = static_cast<std::uint32_t>(product1 >> 32) ^ c1 ^ k0;
+        std::uint32_t n1 = static_cast<std::uint32_t>(product1);
+        std::uint32_t n2 = static_cast<std::uint32_t>(product0 >> 32) ^ c3 ^ k1;
+        std::uint32_t n3 = static_cast<std::uint32_t>(product0);
+        c0 = n0;
+        c1 = n1;
+        c2 = n2;
+        c3 = n3;
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+    output[0] = c0;
+    output[1] = c1;
+    output[2] = c2;
+    output[3] = c3;
+}
+
+/**
+ * Store count uniform random numbers in the open interval (0, 1) which belong to sample number index in u[0], u[1], ..., u[count - 1].
+ *
+ * Each number has 53 random bits (the full precision of a double). Neither 0 nor 1 is ever produced (so an integrand which is
+ * singular at the boundary of its box is never evaluated at that boundary).
+ */
+void PhiloxGenerator::uniform(std::uint64_t index, int count, double * u) const
+{
+    std::uint32_t bits[4];
+    for (int d = 0; d < count; d += 2)
+    {
+        generate(index, static_cast<std::uint64_t>(d / 2), bits);
+        u[d] = ((static_cast<std::uint64_t>(bits[0] >> 5) << 26 | (bits[1] >> 6)) + 0.5) * (1.0 / 9007199254740992.0);
+        if (d + 1 < count) u[d + 1] = ((static_cast<std::uint64_t>(bits[2] >> 5) << 26 | (bits[3] >> 6)) + 0.5) * (1.0 / 9007199254740992.0);
+    }
+}
+
+/**
+ * Return the table of Sobol direction numbers (32 per axis) for the first MAXIMUM_SOBOL_DIMENSIONS axes.
+ *
+ * The primitive polynomials (degree s, coefficients a) and the initial direction numbers m are those of
+ * S. Joe and F. Y. Kuo, "Constructing Sobol sequences with better two-dimensional projections" (new-joe-kuo-6.21201).
+ */
+static const std::vector<std::vector<std::uint32_t>> & sobolDirections()
+{
+    struct Polynomial { int s; unsigned a; unsigned m[6]; };
+    static const Polynomial polynomials[MAXIMUM_SOBOL_DIMENSIONS - 1] = {
+        { 1, 0, { 1 } },
+        { 2, 1, { 1, 3 } },
+        { 3, 1, { 1, 3, 1 } },
+        { 3, 2, { 1, 1, 1 } },
+        { 4, 1, { 1, 1, 3, 3 } },
+        { 4, 4, { 1, 3, 5, 13 } },
+        { 5, 2, { 1, 1, 5, 5, 17 } },
+        { 5, 4, { 1, 1, 5, 5, 5 } },
+        { 5, 7, { 1, 1, 7, 11, 19 } },
+        { 5, 11, { 1, 1, 5, 1, 1 } },
+        { 5, 13, { 1, 1, 1, 3, 11 } },
+        { 5, 14, { 1, 3, 5, 5, 31 } },
+        { 6, 1, { 1, 3, 3, 9, 7, 49 } },
+        { 6, 13, { 1, 1, 1, 15, 21, 21 } },
+        { 6, 16, { 1, 3, 1, 13, 27, 49 } }
+    };
+
+    static const std::vector<std::vector<std::uint32_t>> directions = []()
+    {
+        std::vector<std::vector<std::uint32_t>> v(MAXIMUM_SOBOL_DIMENSIONS, std::vector<std::uint32_t>(32));
+
+        // The first axis is the van der Corput sequence in base 2.
+        for (int j = 0; j < 32; j += 1) v[0][j] = 1u << (31 - j);
+
+        for (int d = 1; d < MAXIMUM_SOBOL_DIMENSIONS; d += 1)
+        {
+            const Polynomial & p = polynomials[d - 1];
+            for (int j = 0; j < p.s; j += 1) v[d][j] = p.m[j] << (31 - j);
+            for (int j = p.s; j < 32; j += 1)
+            {
+                v[d][j] = v[d][j - p.s] ^ (v[d][j - p.s] >> p.s);
+                for (int k = 1; k < p.s; k += 1) if ((p.a >> (p.s - 1 - k)) & 1u) v[d][j] ^= v[d][j - k];
+            }
+        }
+        return v;
+    }();
+    return directions;
+}
+
+/**
+ * Store the 32-bit integer coordinates (i.e. the coordinates times 2 ^ 32) of the point number index of the Sobol sequence
+ * in x[0], x[1], ..., x[dimensions - 1].
+ */
+static void sobolIntegers(std::uint64_t index, int dimensions, std::uint32_t * x)
+{
+    const std::vector<std::vector<std::uint32_t>> & v = sobolDirections();
+    std::uint32_t gray = static_cast<std::uint32_t>(index ^ (index >> 1));
+    for (int d = 0; d < dimensions; d += 1)
+    {
+        x[d] = 0;
+        for (std::uint32_t bits = gray; bits != 0; bits &= bits - 1) x[d] ^= v[d][__builtin_ctz(bits)];
+    }
+}
+
+/**
+ * Store the point number index of the Sobol sequence (in the unit cube [0, 1) ^ dimensions) in u[0], u[1], ..., u[dimensions - 1].
+ *
+ * The point is computed directly from the Gray code of index (so any index can be generated by any thread).
+ */
+void sobolPoint(std::uint64_t index, int dimensions, double * u)
+{
+    std::uint32_t x[MAXIMUM_SOBOL_DIMENSIONS];
+    sobolIntegers(index, dimensions, x);
+    for (int d = 0; d < dimensions; d += 1) u[d] = x[d] * (1.0 / 4294967296.0);
+}
+
+/**
+ * Return the first MAXIMUM_MONTE_CARLO_DIMENSIONS prime numbers (the bases of the Halton sequence).
+ */
+static const std::vector<std::uint64_t> & haltonBases()
+{
+    static const std::vector<std::uint64_t> primes = []()
+    {
+        std::vector<std::uint64_t> p;
+        for (std::uint64_t candidate = 2; p.size() < MAXIMUM_MONTE_CARLO_DIMENSIONS; candidate += 1)
+        {
+            bool is_prime = true;
+            for (std::uint64_t q : p) if (candidate % q == 0) { is_prime = false; break; }
+            if (is_prime) p.push_back(candidate);
+        }
+        return p;
+    }();
+    return primes;
+}
+
+/**
+ * Store the point number index of the Halton sequence (in the unit cube (0, 1) ^ dimensions) in u[0], u[1], ..., u[dimensions - 1].
+ *
+ * Coordinate d is the radical inverse of index + 1 in the base of the (d + 1)th prime number.
+ */
+void haltonPoint(std::uint64_t index, int dimensions, double * u)
+{
+    const std::vector<std::uint64_t> & bases = haltonBases();
+    for (int d = 0; d < dimensions; d += 1)
+    {
+        std::uint64_t base = bases[d], i = index + 1;
+        double inverse_base = 1.0 / base, scale = inverse_base, result = 0.0;
+        while (i > 0)
+        {
+            result += (i % base) * scale;
+            i /= base;
+            scale *= inverse_base;
+        }
+        u[d] = result;
+    }
+}
+
+/**
+ * Define a struct-type variable named SampleStatistics which stores the number, the mean, and the sum of squared deviations
+ * from the mean (M2) of a set of samples (which can be combined without loss of precision by Chan's formula).
+ */
+struct SampleStatistics {
+    double count = 0.0;
+    double mean = 0.0;
+    double m2 = 0.0;
+
+    void add(double y)
+    {
+        count += 1;
+        double delta = y - mean;
+        mean += delta / count;
+        m2 += delta * (y - mean);
+    }
+
+    void combine(const SampleStatistics & other)
+    {
+        if (other.count == 0) return;
+        double total = count + other.count;
+        double delta = other.mean - mean;
+        mean += delta * (other.count / total);
+        m2 += other.m2 + delta * delta * (count * other.count / total);
+        count = total;
+    }
+};
+
+/**
+ * Run body(first, end) over [0, count) in chunks of chunk_length on pool (or on the calling thread if pool is nullptr).
+ */
+static void forEachChunk(ThreadPool * pool, long long count, long long chunk_length, const std::function<void(long long first, long long end)> & body)
+{
+    if (pool != nullptr) pool->parallelFor(count, chunk_length, body);
+    else if (count > 0) body(0, count);
+}
+
+/**
+ * This function estimates the integral of a multi-variable function, y = f(x_0, x_1, ..., x_(d - 1)), over the box
+ * [box[0].a, box[0].b] x [box[1].a, box[1].b] x ... by averaging f at sample points of that box and multiplying that
+ * average by the volume of the box. (The partition count n of each Parameters value is not used.)
+ *
+ * Unlike computeMultipleRiemannSum (whose number of evaluations is the product of the partition counts of all axes), the
+ * number of evaluations is options.samples for any number of axes, and the error of the estimate does not depend on the
+ * number of axes.
+ *
+ * The returned standard error is computed from the sample variance (pseudo-random points), from the variance of the
+ * strata (stratified sampling), or from the spread of options.replicates randomly shifted copies of the quasi-random
+ * point set (Sobol and Halton points, which have no sample variance of their own).
+ *
+ * If the input values are out of range, an error message is printed to the command line terminal and a result of zero is returned.
+ */
+MonteCarloResult integrateMonteCarlo(const MultivariableFunction & func, const std::vector<Parameters> & box, const MonteCarloOptions & options)
+{
+    MonteCarloResult result = { 0.0, 0.0, 0 };
+    const int dimensions = static_cast<int>(box.size());
+    if ((dimensions < 1) || (dimensions > MAXIMUM_MONTE_CARLO_DIMENSIONS))
+    {
+        std::cout << "\n\nInvalid number of axes. The number of axes is required to be within range [1," << MAXIMUM_MONTE_CARLO_DIMENSIONS << "].";
+        return result;
+    }
+    if (options.samples < 2)
+    {
+        std::cout << "\n\nInvalid number of samples. The number of samples is required to be at least 2.";
+        return result;
+    }
+    MonteCarloSampler sampler = options.sampler;
+    if ((sampler == MONTE_CARLO_SOBOL) && (dimensions > MAXIMUM_SOBOL_DIMENSIONS))
+    {
+        std::cout << "\n\nSobol points are only available for up to " << MAXIMUM_SOBOL_DIMENSIONS << " axes. Hence, Halton points are used instead.";
+        sampler = MONTE_CARLO_HALTON;
+    }
+
+    // Compute the volume of the box.
+    double volume = 1.0;
+    for (const Parameters & axis : box) volume *= (axis.b - axis.a);
+
+    const PhiloxGenerator generator(options.seed);
+    const std::vector<std::vector<std::uint32_t>> & directions = sobolDirections();
+
+    // Evaluate func at the point of the box which corresponds to the point u of the unit cube.
+    auto evaluate = [&](const double * u)
+    {
+        double x[MAXIMUM_MONTE_CARLO_DIMENSIONS];
+        for (int d = 0; d < dimensions; d += 1) x[d] = box[d].a + u[d] * (box[d].b - box[d].a);
+        return func(x);
+    };
+
+    /**
+     * Quasi-random points: each of the R replicates shifts the same point set by its own random vector (modulo 1), which
+     * turns the deterministic sequence into R independent, unbiased estimates.
+     */
+    if ((sampler == MONTE_CARLO_SOBOL) || (sampler == MONTE_CARLO_HALTON))
+    {
+        long long replicates = (options.replicates < 2) ? 2 : options.replicates;
+        long long points = options.samples / replicates;
+        if (points < 1) points = 1;
+
+        // The Sobol direction numbers have 32 bits, so a Sobol point set repeats after 2 ^ 32 points.
+        if ((sampler == MONTE_CARLO_SOBOL) && (points > 4294967296LL)) points = 4294967296LL;
+        long long chunks_per_replicate = (points + MONTE_CARLO_CHUNK_LENGTH - 1) / MONTE_CARLO_CHUNK_LENGTH;
+        std::vector<double> partial_sums(static_cast<std::size_t>(replicates * chunks_per_replicate), 0.0);
+
+        forEachChunk(options.pool, replicates * chunks_per_replicate, 1, [&](long long first, long long end)
+        {
+            double shift[MAXIMUM_MONTE_CARLO_DIMENSIONS], u[MAXIMUM_MONTE_CARLO_DIMENSIONS];
+            for (long long work = first; work < end; work += 1)
+            {
+                long long replicate = work / chunks_per_replicate, chunk = work % chunks_per_replicate;
+                generator.uniform(~static_cast<std::uint64_t>(replicate), dimensions, shift);
+                long long begin_point = chunk * MONTE_CARLO_CHUNK_LENGTH;
+                long long end_point = (begin_point + MONTE_CARLO_CHUNK_LENGTH < points) ? (begin_point + MONTE_CARLO_CHUNK_LENGTH) : points;
+                double sum = 0.0;
+
+                // Consecutive Sobol points (in Gray code order) differ by one direction number per axis, so only the first point of the chunk is computed directly.
+                std::uint32_t sobol[MAXIMUM_SOBOL_DIMENSIONS];
+                if (sampler == MONTE_CARLO_SOBOL) sobolIntegers(static_cast<std::uint64_t>(begin_point), dimensions, sobol);
+                for (long long i = begin_point; i < end_point; i += 1)
+                {
+                    if (sampler == MONTE_CARLO_SOBOL)
+                    {
+                        if (i > begin_point)
+                        {
+                            int j = __builtin_ctzll(static_cast<unsigned long long>(i));
+                            for (int d = 0; d < dimensions; d += 1) sobol[d] ^= directions[d][j];
+                        }
+                        for (int d = 0; d < dimensions; d += 1) u[d] = sobol[d] * (1.0 / 4294967296.0);
+                    }
+                    else haltonPoint(static_cast<std::uint64_t>(i), dimensions, u);
+                    for (int d = 0; d < dimensions; d += 1)
+                    {
+                        u[d] += shift[d];
+                        if (u[d] >= 1.0) u[d] -= 1.0;
+                    }
+                    sum += evaluate(u);
+                }
+                partial_sums[static_cast<std::size_t>(work)] = sum;
+            }
+        });
+
+        SampleStatistics statistics;
+        for (long long replicate = 0; replicate < replicates; replicate += 1)
+        {
+            double sum = 0.0;
+            for (long long chunk = 0; chunk < chunks_per_replicate; chunk += 1) sum += partial_sums[static_cast<std::size_t>(replicate * chunks_per_replicate + chunk)];
+            statistics.add(sum / points);
+        }
+        result.estimate = volume * statistics.mean;
+        result.standard_error = volume * std::sqrt(statistics.m2 / (replicates - 1) / replicates);
+        result.evaluations = replicates * points;
+        return result;
+    }
+
+    // Pseudo-random points: one unit is one point (or one antithetic pair of points, whose mean is the sample).
+    const long long evaluations_per_unit = options.antithetic ? 2 : 1;
+    long long units = options.samples / evaluations_per_unit;
+    if (units < 2) units = 2;
+
+    auto sampleUnit = [&](std::uint64_t index, const long long * cell, long long strata_per_axis)
+    {
+        double u[MAXIMUM_MONTE_CARLO_DIMENSIONS], mirror[MAXIMUM_MONTE_CARLO_DIMENSIONS];
+        generator.uniform(index, dimensions, u);
+        for (int d = 0; d < dimensions; d += 1)
+        {
+            mirror[d] = (cell[d] + (1.0 - u[d])) / strata_per_axis;
+            u[d] = (cell[d] + u[d]) / strata_per_axis;
+        }
+        if (!options.antithetic) return evaluate(u);
+        return 0.5 * (evaluate(u) + evaluate(mirror));
+    };
+
+    // Determine the number of strata per axis (at least two units are needed in every one of the strata_per_axis ^ d boxes).
+    long long strata_per_axis = (options.strata_per_axis < 1) ? 1 : options.strata_per_axis;
+    long long strata = 1;
+    while (strata_per_axis > 1)
+    {
+        strata = 1;
+        for (int d = 0; (d < dimensions) && (strata <= units); d += 1) strata *= strata_per_axis;
+        if (strata * 2 <= units) break;
+        strata_per_axis -= 1;
+    }
+    if (strata_per_axis <= 1) strata = 1;
+    if ((options.strata_per_axis > 1) && (strata_per_axis != options.strata_per_axis))
+    {
+        std::cout << "\n\nThe number of strata per axis was too large for the number of samples. Hence, it has been reduced to " << strata_per_axis << ".";
+    }
+
+    if (strata == 1)
+    {
+        // Plain (or antithetic) sampling: combine the sample statistics of the chunks in chunk order.
+        long long chunks = (units + MONTE_CARLO_CHUNK_LENGTH - 1) / MONTE_CARLO_CHUNK_LENGTH;
+        std::vector<SampleStatistics> partial_statistics(static_cast<std::size_t>(chunks));
+        forEachChunk(options.pool, chunks, 1, [&](long long first, long long end)
+        {
+            const long long cell[MAXIMUM_MONTE_CARLO_DIMENSIONS] = { 0 };
+            for (long long chunk = first; chunk < end; chunk += 1)
+            {
+                long long begin_unit = chunk * MONTE_CARLO_CHUNK_LENGTH;
+                long long end_unit = (begin_unit + MONTE_CARLO_CHUNK_LENGTH < units) ? (begin_unit + MONTE_CARLO_CHUNK_LENGTH) : units;
+                SampleStatistics statistics;
+                for (long long i = begin_unit; i < end_unit; i += 1) statistics.add(sampleUnit(static_cast<std::uint64_t>(i), cell, 1));
+                partial_statistics[static_cast<std::size_t>(chunk)] = statistics;
+            }
+        });
+
+        SampleStatistics statistics;
+        for (const SampleStatistics & partial : partial_statistics) statistics.combine(partial);
+        result.estimate = volume * statistics.mean;
+        result.standard_error = volume * std::sqrt(statistics.m2 / (statistics.count - 1) / statistics.count);
+        result.evaluations = units * evaluations_per_unit;
+        return result;
+    }
+
+    /**
+     * Stratified sampling: each of the strata receives the same number, m, of units. The estimate is the mean of the
+     * stratum means, and its variance is the sum of the stratum variances divided by m * strata ^ 2.
+     */
+    const long long m = units / strata;
+    std::vector<double> stratum_means(static_cast<std::size_t>(strata)), stratum_variances(static_cast<std::size_t>(strata));
+    long long strata_per_chunk = MONTE_CARLO_CHUNK_LENGTH / m;
+    if (strata_per_chunk < 1) strata_per_chunk = 1;
+    forEachChunk(options.pool, strata, strata_per_chunk, [&](long long first, long long end)
+    {
+        long long cell[MAXIMUM_MONTE_CARLO_DIMENSIONS] = { 0 };
+        for (long long h = first; h < end; h += 1)
+        {
+            long long remainder = h;
+            for (int d = 0; d < dimensions; d += 1)
+            {
+                cell[d] = remainder % strata_per_axis;
+                remainder /= strata_per_axis;
+            }
+            SampleStatistics statistics;
+            for (long long j = 0; j < m; j += 1) statistics.add(sampleUnit(static_cast<std::uint64_t>(h * m + j), cell, strata_per_axis));
+            stratum_means[static_cast<std::size_t>(h)] = statistics.mean;
+            stratum_variances[static_cast<std::size_t>(h)] = statistics.m2 / (m - 1);
+        }
+    });
+
+    double sum_of_means = 0.0, sum_of_variances = 0.0;
+    for (long long h = 0; h < strata; h += 1)
+    {
+        sum_of_means += stratum_means[static_cast<std::size_t>(h)];
+        sum_of_variances += stratum_variances[static_cast<std::size_t>(h)];
+    }
+    result.estimate = volume * sum_of_means / strata;
+    result.standard_error = volume * std::sqrt(sum_of_variances / m) / strata;
+    result.evaluations = strata * m * evaluations_per_unit;
+    return result;
+}
+
+/**
+ * This function estimates the integral of a single variable function, y = f(x), on the x-axis interval [a,b]
+ * (using the same options as the multi-variable version).
+ */
+MonteCarloResult integrateMonteCarlo(Function func, double a, double b, const MonteCarloOptions & options)
+{
+    MultivariableFunction wrapper = [&func](const double * point) { return func(point[0]); };
+    return integrateMonteCarlo(wrapper, { { a, b, 1 } }, options);
+}
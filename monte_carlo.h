@@ -0,0 +1,92 @@
+/**
+ * file: monte_carlo.h
+ * type: C++ (header file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+#ifndef MONTE_CARLO_H
+#define MONTE_CARLO_H
+
+/** preprocessing directives */
+#include <cstdint> // std::uint32_t, std::uint64_t
+#include <vector> // std::vector
+#include "reimann_sum.h" // Function, MultivariableFunction, Parameters
+#include "thread_pool.h" // ThreadPool
+#define MAXIMUM_MONTE_CARLO_DIMENSIONS 64 // constant which represents the maximum number of axes of a Monte Carlo integral
+#define MAXIMUM_SOBOL_DIMENSIONS 16 // constant which represents the number of axes for which Sobol direction numbers are stored
+#define DEFAULT_MONTE_CARLO_SAMPLES 1000000 // constant which represents the default number of function evaluations of a Monte Carlo integral
+#define DEFAULT_MONTE_CARLO_SEED 20241021 // constant which represents the default seed of a Monte Carlo integral
+#define DEFAULT_QUASI_MONTE_CARLO_REPLICATES 16 // constant which represents the default number of randomly shifted copies of a quasi-random point set
+
+/**
+ * The three ways in which a Monte Carlo integral can choose its sample points:
+ *
+ * MONTE_CARLO_PSEUDO_RANDOM: independent uniform points from the counter-based PhiloxGenerator
+ *                            (error decreases like 1 / sqrt(samples)).
+ * MONTE_CARLO_SOBOL: the Sobol low-discrepancy sequence (at most MAXIMUM_SOBOL_DIMENSIONS axes).
+ * MONTE_CARLO_HALTON: the Halton low-discrepancy sequence (one prime base per axis).
+ *
+ * For a smooth integrand, the error of the two quasi-random sequences decreases almost like 1 / samples.
+ */
+enum MonteCarloSampler { MONTE_CARLO_PSEUDO_RANDOM, MONTE_CARLO_SOBOL, MONTE_CARLO_HALTON };
+
+/**
+ * Define a struct-type variable named MonteCarloOptions which stores the settings of one Monte Carlo integral
+ * where samples is the (approximate) number of function evaluations,
+ * where sampler chooses the sample points,
+ * where seed makes the result reproducible (the same seed gives the same result for any number of threads),
+ * where antithetic also evaluates the mirror image, 1 - u, of every pseudo-random point u,
+ * where strata_per_axis divides each axis into that many strata and samples each of the strata_per_axis ^ d boxes equally,
+ * where replicates is the number of randomly shifted copies of a quasi-random point set (which provide the standard error),
+ * and where pool (if not nullptr) spreads the samples over the threads of that ThreadPool.
+ *
+ * antithetic and strata_per_axis only apply to MONTE_CARLO_PSEUDO_RANDOM.
+ */
+struct MonteCarloOptions {
+    long long samples = DEFAULT_MONTE_CARLO_SAMPLES;
+    MonteCarloSampler sampler = MONTE_CARLO_PSEUDO_RANDOM;
+    std::uint64_t seed = DEFAULT_MONTE_CARLO_SEED;
+    bool antithetic = false;
+    int strata_per_axis = 1;
+    int replicates = DEFAULT_QUASI_MONTE_CARLO_REPLICATES;
+    ThreadPool * pool = nullptr;
+};
+
+/**
+ * Define a struct-type variable named MonteCarloResult which stores the estimate of an integral,
+ * the standard error of that estimate (i.e. the estimated standard deviation of the estimate),
+ * and the number of function evaluations which were used.
+ */
+struct MonteCarloResult {
+    double estimate;
+    double standard_error;
+    long long evaluations;
+};
+
+/**
+ * A PhiloxGenerator is the Philox4x32-10 counter-based random number generator: each (counter, key) pair is mapped to four
+ * independent random 32-bit integers by ten rounds of multiplications and exclusive-ors.
+ *
+ * Because the output depends only on the counter (and not on previously generated values), the random numbers of sample
+ * number i can be generated on any thread, in any order, which makes a parallel Monte Carlo integral reproducible.
+ */
+class PhiloxGenerator
+{
+public:
+    explicit PhiloxGenerator(std::uint64_t seed) : key{ static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32) } {}
+    void generate(std::uint64_t counter_low, std::uint64_t counter_high, std::uint32_t output[4]) const;
+    void uniform(std::uint64_t index, int count, double * u) const;
+
+private:
+    std::uint32_t key[2];
+};
+
+/** function prototypes */
+MonteCarloResult integrateMonteCarlo(const MultivariableFunction & func, const std::vector<Parameters> & box, const MonteCarloOptions & options = MonteCarloOptions());
+MonteCarloResult integrateMonteCarlo(Function func, double a, double b, const MonteCarloOptions & options = MonteCarloOptions());
+void sobolPoint(std::uint64_t index, int dimensions, double * u);
+void haltonPoint(std::uint64_t index, int dimensions, double * u);
+
+#endif // MONTE_CARLO_H
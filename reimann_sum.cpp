@@ -7,134 +7,152 @@
  */
 
 /** preprocessing directives */
-#include <iostream> // standard input (std::cin), standard output (std::cout)
-#include <fstream> // file input, file output, file open, file close
-#include <cmath> // sine function (sin(x)), cosine function (cos(x)), square root function (sqrt(x))
-#include <functional> // define custom Function type
-#define MINIMUM_a -999 // constant which represents the minimum a value
-#define MAXIMUM_a 999 // constant which represents the maximum a value
-// #define MINIMUM_b -999 // constant which represents the minimum b value
-// #define MAXIMUM_b 999 // constant which represents the maximum b value
-// #define MINIMUM_n 1 // constant which represents the minimum n value
-// #define MAXIMUM_n 999 // constant which represents the maximum n value
-
-// Define the data type for an object which represents a single variable function.
-using Function = std::function<double(double)>;
-
-/** 
- * Define a struct-type variable named Parameters which stores the three variables needed to take the Reimann Sum 
- * of some single-variable function (whose dependent variable is x) over some positive-length interval of the x-axis
- * of a Cartesian grid
- * where the left end of that interval is represented by a double-type variable named a,
- * where the right end of that interval is represented by a double-type variable named b,
- * and where the natural number of times which that interval is divided into equally-sized partitions 
- * is represented by an int-type variable named n.
- */
-struct Parameters { 
-    double a; 
-    double b; 
-    int n; 
-};
-
-/** function prototypes */
-double computeRiemannSum(Function func, double a, double b, int n, const std::string& method, std::ofstream & file);
-Function selectFunctionFromListOfFunctions(std::ofstream & file);
-Parameters selectPartitioningValues(std::ofstream & file);
-std::string selectRectangleConstructionMethod(std::ofstream & file);
-
-/** program entry point */
-int main() {
-
-    // Declare a file output stream object.
-    std::ofstream file;
+#include <iostream> // standard output (std::cout)
+#include <cmath> // std::fmin, INFINITY
+#include "reimann_sum.h" // Function, MINIMUM_RIEMANN_SUM_a, MAXIMUM_RIEMANN_SUM_a, MAXIMUM_RIEMANN_SUM_n, function prototypes
+#include "columnar_table.h" // ColumnarTable
 
-    // Set the number of digits of floating-point numbers which are printed to the command line terminal to 100 digits.
-    std::cout.precision(100);
-
-    // Set the number of digits of floating-point numbers which are printed to the file output stream to 100 digits.
-    file.precision(100);
+/**
+ * The following code struct definition was slightly modified after being copied from the C++ source code file 
+ * featured on the following tutorial web page:
+ * 
+ * https://karbytesforlifeblog.wordpress.com/reimann_sum/
+ *-------------------------------------------------------------------------------------------------------------------
+ * This function computes the Reimann sum for some arbitrary interval of the x-axis, 
+ * some arbitrary number of equally sized partitions of the x-axis, 
+ * some arbitrary single variable function (whose dependent variable is x), 
+ * and the option to generate rectangles whose left sides either align with 
+ * the left end point, 
+ * right end point, 
+ * or middle point of that rectangle's respective x-axis partition.
+ */
+double computeRiemannSum(Function func, double a, double b, int n, const std::string& method) 
+{
+    // Initialize sum, dx, and x to each store the value zero.
+    double sum = 0.0, dx = 0.0, x = 0.0;
 
     /**
-     * If the file named reimann_sum_output.txt does not already exist 
-     * inside of the same file directory as the file named reimann_sum.cpp, 
-     * create a new file named reimann_sum_output.txt in that directory.
-     * 
-     * Open the plain-text file named reimann_sum_output.txt
-     * and set that file to be overwritten with program data.
+     * Print an error message to the console window (and output file) if
+     * a is smaller than MINIMUM_RIEMANN_SUM_a or if
+     * a is larger than MAXIMUM_RIEMANN_SUM_a
+     * and exit the function by returning zero.
      */
-    file.open("reimann_sum_output.txt");
-
-    // Print an opening message to the command line terminal.
-    std::cout << "\n\n--------------------------------";
-    std::cout << "\nStart Of Program";
-    std::cout << "\n--------------------------------";
-
-    // Print an opening message to the file output stream.
-    file << "--------------------------------";
-    file << "\nStart Of Program";
-    file << "\n--------------------------------";
+    if ((a < MINIMUM_RIEMANN_SUM_a) || (a > MAXIMUM_RIEMANN_SUM_a))
+    {
+        // std::cout << "\n\nInvalid interval end-point. a is required to be within range [" << MINIMUM_RIEMANN_SUM_a << "," << MAXIMUM_RIEMANN_SUM_a << "].";
+        // file << "\n\nInvalid interval end-point. a is required to be within range [" << MINIMUM_RIEMANN_SUM_a << "," << MAXIMUM_RIEMANN_SUM_a << "].";
+        return 0.0;
+    }
 
     /**
-     * Prompt the user to select one of multiple single-variable functions from a list.
-     * Store the selected function in a Function type variable named func.
+     * Print an error message to the console window (and output file) if
+     * b is smaller than or equal to a or if
+     * b is larger than MAXIMUM_RIEMANN_SUM_a
+     * and exit the function by returning zero.
      */
-    Function func = selectFunctionFromListOfFunctions(file);
-
-    // Print a horizontal dividing line to the command line terminal.
-    std::cout << "\n\n--------------------------------";
-
-    // Print a horizontal dividing line to the file output stream.
-    file << "\n\n--------------------------------";
+    if ((b <= a) || (b > MAXIMUM_RIEMANN_SUM_a))
+    {
+        // std::cout << "\n\nInvalid interval. b is required to represent a value which is larger than a and no larger than " << MAXIMUM_RIEMANN_SUM_a << ".";
+        // file << "\n\nInvalid interval. b is required to represent a value which is larger than a and no larger than " << MAXIMUM_RIEMANN_SUM_a << ".";
+        return 0.0;
+    }
 
     /**
-     * Prompt the user to select end-point values for an interval of the x-axis, [a,b], 
-     * and for the number, n, of equally-sized partitions of that interval.
+     * Print an error message to the console window (and output file) if
+     * n is smaller than one (or larger than MAXIMUM_RIEMANN_SUM_a)
+     * and exit the function by returning zero.
      */
-    Parameters parameters = selectPartitioningValues(file);
+    if ((n < 1) || (n > MAXIMUM_RIEMANN_SUM_n))
+    {
+        // std::cout << "Invalid partition number. n is required to represent a natural number no larger than " << MAXIMUM_RIEMANN_SUM_n << ".";
+        // file << "Invalid partition number. n is required to represent a natural number no larger than " << MAXIMUM_RIEMANN_SUM_n << ".";
+        return 0.0;
+    }
 
-    // Print a horizontal dividing line to the command line terminal.
-    std::cout << "\n\n--------------------------------";
+    // Set dx to represent the length of each one of the n equally-sized partitions of the x-axis interval [a,b].
+    dx = (b - a) / n;
 
-    // Print a horizontal dividing line to the file output stream.
-    file << "\n\n--------------------------------";
+    // Print the value of dx and the above equation to the command line terminal and to the output file stream.
+    // std::cout << "\n\ndx = (b - a) / n = (" << b << " - " << a << ") / " << n << " = " << dx << ". // the length of each of the n equally-sized partitions of x-axis interval, [a,b]";
+    // file << "\n\ndx = (b - a) / n = (" << b << " - " << a << ") / " << n << " = " << dx << ". // the length of each of the n equally-sized partitions of x-axis interval, [a,b]";
+   
+    // Print a horizontal divider line to the command line terminal and to the file output stream.
+    // std::cout << "\n\n~~~~~~~~~~~~~~";
+    // file << "\n\n~~~~~~~~~~~~~~";
 
     /**
-     * Prompt the user to select a partitioning method by which to
-     * construct n rectangles whose heights are where the x-value in f(x) 
-     * is either the left end-points,
-     * the right end-points, 
-     * or the middle points of the n equally-sized
-     * partitions of x-axis interval, [a,b].
+     * For each one of the n equally-sized partitions of the x-axis,
+     * compute the approximate area of the region bounded by y = f(x) = func,
+     * the x-axis, and the vertical lines which intersect with the endpoints (or mid points)
+     * of the respective x-axis partition.
+     *
+     * Then add that area (which is the area of some rectangle) to sum.
      */
-    std::string method = selectRectangleConstructionMethod(file);
+    for (int i = 0; i < n; ++i) 
+    {
+        // Print the value of i to the command line terminal and to the output file stream.
+        // std::cout << "\n\ni = " << i << ". // current iteration of the for loop (of " << n << " iterations)";
+        // file << "\n\ni = " << i << ". // current iteration of the for loop (of " << n << " iterations)";
 
-    // Print a horizontal dividing line to the command line terminal.
-    std::cout << "\n\n--------------------------------";
+        if (method == "left") 
+        {
+            // Determine the left end-point of the ith partition of [a,b].
+            x = a + i * dx;
 
-    // Print a horizontal dividing line to the file output stream.
-    file << "\n\n--------------------------------";
+            // Print the value of x and the above equation to the command line terminal and to the output file stream.
+            // std::cout << "\n\nx = a + i * dx = " << a << " + " << i << " * " << dx << " = " << x << ". // the left end-point of the ith partition of [a,b].";
+            // file << "\n\nx = a + i * dx = " << a << " + " << i << " * " << dx << " = " << x << ". // the left end-point of the ith partition of [a,b].";
+        } 
+        else if (method == "right") 
+        {
+            // Determine the right end-point of the ith partition of [a,b].
+            x = a + (i + 1) * dx;
 
-    // Compute the Riemann sum.
-    double sum = computeRiemannSum(func, parameters.a, parameters.b, parameters.n, method, file);
+            // Print the value of x and the above equation to the command line terminal and to the output file stream.
+            // std::cout << "\n\nx = a + (i + 1) * dx = " << a << " + (" << i << " + 1) * " << dx << " = " << x << ". // the right end-point of the ith partition of [a,b].";
+            // file << "\n\nx = a + (i + 1) * dx = " << a << " + (" << i << " + 1) * " << dx << " = " << x << ". // the right end-point of the ith partition of [a,b].";
+        } 
+        else if (method == "midpoint") 
+        {
+            // Determine the middle point of the ith partition of [a,b].
+            x = a + (i + 0.5) * dx;
+
+            // Print the value of x and the above equation to the command line terminal and to the output file stream.
+            // std::cout << "\n\nx = a + (i + 0.5) * dx = " << a << " + (" << i << " + 0.5) * " << dx << " = " << x << ". // the middle point of the ith partition of [a,b].";
+            // file << "\n\nx = a + (i + 0.5) * dx = " << a << " + (" << i << " + 0.5) * " << dx << " = " << x << ". // the middle point of the ith partition of [a,b].";
+        }
+
+        /**
+         * Print an error message to the console window if 
+         * method is not either 'left', 'right', or 'midpoint'
+         * and exit the function by returning the value 0.0.
+         */
+        else 
+        {
+            std::cout << "\n\nInvalid method. Use 'left', 'right', or 'midpoint'.";
+            return 0.0;
+        }
 
-    // Print the result of the above function execution to the command line terminal and to the output file stream.
-    std::cout << "\n\nThe Reimann Sum obtained by this program runtime instance is " << sum << ".";
+        // Add the area of the current rectangle to the running total sum.
+        sum += func(x) * dx; 
 
-    // Print a closing message to the command line terminal.
-    std::cout << "\n\n--------------------------------";
-    std::cout << "\nEnd Of Program";
-    std::cout << "\n--------------------------------\n\n";
+        // Print the right-hand value of the above equation to the command line terminal and to the output file stream.
+        // std::cout << "\n\nrectangle_area_x = func(x) * dx = " << func(x) << " * " << dx << " = " << (func(x) * dx) << ". // area of the ith rectangle";
+        // file << "\n\nrectangle_area_x = func(x) * dx = " << func(x) << " * " << dx << " = " << (func(x) * dx) << ". // area of the ith rectangle";
 
-    // Print a closing message to the file output stream.
-    file << "\n\n--------------------------------";
-    file << "\nEnd Of Program";
-    file << "\n--------------------------------";
+        // Print the running total obtained by adding the area of the ith rectangle to the value stored in the variable named sum to the command line terminal and to the output file stream.
+        // std::cout << "\n\nsum += rectangle_x; // Add rectangle_x to sum and store the result in sum (in the C++ program).";
+        // std::cout << "\n\nsum = " << sum << ". // the current value stored in the variable named sum";
+        // file << "\n\nsum += rectangle_x; // Add rectangle_x to sum and store the result in sum (in the C++ program).";
+        // file << "\n\nsum = " << sum << ". // the current value stored in the variable named sum";
 
-    // Close the file output stream.
-    file.close();
+        // Print a horizontal divider line to the command line terminal and to the file output stream.
+        // std::cout << "\n\n~~~~~~~~~~~~~~";
+        // file << "\n\n~~~~~~~~~~~~~~";
+    }
 
-    // Exit the program.
-    return 0; 
+    // Return the Reimann sum obtained by adding each of the n rectangle areas.
+    return sum;
 }
 
 /**
@@ -146,21 +164,20 @@ int main() {
  * right end point, 
  * or middle point of that rectangle's respective x-axis partition.
  */
-double computeRiemannSum(Function func, double a, double b, int n, const std::string& method, std::ofstream & file) {
+double computeRiemannSum(Function func, double a, double b, int n, const std::string& method, TeeOutput & output) {
 
-    // Initialize sum, dx, and x to each store the value zero.
-    double sum = 0.0, dx = 0.0, x = 0.0;
+    // Initialize sum, dx, x, and y to each store the value zero.
+    double sum = 0.0, dx = 0.0, x = 0.0, y = 0.0;
 
     /**
      * Print an error message to the console window (and output file) if
-     * a is smaller than MINIMUM_a or if
-     * a is larger than MAXIMUM_a
+     * a is smaller than MINIMUM_RIEMANN_SUM_a or if
+     * a is larger than MAXIMUM_RIEMANN_SUM_a
      * and exit the function by returning zero.
      */
-    if ((a < MINIMUM_a) || (a > MAXIMUM_a))
+    if ((a < MINIMUM_RIEMANN_SUM_a) || (a > MAXIMUM_RIEMANN_SUM_a))
     {
-        std::cout << "\n\nInvalid interval end-point. a is required to be within range [" << MINIMUM_a << "," << MAXIMUM_a << "].";
-        file << "\n\nInvalid interval end-point. a is required to be within range [" << MINIMUM_a << "," << MAXIMUM_a << "].";
+        output << "\n\nInvalid interval end-point. a is required to be within range [" << MINIMUM_RIEMANN_SUM_a << "," << MAXIMUM_RIEMANN_SUM_a << "].";
         return 0.0;
     }
 
@@ -169,22 +186,20 @@ double computeRiemannSum(Function func, double a, double b, int n, const std::st
      * b is smaller than or equal to a
      * and exit the function by returning zero.
      */
-    if ((b <= a) || (b > MAXIMUM_a))
+    if ((b <= a) || (b > MAXIMUM_RIEMANN_SUM_a))
     {
-        std::cout << "\n\nInvalid interval. b is required to represent a value which is larger than a.";
-        file << "\n\nInvalid interval. b is required to represent a value which is larger than a.";
+        output << "\n\nInvalid interval. b is required to represent a value which is larger than a.";
         return 0.0;
     }
 
     /**
      * Print an error message to the console window (and output file) if
-     * n is smaller than one (or larger than MAXIMUM_a)
+     * n is smaller than one (or larger than MAXIMUM_RIEMANN_SUM_a)
      * and exit the function by returning zero.
      */
-    if ((n < 1) || (n > MAXIMUM_a))
+    if ((n < 1) || (n > MAXIMUM_RIEMANN_SUM_a))
     {
-        std::cout << "Invalid partition number. n is required to represent a natural number no larger than.";
-        file << "Invalid partition number. n is required to represent a natural number no larger than.";
+        output << "Invalid partition number. n is required to represent a natural number no larger than.";
         return 0.0;
     }
 
@@ -192,12 +207,10 @@ double computeRiemannSum(Function func, double a, double b, int n, const std::st
     dx = (b - a) / n;
 
     // Print the value of dx and the above equation to the command line terminal and to the output file stream.
-    std::cout << "\n\ndx = (b - a) / n = (" << b << " - " << a << ") / " << n << " = " << dx << ". // the length of each of the n equally-sized partitions of x-axis interval, [a,b]";
-    file << "\n\ndx = (b - a) / n = (" << b << " - " << a << ") / " << n << " = " << dx << ". // the length of each of the n equally-sized partitions of x-axis interval, [a,b]";
+    output << "\n\ndx = (b - a) / n = (" << b << " - " << a << ") / " << n << " = " << dx << ". // the length of each of the n equally-sized partitions of x-axis interval, [a,b]";
    
     // Print a horizontal divider line to the command line terminal and to the file output stream.
-    std::cout << "\n\n~~~~~~~~~~~~~~";
-    file << "\n\n~~~~~~~~~~~~~~";
+    output << "\n\n~~~~~~~~~~~~~~";
 
     /**
      * For each one of the n equally-sized partitions of the x-axis,
@@ -210,8 +223,7 @@ double computeRiemannSum(Function func, double a, double b, int n, const std::st
     for (int i = 0; i < n; ++i) 
     {
         // Print the value of i to the command line terminal and to the output file stream.
-        std::cout << "\n\ni = " << i << ". // current iteration of the for loop (of " << n << " iterations)";
-        file << "\n\ni = " << i << ". // current iteration of the for loop (of " << n << " iterations)";
+        output << "\n\ni = " << i << ". // current iteration of the for loop (of " << n << " iterations)";
 
         if (method == "left") 
         {
@@ -219,8 +231,7 @@ double computeRiemannSum(Function func, double a, double b, int n, const std::st
             x = a + i * dx;
 
             // Print the value of x and the above equation to the command line terminal and to the output file stream.
-            std::cout << "\n\nx = a + i * dx = " << a << " + " << i << " * " << dx << " = " << x << ". // the left end-point of the ith partition of [a,b].";
-            file << "\n\nx = a + i * dx = " << a << " + " << i << " * " << dx << " = " << x << ". // the left end-point of the ith partition of [a,b].";
+            output << "\n\nx = a + i * dx = " << a << " + " << i << " * " << dx << " = " << x << ". // the left end-point of the ith partition of [a,b].";
         } 
         else if (method == "right") 
         {
@@ -228,8 +239,7 @@ double computeRiemannSum(Function func, double a, double b, int n, const std::st
             x = a + (i + 1) * dx;
 
             // Print the value of x and the above equation to the command line terminal and to the output file stream.
-            std::cout << "\n\nx = a + (i + 1) * dx = " << a << " + (" << i << " + 1) * " << dx << " = " << x << ". // the right end-point of the ith partition of [a,b].";
-            file << "\n\nx = a + (i + 1) * dx = " << a << " + (" << i << " + 1) * " << dx << " = " << x << ". // the right end-point of the ith partition of [a,b].";
+            output << "\n\nx = a + (i + 1) * dx = " << a << " + (" << i << " + 1) * " << dx << " = " << x << ". // the right end-point of the ith partition of [a,b].";
         } 
         else if (method == "midpoint") 
         {
@@ -237,8 +247,7 @@ double computeRiemannSum(Function func, double a, double b, int n, const std::st
         	x = a + (i + 0.5) * dx;
 
             // Print the value of x and the above equation to the command line terminal and to the output file stream.
-            std::cout << "\n\nx = a + (i + 0.5) * dx = " << a << " + (" << i << " + 0.5) * " << dx << " = " << x << ". // the middle point of the ith partition of [a,b].";
-            file << "\n\nx = a + (i + 0.5) * dx = " << a << " + (" << i << " + 0.5) * " << dx << " = " << x << ". // the middle point of the ith partition of [a,b].";
+            output << "\n\nx = a + (i + 0.5) * dx = " << a << " + (" << i << " + 0.5) * " << dx << " = " << x << ". // the middle point of the ith partition of [a,b].";
         }
 
         /**
@@ -248,26 +257,25 @@ double computeRiemannSum(Function func, double a, double b, int n, const std::st
          */
         else 
         {
-            std::cout << "\n\nInvalid method. Use 'left', 'right', or 'midpoint'.";
+            output.console << "\n\nInvalid method. Use 'left', 'right', or 'midpoint'.";
             return 0.0;
         }
 
+        // Evaluate func at x only once (because the same value is both added to sum and printed).
+        y = func(x);
+
         // Add the area of the current rectangle to the running total sum.
-        sum += func(x) * dx; 
+        sum += y * dx; 
 
         // Print the right-hand value of the above equation to the command line terminal and to the output file stream.
-        std::cout << "\n\nrectangle_area_x = func(x) * dx = " << func(x) << " * " << dx << " = " << (func(x) * dx) << ". // area of the ith rectangle";
-        file << "\n\nrectangle_area_x = func(x) * dx = " << func(x) << " * " << dx << " = " << (func(x) * dx) << ". // area of the ith rectangle";
+        output << "\n\nrectangle_area_x = func(x) * dx = " << y << " * " << dx << " = " << (y * dx) << ". // area of the ith rectangle";
 
         // Print the running total obtained by adding the area of the ith rectangle to the value stored in the variable named sum to the command line terminal and to the output file stream.
-        std::cout << "\n\nsum += rectangle_x; // Add rectangle_x to sum and store the result in sum (in the C++ program).";
-        std::cout << "\n\nsum = " << sum << ". // the current value stored in the variable named sum";
-        file << "\n\nsum += rectangle_x; // Add rectangle_x to sum and store the result in sum (in the C++ program).";
-        file << "\n\nsum = " << sum << ". // the current value stored in the variable named sum";
+        output << "\n\nsum += rectangle_x; // Add rectangle_x to sum and store the result in sum (in the C++ program).";
+        output << "\n\nsum = " << sum << ". // the current value stored in the variable named sum";
 
         // Print a horizontal divider line to the command line terminal and to the file output stream.
-        std::cout << "\n\n~~~~~~~~~~~~~~";
-        file << "\n\n~~~~~~~~~~~~~~";
+        output << "\n\n~~~~~~~~~~~~~~";
     }
 
     // Return the Reimann sum obtained by adding each of the n rectangle areas.
@@ -275,360 +283,283 @@ double computeRiemannSum(Function func, double a, double b, int n, const std::st
 }
 
 /**
- * This function displays a list of single-variable algebraic functions
- * on the command line terminal and in the output file stream and
- * prompts the program user to input an option number which corresponds
- * with exactly one of the aforementioned functions. 
- * 
- * After the user enters some value, the corresponding Function type
- * object is returned.
+ * This function computes the same Reimann sum as computeRiemannSum, but records its trace as a binary ColumnarTable
+ * file named file_name (instead of as prose in a plain-text file) so that traces of millions of rectangles stay compact
+ * and can be memory-mapped by analysis tools.
+ *
+ * The table has one row per rectangle and the columns i, x, f(x), area, and sum (i.e. the running total after that rectangle).
+ *
+ * If the input values are out of range, an error message is printed to the command line terminal, no file is written,
+ * and zero is returned.
  */
-Function selectFunctionFromListOfFunctions(std::ofstream & file)
+double writeRiemannSumTrace(Function func, double a, double b, int n, const std::string& method, const std::string & file_name)
 {
-    // example function: f(x) = x^2
-    Function func_0 = [](double x) { return x * x; };
-
-    // example function: f(x) = x^3
-    Function func_1 = [](double x) { return x * x * x; };
-
-    // example function: f(x) = sin(x)
-    Function func_2 = [](double x) { return sin(x); };
-
-    // example function: f(x) = cos(x)
-    Function func_3 = [](double x) { return cos(x); };
-
-    // example function: f(x) = sqrt(x)
-    Function func_4 = [](double x) { return sqrt(x); };
-
-    // example function: f(x) = 2x + 3
-    Function func_5 = [](double x) { return 2 * x + 3; };
-
-    // Initialize option to represent 0 (which is the associated with the first function in the above list).
-    int option = 0;
-
-    // Print menu options and the instruction to input an option number to the command line terminal.
-    std::cout << "\n\nEnter the number which corresponds with one of the following functions:";
-    std::cout << "\n\n0 --> f(x) = x^2";
-    std::cout << "\n\n1 --> f(x) = x^3";
-    std::cout << "\n\n2 --> f(x) = sin(x)";
-    std::cout << "\n\n3 --> f(x) = cos(x)";
-    std::cout << "\n\n4 --> f(x) = sqrt(x)";
-    std::cout << "\n\n5 --> f(x) = 2x + 3";
-    std::cout << "\n\nEnter Option Here: ";
-
-    // Print menu options and the instruction to input an option number to the file output stream.
-    file << "\n\nEnter the number which corresponds with one of the following functions:";
-    file << "\n\n0 --> f(x) = x^2";
-    file << "\n\n1 --> f(x) = x^3";
-    file << "\n\n2 --> f(x) = sin(x)";
-    file << "\n\n3 --> f(x) = cos(x)";
-    file << "\n\n4 --> f(x) = sqrt(x)";
-    file << "\n\n5 --> f(x) = 2x + 3";
-    file << "\n\nEnter Option Here: ";
-
-    /**
-     * Scan the command line terminal for the most recent keyboard input value. 
-     * Store that value (which is coerced to be of type int upon storage) in the variable named option.
-     */
-    std::cin >> option;
-
-    // Print "The value which was entered for option is {option}." to the command line terminal.
-    std::cout << "\nThe value which was entered for option is " << option << ".";
-
-    // Print "The value which was entered for option is {option}." to the file output stream.
-    file << "\n\nThe value which was entered for option is " << option << ".";
-
-    /**
-     * If option is smaller than 0 or if option is larger than 5, set option to 0
-     * and print a message stating that fact to the command line terminal and to the output file stream.
-     */
-    if ((option < 0) || (option > 5))
+    // Initialize sum, dx, x, and y to each store the value zero.
+    double sum = 0.0, dx = 0.0, x = 0.0, y = 0.0;
+
+    // Determine which point of each partition is used (0 for the left end-point, 1 for the right end-point, and 0.5 for the middle point).
+    double offset = 0.0;
+    if (method == "left") offset = 0.0;
+    else if (method == "right") offset = 1.0;
+    else if (method == "midpoint") offset = 0.5;
+    else
     {
-        option = 0;
-        std::cout << "\n\noption was set to 0 by default due to the fact that the value input by the user was not recognized.";
-        file << "\n\noption was set to 0 by default due to the fact that the value input by the user was not recognized.";
+        std::cout << "\n\nInvalid method. Use 'left', 'right', or 'midpoint'.";
+        return 0.0;
     }
 
-    /**
-     * Print a message about which function was selected by the user to the command line terminal and to the file output stream 
-     * and return that selected function's corresponding Function type object.
-     */
-    if (option == 0) 
+    // Print an error message to the command line terminal and exit the function by returning zero if [a,b] or n is out of range.
+    if ((a < MINIMUM_RIEMANN_SUM_a) || (a > MAXIMUM_RIEMANN_SUM_a) || (b <= a) || (b > MAXIMUM_RIEMANN_SUM_a))
     {
-        std::cout << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = x^2.";
-        file << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = x^2.";
-        return func_0;
-    }
-    if (option == 1) 
-    {
-        std::cout << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = x^3.";
-        file << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = x^3.";
-        return func_1;
-    }
-    if (option == 2) 
-    {
-        std::cout << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = sin(x).";
-        file << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = sin(x).";
-        return func_2;
-    }
-    if (option == 3) 
-    {
-        std::cout << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = cos(x).";
-        file << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = cos(x).";
-        return func_3;
+        std::cout << "\n\nInvalid interval. a and b are required to satisfy " << MINIMUM_RIEMANN_SUM_a << " <= a < b <= " << MAXIMUM_RIEMANN_SUM_a << ".";
+        return 0.0;
     }
-    if (option == 4) 
+    if ((n < 1) || (n > MAXIMUM_RIEMANN_SUM_TRACE_n))
     {
-        std::cout << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = sqrt(x).";
-        file << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = sqrt(x).";
-        return func_4;
+        std::cout << "\n\nInvalid partition number. n is required to represent a natural number no larger than " << MAXIMUM_RIEMANN_SUM_TRACE_n << ".";
+        return 0.0;
     }
-    if (option == 5) 
+
+    ColumnarTable trace = ColumnarTable::create(file_name, { "i", "x", "f(x)", "area", "sum" }, n);
+    if (!trace.isOpen()) return 0.0;
+    double * column_i = trace.writableColumn(0);
+    double * column_x = trace.writableColumn(1);
+    double * column_y = trace.writableColumn(2);
+    double * column_area = trace.writableColumn(3);
+    double * column_sum = trace.writableColumn(4);
+
+    // Set dx to represent the length of each one of the n equally-sized partitions of the x-axis interval [a,b].
+    dx = (b - a) / n;
+
+    // Store one row per rectangle directly into the (memory-mapped) columns of the trace.
+    for (int i = 0; i < n; ++i)
     {
-        std::cout << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = 2x + 3.";
-        file << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = 2x + 3.";
-        return func_5;
+        x = a + (i + offset) * dx;
+        y = func(x);
+        sum += y * dx;
+        column_i[i] = i;
+        column_x[i] = x;
+        column_y[i] = y;
+        column_area[i] = y * dx;
+        column_sum[i] = sum;
     }
-    return func_0;
+
+    trace.close();
+
+    // Return the Reimann sum obtained by adding each of the n rectangle areas.
+    return sum;
 }
 
 /**
- * This function prompts the user to input three numerical values related to partitioning the x-axis of a Cartesian grid
- * for the purpose of using each those partitions to instantiate a rectangle whose width is the partition length
- * and whose height is where that rectangle's top left corner intersects with the graph of some single-variable function y = f(x).
- * 
- * a represents the left-most point of the aforementioned x-axis partition.
- * 
- * b represents the right-most point of the aforementioned x-axis partition.
- * 
- * n represents the number of equally-sized partitions to divide the x-axis partition, [a,b], into.
- * 
- * If an invalid input to this function is detected, then this function will return a Parameters instance with default values as follows:
- * 
- * { a : 0.0, b : 1.0, n : 10 }.
+ * This function computes the Reimann sum of a multi-variable function, y = f(x_0, x_1, ..., x_(d - 1)), over the box
+ * [axes[0].a, axes[0].b] x [axes[1].a, axes[1].b] x ... (i.e. the double integral of f(x,y) over a rectangle if d = 2,
+ * the triple integral of f(x,y,z) over a box if d = 3, etc.).
+ *
+ * Axis i of the box is divided into axes[i].n equally-sized partitions, and every one of the resulting
+ * axes[0].n * axes[1].n * ... boxes contributes f(sample point) * (volume of that box) to the sum, where each coordinate
+ * of the sample point is the left end-point, the right end-point, or the middle point of its partition (see method).
+ *
+ * The grid is traversed one row (axis 0) at a time. The coordinates of each axis are computed only once, and each row is
+ * evaluated in blocks of at most RIEMANN_SUM_ROW_BLOCK_LENGTH samples (which stay inside of the L1 data cache).
+ *
+ * The rows are grouped into chunks. If pool is not nullptr, the chunks run on every thread of pool. The partial sum of each
+ * chunk is stored separately and the partial sums are added in chunk order, so the result does not depend on the
+ * number of threads.
+ *
+ * If the input values are out of range (including a grid of more than MAXIMUM_RIEMANN_SUM_GRID_n sample points), an error message
+ * is printed to the command line terminal and zero is returned.
  */
-Parameters selectPartitioningValues(std::ofstream & file)
+double computeMultipleRiemannSum(const RowFunction & row, const std::vector<Parameters> & axes, const std::string& method, ThreadPool * pool)
 {
-    // Define two double-type variables for storing values which represent the end points of an x-axis interval.
-    double a = 0.0, b = 0.0;
-
-    // Define one int-type variable for storing the number of equally sized partitions to divide the aforementioned x-axis interval into.
-    int n = 1;
-
-    // Define a read-only default Parameters value to use as a reference to replace invalid user-input values with correct values.
-    const Parameters default_params = { 0.0, 1.0, 10 };
-
-    /*****************************/
-    /* Get User Input: a         */
-    /*****************************/
-
-    // Print a message to the command line terminal which prompts the user to input a value to store in the variable named a.
-    std::cout << "\n\nEnter a value to store in double-type variable a (which represents the left end of the x-axis interval): ";
-
-    // Print a message to the output file stream which prompts the user to input a value to store in the variable named a.
-    file << "\n\nEnter a value to store in double-type variable a (which represents the left end of the x-axis interval): ";
-
-    /**
-     * Scan the command line terminal for the most recent keyboard input value. 
-     * Store that value in the variable named a.
-     */
-    std::cin >> a;
-
-    // Print "The value which was entered for a is {a}." to the command line terminal.
-    std::cout << "\nThe value which was entered for a is " << a << ".";
-
-    // Print "The value which was entered for a is {a}." to the file output stream.
-    file << "\n\nThe value which was entered for a is " << a << ".";
-
-    /**
-     * Print an error message to the command line terminal and to the output file stream if
-     * a is smaller than MINIMUM_a or if
-     * a is larger than MAXIMUM_a
-     * and return a default Parameters instance.
-     */
-    if ((a < MINIMUM_a) || (a > MAXIMUM_a))
+    // Determine which point of each partition is used (0 for the left end-point, 1 for the right end-point, and 0.5 for the middle point).
+    double offset = 0.0;
+    if (method == "left") offset = 0.0;
+    else if (method == "right") offset = 1.0;
+    else if (method == "midpoint") offset = 0.5;
+    else
     {
-        std::cout << "\n\nInvalid interval end-point. a is required to be within range [" << MINIMUM_a << "," << MAXIMUM_a << "].";
-        std::cout << "\n\nHence, default program values are being used to replace user inputs for the Reimann Sum partitioning parameters.";
-        file << "\n\nInvalid interval end-point. a is required to be within range [" << MINIMUM_a << "," << MAXIMUM_a << "].";
-        file << "\n\nHence, default program values are being used to replace user inputs for the Reimann Sum partitioning parameters.";
-        return default_params;
+        std::cout << "\n\nInvalid method. Use 'left', 'right', or 'midpoint'.";
+        return 0.0;
     }
 
-    /*****************************/
-    /* Get User Input: b         */
-    /*****************************/
-
-    // Print a message to the command line terminal which prompts the user to input a value to store in the variable named b.
-    std::cout << "\n\nEnter a value to store in double-type variable b (which represents the right end of the x-axis interval): ";
-
-    // Print a message to the output file stream which prompts the user to input a value to store in the variable named b.
-    file << "\n\nEnter a value to store in double-type variable b (which represents the right end of the x-axis interval): ";
-
-    /**
-     * Scan the command line terminal for the most recent keyboard input value. 
-     * Store that value in the variable named a.
-     */
-    std::cin >> b;
-
-    // Print "The value which was entered for b is {b}." to the command line terminal.
-    std::cout << "\nThe value which was entered for b is " << b << ".";
-
-    // Print "The value which was entered for b is {b}." to the file output stream.
-    file << "\n\nThe value which was entered for b is " << b << ".";
-
-    /**
-     * Print an error message to the command line terminal and to the output file stream if
-     * b is smaller than or equal to a or if
-     * b is larger than MAXIMUM_a
-     * and return a default Parameters instance.
-     */
-    if ((b <= a) || (b > MAXIMUM_a))
+    const int dimensions = static_cast<int>(axes.size());
+    if ((dimensions < 1) || (dimensions > MAXIMUM_RIEMANN_SUM_DIMENSIONS))
     {
-        std::cout << "\n\nInvalid interval end-point. b is required to be within range (" << a << "," << MAXIMUM_a << "].";
-        std::cout << "\n\nHence, default program values are being used to replace user inputs for the Reimann Sum partitioning parameters.";
-        file << "\n\nInvalid interval end-point. b is required to be within range (" << a << "," << MAXIMUM_a << "].";
-        file << "\n\nHence, default program values are being used to replace user inputs for the Reimann Sum partitioning parameters.";
-        return default_params;
+        std::cout << "\n\nInvalid number of axes. The number of axes is required to be within range [1," << MAXIMUM_RIEMANN_SUM_DIMENSIONS << "].";
+        return 0.0;
     }
 
-    /*****************************/
-    /* Get User Input: n         */
-    /*****************************/
+    // Check each axis and the total number of sample points (before anything is allocated). The product is compared by division so that it cannot overflow.
+    long long sample_count = 1;
+    for (int d = 0; d < dimensions; d += 1)
+    {
+        const Parameters & axis = axes[d];
+        if ((axis.a < MINIMUM_RIEMANN_SUM_a) || (axis.a > MAXIMUM_RIEMANN_SUM_a) || (axis.b <= axis.a) || (axis.b > MAXIMUM_RIEMANN_SUM_a) || (axis.n < 1) || (axis.n > MAXIMUM_RIEMANN_SUM_TRACE_n))
+        {
+            std::cout << "\n\nInvalid axis " << d << ". Each axis is required to satisfy " << MINIMUM_RIEMANN_SUM_a << " <= a < b <= " << MAXIMUM_RIEMANN_SUM_a << " and 1 <= n <= " << MAXIMUM_RIEMANN_SUM_TRACE_n << ".";
+            return 0.0;
+        }
+        if (sample_count > MAXIMUM_RIEMANN_SUM_GRID_n / axis.n)
+        {
+            std::cout << "\n\nInvalid axes. The number of sample points (the product of n over every axis) is required to be no larger than " << MAXIMUM_RIEMANN_SUM_GRID_n << ".";
+            return 0.0;
+        }
+        sample_count *= axis.n;
+    }
 
-    // Print a message to the command line terminal which prompts the user to input a value to store in the variable named n.
-    std::cout << "\n\nEnter a value to store in int-type variable n (which represents the number of equally-sized partitions to divide x-axis interval [a,b] into): ";
+    // Compute the sample coordinates of each axis (once) and the volume of one box of the grid.
+    std::vector<std::vector<double>> coordinates(dimensions);
+    double volume = 1.0;
+    long long row_count = 1;
+    for (int d = 0; d < dimensions; d += 1)
+    {
+        const Parameters & axis = axes[d];
+        double dx = (axis.b - axis.a) / axis.n;
+        volume *= dx;
+        coordinates[d].resize(axis.n);
+        for (int i = 0; i < axis.n; i += 1) coordinates[d][i] = axis.a + (i + offset) * dx;
+        if (d > 0) row_count *= axis.n;
+    }
 
-    // Print a message to the output file stream which prompts the user to input a value to store in the variable named n.
-    file << "\n\nEnter a value to store in int-type variable n (which represents the number of equally-sized partitions to divide x-axis interval [a,b] into): ";
+    // Group the rows into chunks of roughly 65536 samples each.
+    const long long row_length = axes[0].n;
+    const long long rows_per_chunk = (row_length >= 65536) ? 1 : (65536 / row_length);
+    const long long chunk_count = (row_count + rows_per_chunk - 1) / rows_per_chunk;
+    std::vector<double> partial_sums(static_cast<std::size_t>(chunk_count), 0.0);
 
-    /**
-     * Scan the command line terminal for the most recent keyboard input value. 
-     * Store that value in the variable named a.
-     */
-    std::cin >> n;
+    auto sumChunks = [&](long long first_chunk, long long end_chunk)
+    {
+        std::vector<double> values(static_cast<std::size_t>((row_length < RIEMANN_SUM_ROW_BLOCK_LENGTH) ? row_length : RIEMANN_SUM_ROW_BLOCK_LENGTH));
+        double point[MAXIMUM_RIEMANN_SUM_DIMENSIONS] = { 0.0 };
+        long long index[MAXIMUM_RIEMANN_SUM_DIMENSIONS] = { 0 };
 
-    // Print "The value which was entered for n is {n}." to the command line terminal.
-    std::cout << "\nThe value which was entered for n is " << n << ".";
+        for (long long chunk = first_chunk; chunk < end_chunk; chunk += 1)
+        {
+            long long first_row = chunk * rows_per_chunk;
+            long long end_row = (first_row + rows_per_chunk < row_count) ? (first_row + rows_per_chunk) : row_count;
+
+            // Convert the number of the first row of the chunk into one partition index per outer axis (axis 1 varies fastest).
+            long long remainder = first_row;
+            for (int d = 1; d < dimensions; d += 1)
+            {
+                index[d] = remainder % axes[d].n;
+                remainder /= axes[d].n;
+                point[d] = coordinates[d][index[d]];
+            }
+
+            // Add the rows of the chunk with compensated (Kahan) summation so that the rounding error does not grow with the number of rows.
+            double sum = 0.0, compensation = 0.0;
+            for (long long r = first_row; r < end_row; r += 1)
+            {
+                double row_sum = 0.0;
+                for (long long start = 0; start < row_length; start += RIEMANN_SUM_ROW_BLOCK_LENGTH)
+                {
+                    long long count = (row_length - start < RIEMANN_SUM_ROW_BLOCK_LENGTH) ? (row_length - start) : RIEMANN_SUM_ROW_BLOCK_LENGTH;
+                    row(coordinates[0].data() + start, count, point, values.data());
+
+                    // Four independent accumulators let the additions of the block overlap in the floating-point pipeline.
+                    double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+                    long long k = 0;
+                    for (; k + 4 <= count; k += 4)
+                    {
+                        s0 += values[k];
+                        s1 += values[k + 1];
+                        s2 += values[k + 2];
+                        s3 += values[k + 3];
+                    }
+                    for (; k < count; k += 1) s0 += values[k];
+                    row_sum += (s0 + s1) + (s2 + s3);
+                }
+
+                double y = row_sum - compensation;
+                double t = sum + y;
+                compensation = (t - sum) - y;
+                sum = t;
+
+                // Move to the next row (like an odometer: axis 1 advances first and carries into axis 2, etc.).
+                for (int d = 1; d < dimensions; d += 1)
+                {
+                    index[d] += 1;
+                    if (index[d] < axes[d].n)
+                    {
+                        point[d] = coordinates[d][index[d]];
+                        break;
+                    }
+                    index[d] = 0;
+                    point[d] = coordinates[d][0];
+                }
+            }
+            partial_sums[static_cast<std::size_t>(chunk)] = sum;
+        }
+    };
 
-    // Print "The value which was entered for n is {n}." to the file output stream.
-    file << "\n\nThe value which was entered for n is " << n << ".";
+    if (pool != nullptr) pool->parallelFor(chunk_count, 1, sumChunks);
+    else sumChunks(0, chunk_count);
 
-    /**
-     * Print an error message to the command line terminal and to the output file stream if
-     * n is smaller than one or if
-     * n is larger than MAXIMUM_a
-     * and return a default Parameters instance.
-     */
-    if ((n < 1) || (n > MAXIMUM_a))
+    // Add the partial sums in chunk order (so that the result is the same for every number of threads).
+    double sum = 0.0, compensation = 0.0;
+    for (double partial_sum : partial_sums)
     {
-        std::cout << "\n\nInvalid partition number. n is required to be a natural number within range [1," << MAXIMUM_a << "].";
-        std::cout << "\n\nHence, default program values are being used to replace user inputs for the Reimann Sum partitioning parameters.";
-        file << "\n\nInvalid partition number. n is required to be a natural number within range [1," << MAXIMUM_a << "].";
-        file << "\n\nHence, default program values are being used to replace user inputs for the Reimann Sum partitioning parameters.";
-        return default_params;
+        double y = partial_sum - compensation;
+        double t = sum + y;
+        compensation = (t - sum) - y;
+        sum = t;
     }
 
-    /**
-     * Print a message about which x-axis interval and partition number were selected 
-     * by the user to the command line terminal and to the file output stream.
-     */
-    std::cout << "\n\nThe x-axis interval which was selected to partition is [" << a << "," << b << "].";
-    std::cout << "\n\nThe selected number of equally-sized partitions to divide that interval into is " << n << ".";
-    file << "\n\nThe x-axis interval which was selected to partition is [" << a << "," << b << "].";
-    file << "\n\nThe selected number of equally-sized partitions to divide that interval into is " << n << ".";
-
-    // Return a struct whose data type is Parameters and whose data attributes are the values which the user entered during a runtime instance of this function.
-    return {a,b,n};
+    // Return the Reimann sum obtained by multiplying the sum of the sampled function values by the volume of one box.
+    return sum * volume;
 }
 
 /**
- * This function displays a list of Reimann Sum partitioning methods
- * on the command line terminal and in the output file stream and
- * prompts the program user to input an option number which corresponds
- * with exactly one of the aforementioned methods. 
- * 
- * After the user enters some value, the corresponding string type
- * object is returned.
+ * This function computes the same multi-dimensional Reimann sum as the RowFunction version for a function which is
+ * evaluated one point at a time.
  */
-std::string selectRectangleConstructionMethod(std::ofstream & file)
+double computeMultipleRiemannSum(const MultivariableFunction & func, const std::vector<Parameters> & axes, const std::string& method, ThreadPool * pool)
 {
-    /**
-     * The following three read-only string variables each refer to a specific method of visualizing n rectangles 
-     * whose widths are the length of each one of the n partitions of [a,b] and 
-     * whose heights are f(xi) where xi is some point within [a,b].
-     * 
-     * "left" refers to the method of using the left end-point of each of the n partitions of [a,b] to set the height of each of the n rectangles.
-     * 
-     * "right" refers to the method of using the right end-point of each of the n partitions of [a,b] to set the height of each of the n rectangles.
-     * 
-     * "midpoint" refers to the method of using the middle point of each of the n partitions of [a,b] to set the height of each of the n rectangles.
-     */
-    const std::string method_0 = "left";
-    const std::string method_1 = "right";
-    const std::string method_2 = "midpoint";
-
-    // Initialize option to represent 0 (which is the associated with the first method in the above list).
-    int option = 0;
-
-    // Print menu options and the instruction to input an option number to the command line terminal.
-    std::cout << "\n\nEnter the number which corresponds with one of the following rectangle construction methods:";
-    std::cout << "\n\n0 --> \"left\"";
-    std::cout << "\n\n1 --> \"right\"";    
-    std::cout << "\n\n2 --> \"midpoint\"";
-    std::cout << "\n\nEnter Option Here: ";
-
-    // Print menu options and the instruction to input an option number to the file output stream.
-    file << "\n\nEnter the number which corresponds with one of the following rectangle construction methods:";
-    file << "\n\n0 --> \"left\"";
-    file << "\n\n1 --> \"right\"";    
-    file << "\n\n2 --> \"midpoint\"";
-    file << "\n\nEnter Option Here: ";
-
-    /**
-     * Scan the command line terminal for the most recent keyboard input value. 
-     * Store that value (which is coerced to be of type int upon storage) in the variable named option.
-     */
-    std::cin >> option;
-
-    // Print "The value which was entered for option is {option}." to the command line terminal.
-    std::cout << "\nThe value which was entered for option is " << option << ".";
-
-    // Print "The value which was entered for option is {option}." to the file output stream.
-    file << "\n\nThe value which was entered for option is " << option << ".";
-
-    /**
-     * If option is smaller than 0 or if option is larger than 2, set option to 0
-     * and print a message stating that fact to the command line terminal and to the output file stream.
-     */
-    if ((option < 0) || (option > 2))
+    RowFunction row = [&func](const double * x, long long count, const double * point, double * values)
     {
-        option = 0;
-        std::cout << "\n\noption was set to 0 by default due to the fact that the value input by the user was not recognized.";
-        file << "\n\noption was set to 0 by default due to the fact that the value input by the user was not recognized.";
-    }
+        double sample[MAXIMUM_RIEMANN_SUM_DIMENSIONS];
+        for (int d = 1; d < MAXIMUM_RIEMANN_SUM_DIMENSIONS; d += 1) sample[d] = point[d];
+        for (long long k = 0; k < count; k += 1)
+        {
+            sample[0] = x[k];
+            values[k] = func(sample);
+        }
+    };
+    return computeMultipleRiemannSum(row, axes, method, pool);
+}
 
-    /**
-     * Print a message about which function was selected by the user to the command line terminal and to the file output stream 
-     * and return that selected method's corresponding string type object.
-     */
-    if (option == 0) 
-    {
-        std::cout << "\n\nThe rectangle construction method which was selected from the list of such methods is \"left\" (i.e. using the left end-point of each of the n partitions of [a,b] to set the height of each of the n rectangles).";
-        file << "\n\nThe rectangle construction method which was selected from the list of such methods is \"left\" (i.e. using the left end-point of each of the n partitions of [a,b] to set the height of each of the n rectangles).";
-        return method_0;
-    }
-    if (option == 1) 
-    {
-        std::cout << "\n\nThe rectangle construction method which was selected from the list of such methods is \"right\" (i.e. using the right end-point of each of the n partitions of [a,b] to set the height of each of the n rectangles).";
-        file << "\n\nThe rectangle construction method which was selected from the list of such methods is \"right\" (i.e. using the right end-point of each of the n partitions of [a,b] to set the height of each of the n rectangles).";
-        return method_1;
-    }
-    if (option == 2) 
+/**
+ * This function returns an Interval which is guaranteed to contain the exact integral of a single variable function, y = f(x),
+ * on the x-axis interval [a,b] (and not only an estimate of that integral), given an interval version of f, func, which returns
+ * an Interval which contains f(x) for every x in its input Interval (such as the functions of generate_array_of_interval_functions).
+ *
+ * [a,b] is divided into n partitions [x_i, x_(i + 1)] whose end-points are doubles (so that the partitions cover [a,b] exactly).
+ * The integral over each partition lies between its width times the minimum of f and its width times the maximum of f on that
+ * partition, and func([x_i, x_(i + 1)]) contains both of those values. The n products are added with outward rounding, so the
+ * result bounds both the discretization error and the rounding error of the sum (i.e. it is a lower sum and an upper sum at once).
+ *
+ * Where f is monotone on a partition, the interval version of f returns (up to a few units in the last place) the two values
+ * f(x_i) and f(x_(i + 1)), so the width of the enclosure is about dx * |f(b) - f(a)| for a monotone f (and dx times the total
+ * variation of f in general), which shrinks in proportion to 1 / n.
+ *
+ * If the input values are out of range, the (unhelpful but still guaranteed) Interval [-infinity, infinity] is returned.
+ */
+Interval computeRiemannSumEnclosure(const IntervalFunction & func, double a, double b, int n)
+{
+    if ((a < MINIMUM_RIEMANN_SUM_a) || (a > MAXIMUM_RIEMANN_SUM_a) || (b <= a) || (b > MAXIMUM_RIEMANN_SUM_a)) return { -INFINITY, INFINITY };
+    if ((n < 1) || (n > MAXIMUM_RIEMANN_SUM_ENCLOSURE_n)) return { -INFINITY, INFINITY };
+
+    // Set dx to the (rounded) length of each partition. The end-points a + i * dx are increasing in i, and the last end-point is b itself.
+    const double dx = (b - a) / n;
+    Interval sum = Interval(0.0);
+    double x_left = a;
+    for (int i = 1; i <= n; i += 1)
     {
-        std::cout << "\n\nThe rectangle construction method which was selected from the list of such methods is \"midpoint\" (i.e. using the middle point of each of the n partitions of [a,b] to set the height of each of the n rectangles).";
-        file << "\n\nThe rectangle construction method which was selected from the list of such methods is \"midpoint\" (i.e. using the middle point of each of the n partitions of [a,b] to set the height of each of the n rectangles).";
-        return method_2;
+        double x_right = (i == n) ? b : std::fmin(a + i * dx, b);
+        Interval width = Interval(x_right) - Interval(x_left);
+        sum += width * func(Interval(x_left, x_right));
+        x_left = x_right;
     }
-    return method_0;
+    return sum;
 }
@@ -0,0 +1,96 @@
+/**
+ * file: reimann_sum.h
+ * type: C++ (header file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+#ifndef REIMANN_SUM_H
+#define REIMANN_SUM_H
+
+/** preprocessing directives */
+#include <functional> // define custom Function type
+#include <string> // rectangle construction method names
+#include <vector> // one Parameters value per axis of a multi-dimensional Reimann sum
+#include "tee_output.h" // TeeOutput
+#include "thread_pool.h" // ThreadPool
+#include "interval.h" // Interval, IntervalFunction
+#define MINIMUM_RIEMANN_SUM_a -999 // constant which represents the minimum interval end-point accepted by computeRiemannSum
+#define MAXIMUM_RIEMANN_SUM_a 999 // constant which represents the maximum interval end-point accepted by computeRiemannSum
+#define MAXIMUM_RIEMANN_SUM_n 1000 // constant which represents the maximum number of partitions accepted by computeRiemannSum
+#define MAXIMUM_RIEMANN_SUM_TRACE_n 100000000 // constant which represents the maximum number of partitions accepted by writeRiemannSumTrace
+#define MAXIMUM_RIEMANN_SUM_ENCLOSURE_n 100000000 // constant which represents the maximum number of partitions accepted by computeRiemannSumEnclosure
+#define MAXIMUM_RIEMANN_SUM_DIMENSIONS 8 // constant which represents the maximum number of axes accepted by computeMultipleRiemannSum
+#define MAXIMUM_RIEMANN_SUM_GRID_n 100000000000LL // constant which represents the maximum number of sample points (the product of n over every axis) accepted by computeMultipleRiemannSum
+#define RIEMANN_SUM_ROW_BLOCK_LENGTH 2048 // constant which represents the maximum number of samples which one RowFunction call evaluates (16 KiB of doubles, which fits inside of the L1 data cache)
+
+// Define the data type for an object which represents a single variable function (in the format y = f(x)).
+using Function = std::function<double(double)>;
+
+/** 
+ * Define a struct-type variable named Parameters which stores the three variables needed to take the Reimann Sum 
+ * of some single-variable function (whose dependent variable is x) over some positive-length interval of the x-axis
+ * of a Cartesian grid
+ * where the left end of that interval is represented by a double-type variable named a,
+ * where the right end of that interval is represented by a double-type variable named b,
+ * and where the natural number of times which that interval is divided into equally-sized partitions 
+ * is represented by an int-type variable named n.
+ */
+struct Parameters { 
+    double a; 
+    double b; 
+    int n; 
+};
+
+/**
+ * Define the data type for an object which evaluates a multi-variable function, y = f(x_0, x_1, ..., x_(d - 1)),
+ * along one row of sample points (i.e. points which differ only in their first coordinate):
+ *
+ * values[k] = f(x[k], point[1], point[2], ..., point[d - 1]) for k = 0, 1, ..., count - 1.
+ *
+ * (point[0] is not used.) Evaluating a whole row per call lets the function keep the other coordinates in registers
+ * and lets the compiler vectorize the loop over x.
+ */
+using RowFunction = std::function<void(const double * x, long long count, const double * point, double * values)>;
+
+// Define the data type for an object which evaluates a multi-variable function at one point (whose d coordinates are point[0], point[1], ..., point[d - 1]).
+using MultivariableFunction = std::function<double(const double * point)>;
+
+/** function prototypes */
+double computeRiemannSum(Function func, double a, double b, int n, const std::string& method);
+double computeRiemannSum(Function func, double a, double b, int n, const std::string& method, TeeOutput & output);
+double writeRiemannSumTrace(Function func, double a, double b, int n, const std::string& method, const std::string & file_name);
+double computeMultipleRiemannSum(const RowFunction & row, const std::vector<Parameters> & axes, const std::string& method, ThreadPool * pool = nullptr);
+double computeMultipleRiemannSum(const MultivariableFunction & func, const std::vector<Parameters> & axes, const std::string& method, ThreadPool * pool = nullptr);
+Interval computeRiemannSumEnclosure(const IntervalFunction & func, double a, double b, int n);
+
+/**
+ * Compute the Reimann sum of func over [a,b] with n partitions in the arithmetic of the Scalar type (e.g. BigFloat from big_float.h),
+ * which must be constructible from a double and support +, -, *, /, and <, so that the sum keeps every digit of that type:
+ *
+ * computeRiemannSum<BigFloat>([](const BigFloat & x) { return sine(x); }, BigFloat(0.0), BigFloat(1.0), 1000, "midpoint").
+ *
+ * With Scalar = Interval (from interval.h) the result is a guaranteed enclosure of the Reimann sum itself (i.e. of its rounding
+ * error, but not of its discretization error; computeRiemannSumEnclosure encloses the integral).
+ *
+ * The same input ranges as for the double version apply. If an input is out of range, zero is returned.
+ */
+template <typename Scalar> Scalar computeRiemannSum(const std::function<Scalar(const Scalar &)> & func, const Scalar & a, const Scalar & b, int n, const std::string & method)
+{
+    if ((a < Scalar(MINIMUM_RIEMANN_SUM_a)) || (Scalar(MAXIMUM_RIEMANN_SUM_a) < a) || !(a < b) || (Scalar(MAXIMUM_RIEMANN_SUM_a) < b)) return Scalar(0.0);
+    if ((n < 1) || (n > MAXIMUM_RIEMANN_SUM_n)) return Scalar(0.0);
+
+    // Set offset to the position of the sample point inside of each partition (0 for the left end-point, 1 for the right end-point).
+    double offset = 0.0;
+    if (method == "right") offset = 1.0;
+    else if (method == "midpoint") offset = 0.5;
+    else if (method != "left") return Scalar(0.0);
+
+    const Scalar dx = (b - a) / Scalar(static_cast<double>(n));
+    Scalar sum = Scalar(0.0);
+    for (int i = 0; i < n; i += 1) sum += func(a + dx * Scalar(i + offset));
+    return sum * dx;
+}
+
+#endif // REIMANN_SUM_H
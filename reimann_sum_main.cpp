@@ -0,0 +1,439 @@
+/**
+ * file: reimann_sum_main.cpp
+ * type: C++ (source file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+/** preprocessing directives */
+#include <iostream> // standard input (std::cin), standard output (std::cout)
+#include <cmath> // sine function (sin(x)), cosine function (cos(x)), square root function (sqrt(x)), std::isfinite, std::isnan
+#include "reimann_sum.h" // Function, Parameters, computeRiemannSum
+#include "tee_output.h" // TeeOutput
+#include "tanh_sinh.h" // TanhSinhResult, integrateTanhSinh
+#include "fundamental_theorem_of_calculus.h" // generate_array_of_interval_functions
+#define MINIMUM_a -999 // constant which represents the minimum a value
+#define MAXIMUM_a 999 // constant which represents the maximum a value
+// #define MINIMUM_b -999 // constant which represents the minimum b value
+// #define MAXIMUM_b 999 // constant which represents the maximum b value
+// #define MINIMUM_n 1 // constant which represents the minimum n value
+// #define MAXIMUM_n 999 // constant which represents the maximum n value
+
+/** function prototypes */
+Function selectFunctionFromListOfFunctions(TeeOutput & output, int & selected_option);
+Parameters selectPartitioningValues(TeeOutput & output);
+std::string selectRectangleConstructionMethod(TeeOutput & output);
+
+/** program entry point */
+int main() {
+
+    /**
+     * If the file named reimann_sum_output.txt does not already exist 
+     * inside of the same file directory as the program, 
+     * create a new file named reimann_sum_output.txt in that directory.
+     * 
+     * Open the plain-text file named reimann_sum_output.txt
+     * and set that file to be overwritten with program data.
+     * 
+     * Every value which is printed through output is formatted only once (as the shortest decimal number which converts back 
+     * to exactly the same double) and is then copied to the command line terminal and to the (buffered) file output stream.
+     */
+    TeeOutput output("reimann_sum_output.txt");
+
+    // Print an opening message to the command line terminal.
+    output.console << "\n\n--------------------------------";
+    output.console << "\nStart Of Program";
+    output.console << "\n--------------------------------";
+
+    // Print an opening message to the file output stream.
+    output.file << "--------------------------------";
+    output.file << "\nStart Of Program";
+    output.file << "\n--------------------------------";
+
+    /**
+     * Prompt the user to select one of multiple single-variable functions from a list.
+     * Store the selected function in a Function type variable named func (and its option number in an int type variable named selected_option).
+     */
+    int selected_option = 0;
+    Function func = selectFunctionFromListOfFunctions(output, selected_option);
+
+    // Print a horizontal dividing line to the command line terminal and to the file output stream.
+    output << "\n\n--------------------------------";
+
+    /**
+     * Prompt the user to select end-point values for an interval of the x-axis, [a,b], 
+     * and for the number, n, of equally-sized partitions of that interval.
+     */
+    Parameters parameters = selectPartitioningValues(output);
+
+    // Print a horizontal dividing line to the command line terminal and to the file output stream.
+    output << "\n\n--------------------------------";
+
+    /**
+     * Prompt the user to select a partitioning method by which to
+     * construct n rectangles whose heights are where the x-value in f(x) 
+     * is either the left end-points,
+     * the right end-points, 
+     * or the middle points of the n equally-sized
+     * partitions of x-axis interval, [a,b].
+     */
+    std::string method = selectRectangleConstructionMethod(output);
+
+    // Print a horizontal dividing line to the command line terminal and to the file output stream.
+    output << "\n\n--------------------------------";
+
+    // Compute the Riemann sum.
+    double sum = computeRiemannSum(func, parameters.a, parameters.b, parameters.n, method, output);
+
+    // Print the result of the above function execution to the command line terminal and to the output file stream.
+    output.console << "\n\nThe Reimann Sum obtained by this program runtime instance is " << sum << ".";
+
+    /**
+     * Compute the same integral with tanh-sinh quadrature (which converges quickly even where the derivative of f is unbounded at an
+     * end-point, such as f(x) = sqrt(x) at x = 0) and print it to the command line terminal and to the output file stream for comparison.
+     */
+    TanhSinhResult tanh_sinh = integrateTanhSinh(func, parameters.a, parameters.b);
+    if (std::isfinite(tanh_sinh.estimate)) output << "\n\nThe tanh-sinh integral of f on [a,b] is " << tanh_sinh.estimate << " (error estimate: " << tanh_sinh.error_estimate << ", function evaluations: " << tanh_sinh.evaluations << ").";
+    else output << "\n\nThe tanh-sinh integral of f on [a,b] is " << tanh_sinh.estimate << " because f is not defined (or not finite) at some point inside of [a,b].";
+
+    /**
+     * Compute a guaranteed enclosure of the same integral with interval arithmetic over the same n partitions (i.e. a lower bound and an upper bound
+     * which account for both the discretization error and the rounding error) and print it to the command line terminal and to the output file stream.
+     * If f is not defined on some part of [a,b] (e.g. f(x) = sqrt(x) where a < 0), the enclosure is "not a number" and no bounds are printed.
+     */
+    Interval enclosure = computeRiemannSumEnclosure(generate_array_of_interval_functions()[selected_option], parameters.a, parameters.b, parameters.n);
+    if (std::isnan(enclosure.lower) || std::isnan(enclosure.upper)) output << "\n\nNo enclosure of the integral of f on [a,b] exists because f is not defined on all of [a,b].";
+    else output << "\n\nThe integral of f on [a,b] is guaranteed to be at least " << enclosure.lower << " and at most " << enclosure.upper << ".";
+
+    // Print a closing message to the command line terminal.
+    output.console << "\n\n--------------------------------";
+    output.console << "\nEnd Of Program";
+    output.console << "\n--------------------------------\n\n";
+
+    // Print a closing message to the file output stream.
+    output.file << "\n\n--------------------------------";
+    output.file << "\nEnd Of Program";
+    output.file << "\n--------------------------------";
+
+    // Write the remaining buffered program data to the file output stream and close that file.
+    output.close();
+
+    // Exit the program.
+    return 0; 
+}
+
+/**
+ * This function displays a list of single-variable algebraic functions
+ * on the command line terminal and in the output file stream and
+ * prompts the program user to input an option number which corresponds
+ * with exactly one of the aforementioned functions. 
+ * 
+ * After the user enters some value, the corresponding Function type
+ * object is returned (and the option number of that function is stored in selected_option).
+ */
+Function selectFunctionFromListOfFunctions(TeeOutput & output, int & selected_option)
+{
+    // example function: f(x) = x^2
+    Function func_0 = [](double x) { return x * x; };
+
+    // example function: f(x) = x^3
+    Function func_1 = [](double x) { return x * x * x; };
+
+    // example function: f(x) = sin(x)
+    Function func_2 = [](double x) { return sin(x); };
+
+    // example function: f(x) = cos(x)
+    Function func_3 = [](double x) { return cos(x); };
+
+    // example function: f(x) = sqrt(x)
+    Function func_4 = [](double x) { return sqrt(x); };
+
+    // example function: f(x) = 2x + 3
+    Function func_5 = [](double x) { return 2 * x + 3; };
+
+    // Initialize option to represent 0 (which is the associated with the first function in the above list).
+    int option = 0;
+
+    // Print menu options and the instruction to input an option number to the command line terminal and to the file output stream.
+    output << "\n\nEnter the number which corresponds with one of the following functions:";
+    output << "\n\n0 --> f(x) = x^2";
+    output << "\n\n1 --> f(x) = x^3";
+    output << "\n\n2 --> f(x) = sin(x)";
+    output << "\n\n3 --> f(x) = cos(x)";
+    output << "\n\n4 --> f(x) = sqrt(x)";
+    output << "\n\n5 --> f(x) = 2x + 3";
+    output << "\n\nEnter Option Here: ";
+
+    /**
+     * Scan the command line terminal for the most recent keyboard input value. 
+     * Store that value (which is coerced to be of type int upon storage) in the variable named option.
+     */
+    std::cin >> option;
+
+    // Print "The value which was entered for option is {option}." to the command line terminal.
+    output.console << "\nThe value which was entered for option is " << option << ".";
+
+    // Print "The value which was entered for option is {option}." to the file output stream.
+    output.file << "\n\nThe value which was entered for option is " << option << ".";
+
+    /**
+     * If option is smaller than 0 or if option is larger than 5, set option to 0
+     * and print a message stating that fact to the command line terminal and to the output file stream.
+     */
+    if ((option < 0) || (option > 5))
+    {
+        option = 0;
+        output << "\n\noption was set to 0 by default due to the fact that the value input by the user was not recognized.";
+    }
+    selected_option = option;
+
+    /**
+     * Print a message about which function was selected by the user to the command line terminal and to the file output stream 
+     * and return that selected function's corresponding Function type object.
+     */
+    if (option == 0) 
+    {
+        output << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = x^2.";
+        return func_0;
+    }
+    if (option == 1) 
+    {
+        output << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = x^3.";
+        return func_1;
+    }
+    if (option == 2) 
+    {
+        output << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = sin(x).";
+        return func_2;
+    }
+    if (option == 3) 
+    {
+        output << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = cos(x).";
+        return func_3;
+    }
+    if (option == 4) 
+    {
+        output << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = sqrt(x).";
+        return func_4;
+    }
+    if (option == 5) 
+    {
+        output << "\n\nThe single-variable function which was selected from the list of such functions is f(x) = 2x + 3.";
+        return func_5;
+    }
+    return func_0;
+}
+
+/**
+ * This function prompts the user to input three numerical values related to partitioning the x-axis of a Cartesian grid
+ * for the purpose of using each those partitions to instantiate a rectangle whose width is the partition length
+ * and whose height is where that rectangle's top left corner intersects with the graph of some single-variable function y = f(x).
+ * 
+ * a represents the left-most point of the aforementioned x-axis partition.
+ * 
+ * b represents the right-most point of the aforementioned x-axis partition.
+ * 
+ * n represents the number of equally-sized partitions to divide the x-axis partition, [a,b], into.
+ * 
+ * If an invalid input to this function is detected, then this function will return a Parameters instance with default values as follows:
+ * 
+ * { a : 0.0, b : 1.0, n : 10 }.
+ */
+Parameters selectPartitioningValues(TeeOutput & output)
+{
+    // Define two double-type variables for storing values which represent the end points of an x-axis interval.
+    double a = 0.0, b = 0.0;
+
+    // Define one int-type variable for storing the number of equally sized partitions to divide the aforementioned x-axis interval into.
+    int n = 1;
+
+    // Define a read-only default Parameters value to use as a reference to replace invalid user-input values with correct values.
+    const Parameters default_params = { 0.0, 1.0, 10 };
+
+    /*****************************/
+    /* Get User Input: a         */
+    /*****************************/
+
+    // Print a message to the command line terminal which prompts the user to input a value to store in the variable named a.
+    output << "\n\nEnter a value to store in double-type variable a (which represents the left end of the x-axis interval): ";
+
+    /**
+     * Scan the command line terminal for the most recent keyboard input value. 
+     * Store that value in the variable named a.
+     */
+    std::cin >> a;
+
+    // Print "The value which was entered for a is {a}." to the command line terminal.
+    output.console << "\nThe value which was entered for a is " << a << ".";
+
+    // Print "The value which was entered for a is {a}." to the file output stream.
+    output.file << "\n\nThe value which was entered for a is " << a << ".";
+
+    /**
+     * Print an error message to the command line terminal and to the output file stream if
+     * a is smaller than MINIMUM_a or if
+     * a is larger than MAXIMUM_a
+     * and return a default Parameters instance.
+     */
+    if ((a < MINIMUM_a) || (a > MAXIMUM_a))
+    {
+        output << "\n\nInvalid interval end-point. a is required to be within range [" << MINIMUM_a << "," << MAXIMUM_a << "].";
+        output << "\n\nHence, default program values are being used to replace user inputs for the Reimann Sum partitioning parameters.";
+        return default_params;
+    }
+
+    /*****************************/
+    /* Get User Input: b         */
+    /*****************************/
+
+    // Print a message to the command line terminal which prompts the user to input a value to store in the variable named b.
+    output << "\n\nEnter a value to store in double-type variable b (which represents the right end of the x-axis interval): ";
+
+    /**
+     * Scan the command line terminal for the most recent keyboard input value. 
+     * Store that value in the variable named a.
+     */
+    std::cin >> b;
+
+    // Print "The value which was entered for b is {b}." to the command line terminal.
+    output.console << "\nThe value which was entered for b is " << b << ".";
+
+    // Print "The value which was entered for b is {b}." to the file output stream.
+    output.file << "\n\nThe value which was entered for b is " << b << ".";
+
+    /**
+     * Print an error message to the command line terminal and to the output file stream if
+     * b is smaller than or equal to a or if
+     * b is larger than MAXIMUM_a
+     * and return a default Parameters instance.
+     */
+    if ((b <= a) || (b > MAXIMUM_a))
+    {
+        output << "\n\nInvalid interval end-point. b is required to be within range (" << a << "," << MAXIMUM_a << "].";
+        output << "\n\nHence, default program values are being used to replace user inputs for the Reimann Sum partitioning parameters.";
+        return default_params;
+    }
+
+    /*****************************/
+    /* Get User Input: n         */
+    /*****************************/
+
+    // Print a message to the command line terminal which prompts the user to input a value to store in the variable named n.
+    output << "\n\nEnter a value to store in int-type variable n (which represents the number of equally-sized partitions to divide x-axis interval [a,b] into): ";
+
+    /**
+     * Scan the command line terminal for the most recent keyboard input value. 
+     * Store that value in the variable named a.
+     */
+    std::cin >> n;
+
+    // Print "The value which was entered for n is {n}." to the command line terminal.
+    output.console << "\nThe value which was entered for n is " << n << ".";
+
+    // Print "The value which was entered for n is {n}." to the file output stream.
+    output.file << "\n\nThe value which was entered for n is " << n << ".";
+
+    /**
+     * Print an error message to the command line terminal and to the output file stream if
+     * n is smaller than one or if
+     * n is larger than MAXIMUM_a
+     * and return a default Parameters instance.
+     */
+    if ((n < 1) || (n > MAXIMUM_a))
+    {
+        output << "\n\nInvalid partition number. n is required to be a natural number within range [1," << MAXIMUM_a << "].";
+        output << "\n\nHence, default program values are being used to replace user inputs for the Reimann Sum partitioning parameters.";
+        return default_params;
+    }
+
+    /**
+     * Print a message about which x-axis interval and partition number were selected 
+     * by the user to the command line terminal and to the file output stream.
+     */
+    output << "\n\nThe x-axis interval which was selected to partition is [" << a << "," << b << "].";
+    output << "\n\nThe selected number of equally-sized partitions to divide that interval into is " << n << ".";
+
+    // Return a struct whose data type is Parameters and whose data attributes are the values which the user entered during a runtime instance of this function.
+    return {a,b,n};
+}
+
+/**
+ * This function displays a list of Reimann Sum partitioning methods
+ * on the command line terminal and in the output file stream and
+ * prompts the program user to input an option number which corresponds
+ * with exactly one of the aforementioned methods. 
+ * 
+ * After the user enters some value, the corresponding string type
+ * object is returned.
+ */
+std::string selectRectangleConstructionMethod(TeeOutput & output)
+{
+    /**
+     * The following three read-only string variables each refer to a specific method of visualizing n rectangles 
+     * whose widths are the length of each one of the n partitions of [a,b] and 
+     * whose heights are f(xi) where xi is some point within [a,b].
+     * 
+     * "left" refers to the method of using the left end-point of each of the n partitions of [a,b] to set the height of each of the n rectangles.
+     * 
+     * "right" refers to the method of using the right end-point of each of the n partitions of [a,b] to set the height of each of the n rectangles.
+     * 
+     * "midpoint" refers to the method of using the middle point of each of the n partitions of [a,b] to set the height of each of the n rectangles.
+     */
+    const std::string method_0 = "left";
+    const std::string method_1 = "right";
+    const std::string method_2 = "midpoint";
+
+    // Initialize option to represent 0 (which is the associated with the first method in the above list).
+    int option = 0;
+
+    // Print menu options and the instruction to input an option number to the command line terminal and to the file output stream.
+    output << "\n\nEnter the number which corresponds with one of the following rectangle construction methods:";
+    output << "\n\n0 --> \"left\"";
+    output << "\n\n1 --> \"right\"";
+    output << "\n\n2 --> \"midpoint\"";
+    output << "\n\nEnter Option Here: ";
+
+    /**
+     * Scan the command line terminal for the most recent keyboard input value. 
+     * Store that value (which is coerced to be of type int upon storage) in the variable named option.
+     */
+    std::cin >> option;
+
+    // Print "The value which was entered for option is {option}." to the command line terminal.
+    output.console << "\nThe value which was entered for option is " << option << ".";
+
+    // Print "The value which was entered for option is {option}." to the file output stream.
+    output.file << "\n\nThe value which was entered for option is " << option << ".";
+
+    /**
+     * If option is smaller than 0 or if option is larger than 2, set option to 0
+     * and print a message stating that fact to the command line terminal and to the output file stream.
+     */
+    if ((option < 0) || (option > 2))
+    {
+        option = 0;
+        output << "\n\noption was set to 0 by default due to the fact that the value input by the user was not recognized.";
+    }
+
+    /**
+     * Print a message about which function was selected by the user to the command line terminal and to the file output stream 
+     * and return that selected method's corresponding string type object.
+     */
+    if (option == 0) 
+    {
+        output << "\n\nThe rectangle construction method which was selected from the list of such methods is \"left\" (i.e. using the left end-point of each of the n partitions of [a,b] to set the height of each of the n rectangles).";
+        return method_0;
+    }
+    if (option == 1) 
+    {
+        output << "\n\nThe rectangle construction method which was selected from the list of such methods is \"right\" (i.e. using the right end-point of each of the n partitions of [a,b] to set the height of each of the n rectangles).";
+        return method_1;
+    }
+    if (option == 2) 
+    {
+        output << "\n\nThe rectangle construction method which was selected from the list of such methods is \"midpoint\" (i.e. using the middle point of each of the n partitions of [a,b] to set the height of each of the n rectangles).";
+        return method_2;
+    }
+    return method_0;
+}
@@ -0,0 +1,316 @@
+/**
+ * file: root_finding.cpp
+ * type: C++ (source file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+/** preprocessing directives */
+#include <iostream> // standard output (std::cout)
+#include <cmath> // std::fabs, std::copysign, std::isnan, NAN
+#include <limits> // std::numeric_limits
+#include <vector> // std::vector
+#include "root_finding.h" // RootResult, DualNumber, function prototypes
+
+/**
+ * Define a struct-type variable named BrentState which stores one root search of Brent's method:
+ * b is the best estimate of the root, a is the previous estimate, c is the end-point which keeps the root bracketed
+ * (i.e. f(b) and f(c) have opposite signs), d is the latest step, and e is the step before it.
+ */
+struct BrentState {
+    double a, b, c, fa, fb, fc, d, e;
+};
+
+/**
+ * Start a Brent search on the bracket [a,b] (whose end-point values fa and fb have opposite signs).
+ */
+static BrentState startBrent(double a, double b, double fa, double fb)
+{
+    return { a, b, b, fa, fb, fb, b - a, b - a };
+}
+
+/**
+ * Perform the part of one iteration of Brent's method which comes before the evaluation of f.
+ *
+ * Return false if state.b is already within the tolerance of the root. Otherwise move state.b to the next point at which f
+ * is to be evaluated (an inverse quadratic interpolation step, a secant step, or a bisection step, whichever is safe) and return true.
+ *
+ * The scalar function findRootBrent and the batch function findRootsBrent share this step, so both find the same roots.
+ */
+static bool advanceBrent(BrentState & state, double tolerance)
+{
+    const double epsilon = std::numeric_limits<double>::epsilon();
+
+    // Keep the root bracketed by [b,c].
+    if (((state.fb > 0) && (state.fc > 0)) || ((state.fb < 0) && (state.fc < 0)))
+    {
+        state.c = state.a;
+        state.fc = state.fa;
+        state.d = state.e = state.b - state.a;
+    }
+
+    // Let b be the end-point whose value of f is nearer to zero.
+    if (std::fabs(state.fc) < std::fabs(state.fb))
+    {
+        state.a = state.b;
+        state.b = state.c;
+        state.c = state.a;
+        state.fa = state.fb;
+        state.fb = state.fc;
+        state.fc = state.fa;
+    }
+
+    const double tolerance_at_b = 2 * epsilon * std::fabs(state.b) + tolerance / 2;
+    const double half_bracket = (state.c - state.b) / 2;
+    if ((std::fabs(half_bracket) <= tolerance_at_b) || (state.fb == 0)) return false;
+
+    if ((std::fabs(state.e) >= tolerance_at_b) && (std::fabs(state.fa) > std::fabs(state.fb)))
+    {
+        // Attempt inverse quadratic interpolation (or the secant method if only two distinct points are known).
+        double s = state.fb / state.fa, p = 0.0, q = 0.0;
+        if (state.a == state.c)
+        {
+            p = 2 * half_bracket * s;
+            q = 1 - s;
+        }
+        else
+        {
+            double r = state.fb / state.fc;
+            q = state.fa / state.fc;
+            p = s * (2 * half_bracket * q * (q - r) - (state.b - state.a) * (r - 1));
+            q = (q - 1) * (r - 1) * (s - 1);
+        }
+        if (p > 0) q = -q;
+        p = std::fabs(p);
+
+        // Accept the interpolation only if it stays inside of the bracket and shrinks faster than the bisections would.
+        double limit_1 = 3 * half_bracket * q - std::fabs(tolerance_at_b * q);
+        double limit_2 = std::fabs(state.e * q);
+        if (2 * p < ((limit_1 < limit_2) ? limit_1 : limit_2))
+        {
+            state.e = state.d;
+            state.d = p / q;
+        }
+        else
+        {
+            state.d = half_bracket;
+            state.e = state.d;
+        }
+    }
+    else
+    {
+        // Bisect.
+        state.d = half_bracket;
+        state.e = state.d;
+    }
+
+    state.a = state.b;
+    state.fa = state.fb;
+    state.b += (std::fabs(state.d) > tolerance_at_b) ? state.d : std::copysign(tolerance_at_b, half_bracket);
+    return true;
+}
+
+/**
+ * This function finds a root of the single variable function, y = f(x), in the x-axis interval [a,b] (i.e. an x for which f(x) = 0)
+ * using Brent's method, which combines inverse quadratic interpolation (which converges quickly where f is smooth) with bisection
+ * (which guarantees that the bracket keeps shrinking).
+ *
+ * f(a) and f(b) are required to have opposite signs (or to be zero). If they do not, an error message is printed to the
+ * command line terminal and the returned root is NaN (not a number).
+ *
+ * To solve f(x) = target, find a root of f(x) - target (e.g. [&](double x) { return integ(x) - target; }).
+ */
+RootResult findRootBrent(const Function & func, double a, double b, double tolerance, int maximum_iterations)
+{
+    RootResult result = { NAN, NAN, 0, 2, false };
+    double fa = func(a), fb = func(b);
+    if (fa == 0) return { a, fa, 0, 2, true };
+    if (fb == 0) return { b, fb, 0, 2, true };
+    if (std::isnan(fa) || std::isnan(fb) || ((fa > 0) == (fb > 0)))
+    {
+        std::cout << "\n\nThe root is not bracketed. f(a) and f(b) are required to have opposite signs.";
+        return result;
+    }
+
+    BrentState state = startBrent(a, b, fa, fb);
+    while (result.iterations < maximum_iterations)
+    {
+        if (!advanceBrent(state, tolerance))
+        {
+            result.converged = true;
+            break;
+        }
+        state.fb = func(state.b);
+        result.evaluations += 1;
+        result.iterations += 1;
+    }
+    result.root = state.b;
+    result.residual = state.fb;
+    return result;
+}
+
+/**
+ * This function finds a root of the single variable function, y = f(x), in the x-axis interval [a,b] using Newton's method,
+ * x <-- x - f(x) / f'(x), where func stores both f(x) and f'(x).
+ *
+ * The method is safeguarded: a bracket of the root is kept, and any Newton step which would leave the bracket (or which
+ * does not at least halve the previous step) is replaced by a bisection, so the search converges for any bracketed root.
+ *
+ * f(a) and f(b) are required to have opposite signs (or to be zero). If they do not, an error message is printed to the
+ * command line terminal and the returned root is NaN (not a number).
+ */
+RootResult findRootNewton(const ValueAndSlopeFunction & func, double a, double b, double tolerance, int maximum_iterations)
+{
+    RootResult result = { NAN, NAN, 0, 2, false };
+    double fa = 0.0, fb = 0.0, slope = 0.0;
+    func(a, fa, slope);
+    func(b, fb, slope);
+    if (fa == 0) return { a, fa, 0, 2, true };
+    if (fb == 0) return { b, fb, 0, 2, true };
+    if (std::isnan(fa) || std::isnan(fb) || ((fa > 0) == (fb > 0)))
+    {
+        std::cout << "\n\nThe root is not bracketed. f(a) and f(b) are required to have opposite signs.";
+        return result;
+    }
+
+    // Orient the bracket so that f(low) < 0 < f(high).
+    double low = (fa < 0) ? a : b;
+    double high = (fa < 0) ? b : a;
+    double x = (a + b) / 2, previous_step = std::fabs(b - a), step = previous_step;
+    double value = 0.0;
+    func(x, value, slope);
+    result.evaluations += 1;
+
+    while (result.iterations < maximum_iterations)
+    {
+        result.iterations += 1;
+        bool newton_leaves_bracket = (((x - high) * slope - value) * ((x - low) * slope - value) > 0);
+        if (newton_leaves_bracket || (std::fabs(2 * value) > std::fabs(previous_step * slope)))
+        {
+            previous_step = step;
+            step = (high - low) / 2;
+            x = low + step;
+        }
+        else
+        {
+            previous_step = step;
+            step = value / slope;
+            x -= step;
+        }
+        const double tolerance_at_x = 2 * std::numeric_limits<double>::epsilon() * std::fabs(x) + tolerance / 2;
+        if (std::fabs(step) <= tolerance_at_x)
+        {
+            result.converged = true;
+            break;
+        }
+        func(x, value, slope);
+        result.evaluations += 1;
+        if (value == 0)
+        {
+            result.converged = true;
+            break;
+        }
+        if (value < 0) low = x;
+        else high = x;
+    }
+    result.root = x;
+    result.residual = value;
+    return result;
+}
+
+/**
+ * Find a root of f in [a,b] with the safeguarded Newton method, where func_prime is the derivative of f
+ * (e.g. derivative(f) from fundamental_theorem_of_calculus.h).
+ */
+RootResult findRootNewton(const Function & func, const Function & func_prime, double a, double b, double tolerance, int maximum_iterations)
+{
+    ValueAndSlopeFunction value_and_slope = [&func, &func_prime](double x, double & value, double & slope)
+    {
+        value = func(x);
+        slope = func_prime(x);
+    };
+    return findRootNewton(value_and_slope, a, b, tolerance, maximum_iterations);
+}
+
+/**
+ * Solve the count independent equations f(x) = targets[i] for x in [a[i], b[i]] (for i = 0, ..., count - 1) with Brent's
+ * method and store each solution in roots[i].
+ *
+ * Every iteration evaluates f at the next point of every unfinished search with one call of kernel (which receives a
+ * contiguous array of x values), so a vectorized kernel computes many roots per call instead of one. With a pool, each thread
+ * solves its own chunks of DEFAULT_ROOT_BATCH_CHUNK_LENGTH equations.
+ *
+ * If an equation is not bracketed by its interval (or does not converge within MAXIMUM_ROOT_ITERATIONS), its root is NaN.
+ *
+ * Return the number of equations which were solved.
+ */
+long long findRootsBrent(const BatchKernel & kernel, const double * targets, const double * a, const double * b, double * roots, long long count, double tolerance, ThreadPool * pool)
+{
+    if (count <= 0) return 0;
+    std::vector<long long> chunk_solved((count + DEFAULT_ROOT_BATCH_CHUNK_LENGTH - 1) / DEFAULT_ROOT_BATCH_CHUNK_LENGTH, 0);
+
+    auto solveChunk = [&](long long begin, long long end)
+    {
+        const long long length = end - begin;
+        std::vector<BrentState> states(length);
+        std::vector<long long> active;
+        std::vector<double> x(2 * length), y(2 * length);
+
+        // Evaluate f at both end-points of every interval with one call of kernel.
+        for (long long i = 0; i < length; i += 1)
+        {
+            x[2 * i] = a[begin + i];
+            x[2 * i + 1] = b[begin + i];
+        }
+        kernel(x.data(), y.data(), 2 * length);
+
+        long long solved = 0;
+        for (long long i = 0; i < length; i += 1)
+        {
+            double fa = y[2 * i] - targets[begin + i], fb = y[2 * i + 1] - targets[begin + i];
+            roots[begin + i] = NAN;
+            if (fa == 0) roots[begin + i] = a[begin + i];
+            else if (fb == 0) roots[begin + i] = b[begin + i];
+            else if (!std::isnan(fa) && !std::isnan(fb) && ((fa > 0) != (fb > 0)))
+            {
+                states[i] = startBrent(a[begin + i], b[begin + i], fa, fb);
+                active.push_back(i);
+                continue;
+            }
+            if (!std::isnan(roots[begin + i])) solved += 1;
+        }
+
+        // Advance every unfinished search by one iteration per call of kernel.
+        for (int iteration = 0; (iteration < MAXIMUM_ROOT_ITERATIONS) && !active.empty(); iteration += 1)
+        {
+            long long remaining = 0;
+            for (long long i : active)
+            {
+                if (advanceBrent(states[i], tolerance))
+                {
+                    x[remaining] = states[i].b;
+                    active[remaining] = i;
+                    remaining += 1;
+                }
+                else
+                {
+                    roots[begin + i] = states[i].b;
+                    solved += 1;
+                }
+            }
+            active.resize(remaining);
+            if (remaining == 0) break;
+            kernel(x.data(), y.data(), remaining);
+            for (long long k = 0; k < remaining; k += 1) states[active[k]].fb = y[k] - targets[begin + active[k]];
+        }
+        chunk_solved[begin / DEFAULT_ROOT_BATCH_CHUNK_LENGTH] = solved;
+    };
+
+    if (pool) pool->parallelFor(count, DEFAULT_ROOT_BATCH_CHUNK_LENGTH, solveChunk);
+    else for (long long begin = 0; begin < count; begin += DEFAULT_ROOT_BATCH_CHUNK_LENGTH) solveChunk(begin, (begin + DEFAULT_ROOT_BATCH_CHUNK_LENGTH < count) ? (begin + DEFAULT_ROOT_BATCH_CHUNK_LENGTH) : count);
+
+    long long solved = 0;
+    for (long long chunk : chunk_solved) solved += chunk;
+    return solved;
+}
@@ -0,0 +1,92 @@
+/**
+ * file: root_finding.h
+ * type: C++ (header file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+#ifndef ROOT_FINDING_H
+#define ROOT_FINDING_H
+
+/** preprocessing directives */
+#include <cmath> // std::sin, std::cos, std::exp, std::log, std::sqrt
+#include <functional> // std::function
+#include "reimann_sum.h" // Function
+#include "batch_evaluation.h" // BatchKernel
+#include "thread_pool.h" // ThreadPool
+#define DEFAULT_ROOT_TOLERANCE 1e-15 // constant which represents the default absolute x-axis tolerance of a root (to which twice the rounding error of the root is added)
+#define MAXIMUM_ROOT_ITERATIONS 200 // constant which represents the maximum number of iterations of one root search
+#define DEFAULT_ROOT_BATCH_CHUNK_LENGTH 1024 // constant which represents the number of roots which one thread solves together in findRootsBrent
+
+/**
+ * Define a struct-type variable named RootResult which stores the root, x, which was found (i.e. f(x) ≈ 0),
+ * the value of f at that root (i.e. the residual),
+ * the number of iterations and the number of evaluations of f which were used,
+ * and whether the search converged (i.e. whether the root is bracketed by an x-axis interval no wider than the tolerance).
+ */
+struct RootResult {
+    double root;
+    double residual;
+    int iterations;
+    long long evaluations;
+    bool converged;
+};
+
+/**
+ * A ValueAndSlopeFunction stores f(x) in value and f'(x) in slope.
+ */
+using ValueAndSlopeFunction = std::function<void(double x, double & value, double & slope)>;
+
+/**
+ * A DualNumber stores the value of an expression and the derivative (i.e. the slope) of that expression with respect to x.
+ *
+ * Evaluating a generic callable (e.g. [](auto x) { return x * x * x - 2 * sin(x); }) at DualNumber{ x, 1 } returns both f(x)
+ * and the exact f'(x) (up to rounding error) in one pass, which is forward-mode automatic differentiation.
+ */
+struct DualNumber {
+    double value;
+    double slope;
+};
+
+inline DualNumber operator + (DualNumber u, DualNumber v) { return { u.value + v.value, u.slope + v.slope }; }
+inline DualNumber operator - (DualNumber u, DualNumber v) { return { u.value - v.value, u.slope - v.slope }; }
+inline DualNumber operator * (DualNumber u, DualNumber v) { return { u.value * v.value, u.slope * v.value + u.value * v.slope }; }
+inline DualNumber operator / (DualNumber u, DualNumber v) { return { u.value / v.value, (u.slope * v.value - u.value * v.slope) / (v.value * v.value) }; }
+inline DualNumber operator - (DualNumber u) { return { -u.value, -u.slope }; }
+inline DualNumber operator + (DualNumber u, double c) { return { u.value + c, u.slope }; }
+inline DualNumber operator + (double c, DualNumber u) { return { c + u.value, u.slope }; }
+inline DualNumber operator - (DualNumber u, double c) { return { u.value - c, u.slope }; }
+inline DualNumber operator - (double c, DualNumber u) { return { c - u.value, -u.slope }; }
+inline DualNumber operator * (DualNumber u, double c) { return { u.value * c, u.slope * c }; }
+inline DualNumber operator * (double c, DualNumber u) { return { c * u.value, c * u.slope }; }
+inline DualNumber operator / (DualNumber u, double c) { return { u.value / c, u.slope / c }; }
+inline DualNumber operator / (double c, DualNumber u) { return { c / u.value, -c * u.slope / (u.value * u.value) }; }
+inline DualNumber sin(DualNumber u) { return { std::sin(u.value), std::cos(u.value) * u.slope }; }
+inline DualNumber cos(DualNumber u) { return { std::cos(u.value), -std::sin(u.value) * u.slope }; }
+inline DualNumber exp(DualNumber u) { double e = std::exp(u.value); return { e, e * u.slope }; }
+inline DualNumber log(DualNumber u) { return { std::log(u.value), u.slope / u.value }; }
+inline DualNumber sqrt(DualNumber u) { double s = std::sqrt(u.value); return { s, u.slope / (2 * s) }; }
+
+/** function prototypes */
+RootResult findRootBrent(const Function & func, double a, double b, double tolerance = DEFAULT_ROOT_TOLERANCE, int maximum_iterations = MAXIMUM_ROOT_ITERATIONS);
+RootResult findRootNewton(const ValueAndSlopeFunction & func, double a, double b, double tolerance = DEFAULT_ROOT_TOLERANCE, int maximum_iterations = MAXIMUM_ROOT_ITERATIONS);
+RootResult findRootNewton(const Function & func, const Function & func_prime, double a, double b, double tolerance = DEFAULT_ROOT_TOLERANCE, int maximum_iterations = MAXIMUM_ROOT_ITERATIONS);
+long long findRootsBrent(const BatchKernel & kernel, const double * targets, const double * a, const double * b, double * roots, long long count, double tolerance = DEFAULT_ROOT_TOLERANCE, ThreadPool * pool = nullptr);
+
+/**
+ * Find a root of the generic callable func in [a,b] with the safeguarded Newton method, where each f'(x) is computed exactly
+ * by evaluating func at a DualNumber (so func must accept a DualNumber argument, e.g. [](auto x) { return x * x - 2; }).
+ */
+template <typename Callable> RootResult findRootNewtonDual(Callable func, double a, double b, double tolerance = DEFAULT_ROOT_TOLERANCE, int maximum_iterations = MAXIMUM_ROOT_ITERATIONS)
+{
+    ValueAndSlopeFunction value_and_slope = [func](double x, double & value, double & slope)
+    {
+        DualNumber result = func(DualNumber{ x, 1.0 });
+        value = result.value;
+        slope = result.slope;
+    };
+    return findRootNewton(value_and_slope, a, b, tolerance, maximum_iterations);
+}
+
+#endif // ROOT_FINDING_H
@@ -0,0 +1,213 @@
+/**
+ * file: tanh_sinh.cpp
+ * type: C++ (source file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+/** preprocessing directives */
+#include <iostream> // standard output (std::cout)
+#include <cmath> // std::exp, std::sinh, std::cosh, std::isfinite, std::isinf, std::isnan, std::fabs
+#include <limits> // std::numeric_limits
+#include "tanh_sinh.h" // TanhSinhResult, function prototypes
+#define TANH_SINH_HALF_PI 1.5707963267948966 // constant which represents Pi / 2
+#define MAXIMUM_TANH_SINH_t 6.5 // constant which represents the largest |t| at which a tanh-sinh integral samples (beyond it every transformed point overflows or reaches an end-point)
+#define MINIMUM_TANH_SINH_TRUNCATION_t 2 // constant which represents the smallest |t| at which an infinite term ends the sampling (the points with |t| >= 2 lie within about 2e-5 half-widths of a finite end-point)
+
+/**
+ * The three substitutions x = x(t) which map t in (-infinity, infinity) onto the x-axis interval of an integral:
+ *
+ * TANH_SINH: x = c + h * tanh(Pi / 2 * sinh(t)) for a finite interval [c - h, c + h].
+ * EXP_SINH: x = origin + direction * exp(Pi / 2 * sinh(t)) for [origin, infinity) (direction = 1) or (-infinity, origin] (direction = -1).
+ * SINH_SINH: x = sinh(Pi / 2 * sinh(t)) for (-infinity, infinity).
+ *
+ * Each substitution makes the transformed integrand, f(x(t)) * x'(t), decay double-exponentially as |t| grows (even if f has an
+ * integrable singularity at an end-point), so the trapezoidal rule in t converges very quickly.
+ */
+enum TanhSinhSubstitution { TANH_SINH, EXP_SINH, SINH_SINH };
+
+/**
+ * Define a struct-type variable named TanhSinhInterval which stores the substitution of one integral and its constants.
+ */
+struct TanhSinhInterval {
+    TanhSinhSubstitution substitution;
+    double a, b, half_width, origin, direction;
+};
+
+/**
+ * Store x(t) in x and the weight x'(t) in weight.
+ *
+ * Return false if the point is not usable (i.e. if it rounds onto an end-point, overflows, or has a zero weight).
+ *
+ * For TANH_SINH, the distance from x to the nearer end-point, h * (1 - tanh(|u|)) = h * 2 / (exp(2 * |u|) + 1), is computed
+ * directly (instead of as the difference of two nearly equal numbers), so the points which cluster at an end-point keep their precision.
+ */
+static bool transformedPoint(const TanhSinhInterval & interval, double t, double & x, double & weight)
+{
+    double u = TANH_SINH_HALF_PI * std::sinh(t);
+    double derivative_of_u = TANH_SINH_HALF_PI * std::cosh(t);
+    if (interval.substitution == TANH_SINH)
+    {
+        double complement = 2.0 / (std::exp(2.0 * std::fabs(u)) + 1.0);
+        x = (t >= 0) ? (interval.b - interval.half_width * complement) : (interval.a + interval.half_width * complement);
+        weight = interval.half_width * derivative_of_u * complement * (2.0 - complement);
+        return (x > interval.a) && (x < interval.b) && (weight > 0);
+    }
+    if (interval.substitution == EXP_SINH)
+    {
+        double distance = std::exp(u);
+        x = interval.origin + interval.direction * distance;
+        weight = derivative_of_u * distance;
+        return (x != interval.origin) && std::isfinite(x) && std::isfinite(weight) && (weight > 0);
+    }
+    x = std::sinh(u);
+    weight = derivative_of_u * std::cosh(u);
+    return std::isfinite(x) && std::isfinite(weight);
+}
+
+/**
+ * Return true if a term which is not finite only marks the end of the usable points on one side (i.e. if the term overflowed to infinity
+ * at a point which lies right at an end-point, as the terms of an integrable singularity at that end-point may). A term which is
+ * "not a number" (anywhere) or infinite away from the end-points makes the integral not a number or infinite instead.
+ */
+static bool isEndPointTruncation(double term, double t)
+{
+    return std::isinf(term) && (std::fabs(t) >= MINIMUM_TANH_SINH_TRUNCATION_t);
+}
+
+/**
+ * This function computes the (approximate) definite integral of a single variable function, y = f(x), on the x-axis
+ * interval [a,b] using tanh-sinh (double-exponential) quadrature.
+ *
+ * a may be -INFINITY and b may be INFINITY (in which case the interval is mapped with an exp-sinh or a sinh-sinh substitution).
+ * f is never evaluated at a finite end-point, so f may be infinite there (e.g. 1 / sqrt(x) on [0,1]), and integrands such
+ * as sqrt(x) whose derivative is unbounded at an end-point converge as quickly as smooth integrands.
+ *
+ * The substituted integral is summed with the trapezoidal rule of step 1, 1/2, 1/4, ... in t. Each level only evaluates the
+ * new (odd) points and reuses the sum of all the earlier levels, and the points whose contribution is negligible at level 0
+ * bound the t-axis interval of every later level. Refinement stops when two consecutive levels differ by no more than
+ * tolerance times the integral of |f|. Because the error of each level is about the square of the error of the level
+ * before it, the default tolerance (1e-9) usually gives an estimate accurate to near machine precision with a few hundred evaluations.
+ *
+ * If a > b, the returned estimate is the negative of the integral on [b,a].
+ *
+ * If f is "not a number" at some sampled point (e.g. sqrt(x) on [-10,0]) or infinite at a sampled point which is not right at an end-point,
+ * the returned estimate is "not a number" (or infinite) and the error estimate is infinite (instead of an estimate which skips those points).
+ */
+TanhSinhResult integrateTanhSinh(const Function & func, double a, double b, double tolerance, int maximum_level)
+{
+    TanhSinhResult result = { 0.0, 0.0, 0, 0 };
+
+    // Return zero if an end-point is not a number. Then print a message about that to the command line terminal.
+    if (std::isnan(a) || std::isnan(b))
+    {
+        std::cout << "\n\nAn end-point of the tanh-sinh integral was not a number. Hence, the integral has been set to 0.";
+        return result;
+    }
+    if (a == b) return result;
+
+    // Integrate over [b,a] and negate the estimate if the end-points are reversed.
+    double sign = 1.0;
+    if (a > b)
+    {
+        double c = a;
+        a = b;
+        b = c;
+        sign = -1.0;
+    }
+
+    // Set maximum_level to the default value if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((maximum_level < 0) || (maximum_level > MAXIMUM_TANH_SINH_LEVEL))
+    {
+        std::cout << "\n\nThe maximum tanh-sinh level was out of range. Hence, the maximum level has been reset to " << MAXIMUM_TANH_SINH_LEVEL << ".";
+        maximum_level = MAXIMUM_TANH_SINH_LEVEL;
+    }
+
+    // Choose the substitution which maps (-infinity, infinity) onto [a,b].
+    TanhSinhInterval interval = { TANH_SINH, a, b, (b - a) / 2, 0.0, 1.0 };
+    if (std::isinf(a) && std::isinf(b)) interval.substitution = SINH_SINH;
+    else if (std::isinf(b)) interval = { EXP_SINH, a, b, 0.0, a, 1.0 };
+    else if (std::isinf(a)) interval = { EXP_SINH, a, b, 0.0, b, -1.0 };
+    else if (!std::isfinite(interval.half_width)) interval.half_width = b / 2 - a / 2;
+
+    const double negligible = std::numeric_limits<double>::epsilon();
+    double x = 0.0, weight = 0.0;
+    double sum = 0.0, absolute_sum = 0.0;
+    long long evaluations = 0;
+
+    // Level 0 (step 1): sample t = 0, then walk outward (in each direction) until two consecutive terms are negligible or a point is not usable.
+    if (transformedPoint(interval, 0.0, x, weight))
+    {
+        double term = weight * func(x);
+        evaluations += 1;
+        sum += term;
+        absolute_sum += std::fabs(term);
+    }
+    double limits[2] = { 0.0, 0.0 };
+    for (int side = 0; side < 2; side += 1)
+    {
+        double direction = (side == 0) ? 1.0 : -1.0;
+        int negligible_terms = 0;
+        for (int j = 1; j <= static_cast<int>(MAXIMUM_TANH_SINH_t); j += 1)
+        {
+            if (!transformedPoint(interval, direction * j, x, weight)) break;
+            double term = weight * func(x);
+            evaluations += 1;
+            if (isEndPointTruncation(term, j)) break;
+            sum += term;
+            absolute_sum += std::fabs(term);
+            limits[side] = j;
+            if (!std::isfinite(sum)) break;
+            negligible_terms = (std::fabs(term) <= negligible * absolute_sum) ? (negligible_terms + 1) : 0;
+            if (negligible_terms == 2) break;
+        }
+        // Let the finer levels sample up to (almost) the next level-0 point (where the terms were still usable or not yet negligible).
+        limits[side] = (limits[side] + 1.0 < MAXIMUM_TANH_SINH_t) ? (limits[side] + 1.0) : MAXIMUM_TANH_SINH_t;
+    }
+
+    double step = 1.0;
+    double estimate = sum * step;
+    double error_estimate = std::fabs(estimate);
+    int level = 0;
+
+    // Levels 1, 2, ...: halve the step and add only the new (odd) points t = (2 * k + 1) * step (unless the sum is already not finite).
+    while ((level < maximum_level) && std::isfinite(sum))
+    {
+        level += 1;
+        step /= 2;
+        for (int side = 0; side < 2; side += 1)
+        {
+            double direction = (side == 0) ? 1.0 : -1.0;
+            for (long long k = 1; k * step < limits[side]; k += 2)
+            {
+                if (!transformedPoint(interval, direction * k * step, x, weight))
+                {
+                    limits[side] = k * step;
+                    break;
+                }
+                double term = weight * func(x);
+                evaluations += 1;
+                if (isEndPointTruncation(term, k * step))
+                {
+                    limits[side] = k * step;
+                    break;
+                }
+                sum += term;
+                absolute_sum += std::fabs(term);
+                if (!std::isfinite(sum)) break;
+            }
+        }
+        double refined_estimate = sum * step;
+        error_estimate = std::fabs(refined_estimate - estimate);
+        estimate = refined_estimate;
+        if (!std::isfinite(sum)) break;
+        if ((level >= MINIMUM_TANH_SINH_LEVEL) && (error_estimate <= tolerance * absolute_sum * step)) break;
+    }
+
+    result.estimate = sign * estimate;
+    result.error_estimate = std::isfinite(estimate) ? error_estimate : std::numeric_limits<double>::infinity();
+    result.evaluations = evaluations;
+    result.levels = level;
+    return result;
+}
@@ -0,0 +1,35 @@
+/**
+ * file: tanh_sinh.h
+ * type: C++ (header file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+#ifndef TANH_SINH_H
+#define TANH_SINH_H
+
+/** preprocessing directives */
+#include "reimann_sum.h" // Function
+#define DEFAULT_TANH_SINH_TOLERANCE 1e-9 // constant which represents the default relative difference between two levels at which a tanh-sinh integral stops refining
+#define MAXIMUM_TANH_SINH_LEVEL 10 // constant which represents the maximum number of times a tanh-sinh integral halves its step (i.e. at most about 2 * 2 ^ 10 * 4 evaluations)
+#define MINIMUM_TANH_SINH_LEVEL 3 // constant which represents the number of times a tanh-sinh integral halves its step before it may stop
+
+/**
+ * Define a struct-type variable named TanhSinhResult which stores the estimate of an integral,
+ * the error estimate of that integral (i.e. the absolute difference between the last two levels of refinement, or infinity if the
+ * estimate is not finite because f is "not a number" or infinite inside of the interval),
+ * the number of function evaluations which were used,
+ * and the number of levels of refinement (i.e. the step of the last level is 2 ^ -levels).
+ */
+struct TanhSinhResult {
+    double estimate;
+    double error_estimate;
+    long long evaluations;
+    int levels;
+};
+
+/** function prototypes */
+TanhSinhResult integrateTanhSinh(const Function & func, double a, double b, double tolerance = DEFAULT_TANH_SINH_TOLERANCE, int maximum_level = MAXIMUM_TANH_SINH_LEVEL);
+
+#endif // TANH_SINH_H
@@ -0,0 +1,150 @@
+/**
+ * file: tee_output.cpp
+ * type: C++ (source file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+/** preprocessing directives */
+#include <iostream> // standard output (std::cout)
+#include <charconv> // std::to_chars
+#include <cstring> // std::memcpy, std::strlen
+#include "tee_output.h" // TeeOutput
+#define TEE_OUTPUT_NUMBER_CHARACTERS 64 // constant which represents the largest number of characters which one formatted number can occupy
+
+/**
+ * Open (or create and overwrite) the plain-text file named file_name.
+ *
+ * If that file cannot be opened, a message is printed to the command line terminal and only the command line terminal is written to.
+ */
+TeeOutput::TeeOutput(const std::string & file_name, std::size_t buffer_capacity) : console(*this, TO_CONSOLE), file(*this, TO_FILE), buffer_capacity(buffer_capacity)
+{
+    // Set buffer_capacity to the default value if the function input value is out or range.
+    if (this->buffer_capacity < TEE_OUTPUT_NUMBER_CHARACTERS) this->buffer_capacity = DEFAULT_TEE_OUTPUT_BUFFER_CAPACITY;
+
+    file_handle = std::fopen(file_name.c_str(), "wb");
+    if (file_handle == nullptr)
+    {
+        std::cout << "\n\nThe output file named " << file_name << " could not be opened. Hence, program output is only printed to the command line terminal.";
+        return;
+    }
+
+    // The buffer below replaces the (much smaller) buffer of the C library.
+    std::setvbuf(file_handle, nullptr, _IONBF, 0);
+    buffer = new char[this->buffer_capacity];
+}
+
+TeeOutput::~TeeOutput()
+{
+    close();
+}
+
+/**
+ * Write every buffered character to the output file (and push std::cout to the command line terminal).
+ */
+void TeeOutput::flush()
+{
+    std::cout.flush();
+    if ((file_handle != nullptr) && (buffer_length > 0))
+    {
+        std::fwrite(buffer, 1, buffer_length, file_handle);
+        buffer_length = 0;
+    }
+}
+
+/**
+ * Flush the buffers and close the output file.
+ */
+void TeeOutput::close()
+{
+    flush();
+    if (file_handle != nullptr) std::fclose(file_handle);
+    file_handle = nullptr;
+    delete[] buffer;
+    buffer = nullptr;
+}
+
+/**
+ * Copy length characters to the command line terminal and/or to the file buffer (depending on targets).
+ */
+void TeeOutput::append(Targets targets, const char * characters, std::size_t length)
+{
+    if (targets & TO_CONSOLE) std::cout.write(characters, static_cast<std::streamsize>(length));
+    if (!(targets & TO_FILE) || (file_handle == nullptr)) return;
+
+    // Text which does not fit inside of the remaining buffer space is preceded by one big write of the buffer (and very long text bypasses the buffer).
+    if (buffer_length + length > buffer_capacity)
+    {
+        std::fwrite(buffer, 1, buffer_length, file_handle);
+        buffer_length = 0;
+        if (length > buffer_capacity)
+        {
+            std::fwrite(characters, 1, length, file_handle);
+            return;
+        }
+    }
+    std::memcpy(buffer + buffer_length, characters, length);
+    buffer_length += length;
+}
+
+void TeeOutput::put(Targets targets, const char * text)
+{
+    append(targets, text, std::strlen(text));
+}
+
+void TeeOutput::put(Targets targets, const std::string & text)
+{
+    append(targets, text.data(), text.size());
+}
+
+void TeeOutput::put(Targets targets, char character)
+{
+    append(targets, &character, 1);
+}
+
+void TeeOutput::put(Targets targets, int value)
+{
+    put(targets, static_cast<long long>(value));
+}
+
+void TeeOutput::put(Targets targets, long value)
+{
+    put(targets, static_cast<long long>(value));
+}
+
+void TeeOutput::put(Targets targets, long long value)
+{
+    char characters[TEE_OUTPUT_NUMBER_CHARACTERS];
+    std::to_chars_result result = std::to_chars(characters, characters + sizeof(characters), value);
+    append(targets, characters, static_cast<std::size_t>(result.ptr - characters));
+}
+
+void TeeOutput::put(Targets targets, unsigned long value)
+{
+    put(targets, static_cast<unsigned long long>(value));
+}
+
+void TeeOutput::put(Targets targets, unsigned long long value)
+{
+    char characters[TEE_OUTPUT_NUMBER_CHARACTERS];
+    std::to_chars_result result = std::to_chars(characters, characters + sizeof(characters), value);
+    append(targets, characters, static_cast<std::size_t>(result.ptr - characters));
+}
+
+void TeeOutput::put(Targets targets, float value)
+{
+    char characters[TEE_OUTPUT_NUMBER_CHARACTERS];
+    std::to_chars_result result = std::to_chars(characters, characters + sizeof(characters), value);
+    append(targets, characters, static_cast<std::size_t>(result.ptr - characters));
+}
+
+/**
+ * Print the shortest decimal representation of value which converts back to exactly the same double.
+ */
+void TeeOutput::put(Targets targets, double value)
+{
+    char characters[TEE_OUTPUT_NUMBER_CHARACTERS];
+    std::to_chars_result result = std::to_chars(characters, characters + sizeof(characters), value);
+    append(targets, characters, static_cast<std::size_t>(result.ptr - characters));
+}
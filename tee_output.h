@@ -0,0 +1,88 @@
+/**
+ * file: tee_output.h
+ * type: C++ (header file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+#ifndef TEE_OUTPUT_H
+#define TEE_OUTPUT_H
+
+/** preprocessing directives */
+#include <cstddef> // std::size_t
+#include <cstdio> // std::FILE
+#include <string> // std::string
+#define DEFAULT_TEE_OUTPUT_BUFFER_CAPACITY 1048576 // constant which represents the default number of bytes buffered before the output file is written
+
+/**
+ * A TeeOutput prints the same text to the command line terminal and to a plain-text output file
+ * (which replaces the pairs of identical std::cout << ... and file << ... statements the programs used to have).
+ *
+ * Each value is formatted exactly once (floating-point numbers use std::to_chars, which produces the shortest decimal
+ * string which converts back to exactly the same double) and the resulting characters are then copied to both targets.
+ *
+ * The file side is collected in a large buffer which is written to the file in big writes (whenever the buffer fills up,
+ * when flush() is called, and when the TeeOutput is closed or destroyed).
+ *
+ * The command line terminal side is written to std::cout (which keeps that text in order with any message which a kernel
+ * prints to std::cout and which lets std::cin flush the prompts before it waits for keyboard input).
+ *
+ * Text which belongs on only one of the two targets is printed through the console and file members:
+ *
+ * output << "\n\nsine(x) = " << sine(x) << "."; // command line terminal and output file
+ * output.console << "\n\nEnter Option Here: "; // command line terminal only
+ * output.file << "--------------------------------"; // output file only
+ */
+class TeeOutput
+{
+public:
+    enum Targets { TO_CONSOLE = 1, TO_FILE = 2, TO_BOTH = 3 };
+
+    /**
+     * A Side forwards everything which is inserted into it to one of the targets of its TeeOutput.
+     */
+    class Side
+    {
+    public:
+        Side(TeeOutput & owner, Targets targets) : owner(owner), targets(targets) {}
+        template <typename T> Side & operator<<(const T & value) { owner.put(targets, value); return *this; }
+    private:
+        TeeOutput & owner;
+        Targets targets;
+    };
+
+    explicit TeeOutput(const std::string & file_name, std::size_t buffer_capacity = DEFAULT_TEE_OUTPUT_BUFFER_CAPACITY);
+    ~TeeOutput();
+    TeeOutput(const TeeOutput &) = delete;
+    TeeOutput & operator=(const TeeOutput &) = delete;
+
+    template <typename T> TeeOutput & operator<<(const T & value) { put(TO_BOTH, value); return *this; }
+
+    bool isOpen() const { return file_handle != nullptr; }
+    void flush();
+    void close();
+
+    Side console;
+    Side file;
+
+private:
+    void put(Targets targets, const char * text);
+    void put(Targets targets, const std::string & text);
+    void put(Targets targets, char character);
+    void put(Targets targets, int value);
+    void put(Targets targets, long value);
+    void put(Targets targets, long long value);
+    void put(Targets targets, unsigned long value);
+    void put(Targets targets, unsigned long long value);
+    void put(Targets targets, float value);
+    void put(Targets targets, double value);
+    void append(Targets targets, const char * characters, std::size_t length);
+
+    std::FILE * file_handle = nullptr;
+    char * buffer = nullptr;
+    std::size_t buffer_capacity = 0;
+    std::size_t buffer_length = 0;
+};
+
+#endif // TEE_OUTPUT_H
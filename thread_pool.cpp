@@ -0,0 +1,203 @@
+/**
+ * file: thread_pool.cpp
+ * type: C++ (source file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+/** preprocessing directives */
+#include <iostream> // standard output (std::cout)
+#include <cstdlib> // std::aligned_alloc, std::free
+#include <cstring> // std::memset
+#include "thread_pool.h" // ThreadPool
+#define PAGE_SIZE_BYTES 4096 // constant which represents the number of bytes in one memory page
+
+/**
+ * Start thread_count - 1 worker threads (the thread which calls parallelFor is the remaining thread).
+ *
+ * If thread_count is zero, one thread per hardware thread of the machine is used.
+ * If thread_count is out of range, it is reset to the number of hardware threads.
+ */
+ThreadPool::ThreadPool(int thread_count) : thread_count(thread_count)
+{
+    int hardware_threads = static_cast<int>(std::thread::hardware_concurrency());
+    if (hardware_threads < 1) hardware_threads = 1;
+
+    // Set thread_count to the number of hardware threads if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((thread_count < 0) || (thread_count > MAXIMUM_THREAD_POOL_THREADS))
+    {
+        std::cout << "\n\nThe number of ThreadPool threads was out of range. Hence, the number of threads has been reset to " << hardware_threads << ".";
+        this->thread_count = hardware_threads;
+    }
+    if (thread_count == 0) this->thread_count = hardware_threads;
+
+    ranges.reset(new ChunkRange[this->thread_count]);
+    for (int worker = 1; worker < this->thread_count; worker += 1) threads.emplace_back(&ThreadPool::workerLoop, this, worker);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(state_mutex);
+        stopping = true;
+    }
+    job_started.notify_all();
+    for (std::thread & thread : threads) thread.join();
+}
+
+/**
+ * Wait for each parallelFor job and work on its chunks (until the pool is destroyed).
+ */
+void ThreadPool::workerLoop(int worker)
+{
+    long long seen_generation = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(state_mutex);
+            job_started.wait(lock, [&]() { return stopping || (job_generation != seen_generation); });
+            if (stopping) return;
+            seen_generation = job_generation;
+        }
+
+        runChunks(worker);
+
+        {
+            std::lock_guard<std::mutex> lock(state_mutex);
+            busy_workers -= 1;
+        }
+        job_finished.notify_one();
+    }
+}
+
+/**
+ * Take the next chunk of the range of worker. If that range is empty, steal the back half of the largest remaining
+ * range of another thread.
+ *
+ * Return false if no chunk is left anywhere.
+ */
+bool ThreadPool::takeChunk(int worker, long long & chunk)
+{
+    ChunkRange & own = ranges[worker];
+    {
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (own.next < own.end)
+        {
+            chunk = own.next;
+            own.next += 1;
+            return true;
+        }
+    }
+
+    while (true)
+    {
+        // Find the thread which has the most chunks left.
+        int victim = -1;
+        long long most = 0;
+        for (int offset = 1; offset < thread_count; offset += 1)
+        {
+            int other = (worker + offset) % thread_count;
+            std::lock_guard<std::mutex> lock(ranges[other].mutex);
+            long long left = ranges[other].end - ranges[other].next;
+            if (left > most)
+            {
+                most = left;
+                victim = other;
+            }
+        }
+        if (victim < 0) return false;
+
+        // Move the back half of the range of victim to the range of worker (and run the first chunk of that half right away).
+        long long begin = 0, end = 0;
+        {
+            std::lock_guard<std::mutex> lock(ranges[victim].mutex);
+            long long left = ranges[victim].end - ranges[victim].next;
+            if (left < 1) continue;
+            end = ranges[victim].end;
+            begin = end - ((left + 1) / 2);
+            ranges[victim].end = begin;
+        }
+        std::lock_guard<std::mutex> lock(own.mutex);
+        chunk = begin;
+        own.next = begin + 1;
+        own.end = end;
+        return true;
+    }
+}
+
+/**
+ * Run chunks of the current job on worker until no chunk is left.
+ */
+void ThreadPool::runChunks(int worker)
+{
+    long long chunk = 0;
+    while (takeChunk(worker, chunk))
+    {
+        long long begin = chunk * job_chunk_length;
+        long long end = (begin + job_chunk_length < job_count) ? (begin + job_chunk_length) : job_count;
+        (*job_body)(begin, end);
+    }
+}
+
+/**
+ * Call body(begin, end) for consecutive index ranges of (at most) chunk_length indices which together cover [0, count)
+ * and return after every call has finished.
+ *
+ * If chunk_length is smaller than one, DEFAULT_PARALLEL_CHUNK_LENGTH is used.
+ */
+void ThreadPool::parallelFor(long long count, long long chunk_length, const std::function<void(long long begin, long long end)> & body)
+{
+    if (count < 1) return;
+    if (chunk_length < 1) chunk_length = DEFAULT_PARALLEL_CHUNK_LENGTH;
+    std::lock_guard<std::mutex> job_lock(job_mutex);
+
+    // Give each thread an equal, contiguous range of chunks.
+    long long chunks = (count + chunk_length - 1) / chunk_length;
+    for (int worker = 0; worker < thread_count; worker += 1)
+    {
+        std::lock_guard<std::mutex> lock(ranges[worker].mutex);
+        ranges[worker].next = (chunks * worker) / thread_count;
+        ranges[worker].end = (chunks * (worker + 1)) / thread_count;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(state_mutex);
+        job_count = count;
+        job_chunk_length = chunk_length;
+        job_body = &body;
+        busy_workers = thread_count - 1;
+        job_generation += 1;
+    }
+    job_started.notify_all();
+
+    // The calling thread works on the chunks of worker 0 (and steals from the other threads) and then waits for the other threads.
+    runChunks(0);
+    std::unique_lock<std::mutex> lock(state_mutex);
+    job_finished.wait(lock, [&]() { return busy_workers == 0; });
+    job_body = nullptr;
+}
+
+/**
+ * Allocate a page-aligned array of count doubles (set to zero) for use with parallelFor.
+ *
+ * Each page is first written by the thread which owns that page's chunk in parallelFor (for the same count and
+ * chunk_length). On a NUMA machine the operating system places a page on the memory node of the core which first writes
+ * to it, so each thread later streams mostly through memory of its own node. Release the array with deallocate.
+ */
+double * ThreadPool::allocate(long long count, long long chunk_length)
+{
+    if (count < 1) count = 1;
+    std::size_t bytes = ((sizeof(double) * static_cast<std::size_t>(count) + PAGE_SIZE_BYTES - 1) / PAGE_SIZE_BYTES) * PAGE_SIZE_BYTES;
+    double * values = static_cast<double *>(std::aligned_alloc(PAGE_SIZE_BYTES, bytes));
+    if (values == nullptr) return nullptr;
+    parallelFor(count, chunk_length, [values](long long begin, long long end) {
+        std::memset(values + begin, 0, sizeof(double) * static_cast<std::size_t>(end - begin));
+    });
+    return values;
+}
+
+void ThreadPool::deallocate(double * values)
+{
+    std::free(values);
+}
@@ -0,0 +1,80 @@
+/**
+ * file: thread_pool.h
+ * type: C++ (header file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+/** preprocessing directives */
+#include <condition_variable> // std::condition_variable
+#include <functional> // std::function
+#include <memory> // std::unique_ptr
+#include <mutex> // std::mutex
+#include <thread> // std::thread
+#include <vector> // std::vector
+#define MAXIMUM_THREAD_POOL_THREADS 1024 // constant which represents the maximum number of threads in one ThreadPool
+#define DEFAULT_PARALLEL_CHUNK_LENGTH 4096 // constant which represents the default number of array elements in one chunk of parallelFor
+
+/**
+ * A ThreadPool runs the chunks of a large index range [0, count) on every core of the machine.
+ *
+ * parallelFor first gives each thread an equal, contiguous range of chunks (so that each thread streams through its own
+ * part of the input and output arrays). A thread which finishes its own range steals the back half of the remaining range
+ * of another thread (work stealing), so that slow chunks (e.g. kernel arguments which need more series terms) do not
+ * leave the other cores idle.
+ *
+ * Each chunk writes only to its own indices, so the order of the output always matches the order of the input
+ * (no matter which thread computes which chunk).
+ *
+ * The thread which calls parallelFor also works on the chunks (so a ThreadPool of one thread runs everything on the
+ * calling thread). parallelFor must not be called from inside of a chunk of the same pool.
+ */
+class ThreadPool
+{
+public:
+    explicit ThreadPool(int thread_count = 0);
+    ~ThreadPool();
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool & operator=(const ThreadPool &) = delete;
+
+    int threadCount() const { return thread_count; }
+    void parallelFor(long long count, long long chunk_length, const std::function<void(long long begin, long long end)> & body);
+
+    double * allocate(long long count, long long chunk_length = DEFAULT_PARALLEL_CHUNK_LENGTH);
+    static void deallocate(double * values);
+
+private:
+    /**
+     * The range of chunks [next, end) which one thread has not yet started (padded to a cache line so that
+     * the ranges of two threads never share a cache line).
+     */
+    struct alignas(64) ChunkRange {
+        std::mutex mutex;
+        long long next = 0;
+        long long end = 0;
+    };
+
+    void workerLoop(int worker);
+    void runChunks(int worker);
+    bool takeChunk(int worker, long long & chunk);
+
+    int thread_count = 1;
+    std::vector<std::thread> threads;
+    std::unique_ptr<ChunkRange[]> ranges;
+    std::mutex job_mutex; // allows only one parallelFor at a time
+    std::mutex state_mutex;
+    std::condition_variable job_started;
+    std::condition_variable job_finished;
+    long long job_generation = 0;
+    int busy_workers = 0;
+    bool stopping = false;
+    long long job_count = 0;
+    long long job_chunk_length = 0;
+    const std::function<void(long long begin, long long end)> * job_body = nullptr;
+};
+
+#endif // THREAD_POOL_H
@@ -0,0 +1,203 @@
+/**
+ * file: trigonometric_batch.cpp
+ * type: C++ (source file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+/** preprocessing directives */
+#include <iostream> // standard output (std::cout)
+#include <cmath> // std::fabs
+#include <bit> // std::bit_cast
+#include <cstdint> // std::uint64_t
+#include "trigonometric_batch.h" // reciprocalWithoutDivision, selectedBy, negatedIf, reduceByPiOverTwo, reducedSine, reducedCosine, twoSum, evaluateWithFixUp, BATCH_TARGETS, function prototypes
+#define SMALLEST_NORMAL_DOUBLE 2.2250738585072014e-308 // constant which represents 2 ^ -1022 (the smallest positive double which reciprocalWithoutDivision accepts)
+
+/**
+ * The coefficients of the rational minimax approximation tan(r) ≈ r + r * z * P(z) / Q(z) (where z = r ^ 2) on [-Pi / 4, Pi / 4]
+ * (from the Cephes Mathematical Library), whose relative error is below 2.2e-16. Q(z) = z ^ 4 + Q[0] * z ^ 3 + ... + Q[3]
+ * is between about -5.4e7 and -3.9e7 on the whole interval (so its reciprocal never needs special handling).
+ */
+static constexpr double TANGENT_P[3] = { -1.30936939181383777646e4, 1.15351664838587416140e6, -1.79565251976484877988e7 };
+static constexpr double TANGENT_Q[4] = { 1.36812963470692954678e4, -1.32089234440210967447e6, 2.50083801823357915839e7, -5.38695755929454629881e7 };
+
+/**
+ * Return tan(r + r_low) for r in [-Pi / 4, Pi / 4] (with the only reciprocal, 1 / Q(z), computed by reciprocalWithoutDivision).
+ *
+ * The tiny r_low is added to first order: tan(r + r_low) ≈ tan(r) + r_low * (1 + tan(r) ^ 2).
+ */
+static inline double reducedTangent(double r, double r_low)
+{
+    double z = r * r;
+    double p = (TANGENT_P[0] * z + TANGENT_P[1]) * z + TANGENT_P[2];
+    double q = (((z + TANGENT_Q[0]) * z + TANGENT_Q[1]) * z + TANGENT_Q[2]) * z + TANGENT_Q[3];
+    double t = r * z * p * reciprocalWithoutDivision(q);
+    double tangent_of_r = r + t;
+    return r + (t + r_low * (1.0 + tangent_of_r * tangent_of_r));
+}
+
+/**
+ * Return tan(x) for x in [(-1 * MAXIMUM_x), MAXIMUM_x] (tan(x) = tan(r) if n is even and -1 / tan(r) if n is odd).
+ *
+ * (The reciprocal -1 / tan(r) is only selected if n is odd, in which case |tan(r)| is far above SMALLEST_NORMAL_DOUBLE.)
+ */
+static inline double tangentWithoutDivision(double x)
+{
+    std::uint64_t quadrant = 0;
+    double r_low = 0.0;
+    double r = reduceByPiOverTwo(x, r_low, quadrant);
+    double t = reducedTangent(r, r_low);
+    double reciprocal = reciprocalWithoutDivision(t);
+    return selectedBy(quadrant & 1, -reciprocal, t);
+}
+
+/**
+ * Return cot(x) for x in [(-1 * MAXIMUM_x), MAXIMUM_x] (cot(x) = 1 / tan(r) if n is even and -tan(r) if n is odd).
+ */
+static inline double cotangentWithoutDivision(double x)
+{
+    std::uint64_t quadrant = 0;
+    double r_low = 0.0;
+    double r = reduceByPiOverTwo(x, r_low, quadrant);
+    double t = reducedTangent(r, r_low);
+    double reciprocal = reciprocalWithoutDivision(t);
+    return selectedBy(quadrant & 1, -t, reciprocal);
+}
+
+/**
+ * Return sec(x) for x in [(-1 * MAXIMUM_x), MAXIMUM_x] (sec(x) = 1 / cos(r), -1 / sin(r), -1 / cos(r), 1 / sin(r) for n modulo 4 = 0, 1, 2, 3).
+ *
+ * Both sin(r) and cos(r) are computed (and one of them is selected), so that the loop which calls this function has no branch.
+ */
+static inline double secantWithoutDivision(double x)
+{
+    std::uint64_t quadrant = 0;
+    double r_low = 0.0;
+    double r = reduceByPiOverTwo(x, r_low, quadrant);
+    double sine_of_r = reducedSine(r, r_low), cosine_of_r = reducedCosine(r, r_low);
+    double reciprocal = reciprocalWithoutDivision(selectedBy(quadrant & 1, sine_of_r, cosine_of_r));
+    return negatedIf(((quadrant + 1) >> 1) & 1, reciprocal);
+}
+
+/**
+ * Return csc(x) for x in [(-1 * MAXIMUM_x), MAXIMUM_x] (csc(x) = 1 / sin(r), 1 / cos(r), -1 / sin(r), -1 / cos(r) for n modulo 4 = 0, 1, 2, 3).
+ */
+static inline double cosecantWithoutDivision(double x)
+{
+    std::uint64_t quadrant = 0;
+    double r_low = 0.0;
+    double r = reduceByPiOverTwo(x, r_low, quadrant);
+    double sine_of_r = reducedSine(r, r_low), cosine_of_r = reducedCosine(r, r_low);
+    double reciprocal = reciprocalWithoutDivision(selectedBy(quadrant & 1, cosine_of_r, sine_of_r));
+    return negatedIf(quadrant >> 1, reciprocal);
+}
+
+/**
+ * Return 1 if x needs the second loop of evaluateWithFixUp (and 0 if it does not), i.e. if x is outside of
+ * [(-1 * MAXIMUM_x), MAXIMUM_x], if |x| is below SMALLEST_NORMAL_DOUBLE (which reciprocalWithoutDivision does not accept),
+ * or if x is "not a number".
+ *
+ * The bits of nonnegative doubles are ordered like their values, so both bounds are checked by the sign bits of two
+ * integer subtractions (instead of by floating-point comparisons, whose results the compiler cannot add to an integer
+ * count in a vectorized loop unless the machine has SSE4 instructions).
+ */
+static inline std::uint64_t isSpecial(double x)
+{
+    std::uint64_t magnitude = std::bit_cast<std::uint64_t>(x) & 0x7FFFFFFFFFFFFFFFULL;
+    std::uint64_t smallest = std::bit_cast<std::uint64_t>(SMALLEST_NORMAL_DOUBLE);
+    std::uint64_t largest = std::bit_cast<std::uint64_t>(static_cast<double>(MAXIMUM_x));
+    return ((magnitude - smallest) | (largest - magnitude)) >> 63;
+}
+
+/**
+ * Return true if x is inside of [(-1 * MAXIMUM_x), MAXIMUM_x] (i.e. if x is not reset to 1 by the second loop of evaluateWithFixUp).
+ */
+static inline bool isWithinMaximum(double x)
+{
+    return (x >= (-1 * MAXIMUM_x)) && (x <= MAXIMUM_x);
+}
+
+/**
+ * Return tan(x), cot(x), sec(x), or csc(x) for a special x which is inside of [(-1 * MAXIMUM_x), MAXIMUM_x] (see isSpecial), i.e. the value which
+ * the second loop of evaluateWithFixUp stores: for |x| below SMALLEST_NORMAL_DOUBLE, tan(x) = x, cot(x) = csc(x) = 1 / x, and sec(x) = 1 + x * x
+ * (and each of those is "not a number" if x is "not a number"), whereas every other x (e.g. the reset value 1) is computed by the kernel.
+ */
+static double tangentUnchecked(double x)
+{
+    return (std::fabs(x) >= SMALLEST_NORMAL_DOUBLE) ? tangentWithoutDivision(x) : x;
+}
+
+static double cotangentUnchecked(double x)
+{
+    return (std::fabs(x) >= SMALLEST_NORMAL_DOUBLE) ? cotangentWithoutDivision(x) : (1.0 / x);
+}
+
+static double secantUnchecked(double x)
+{
+    return (std::fabs(x) >= SMALLEST_NORMAL_DOUBLE) ? secantWithoutDivision(x) : (1.0 + x * x);
+}
+
+static double cosecantUnchecked(double x)
+{
+    return (std::fabs(x) >= SMALLEST_NORMAL_DOUBLE) ? cosecantWithoutDivision(x) : (1.0 / x);
+}
+
+/**
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ *
+ * The batch kernels below compute y[k] = f(x[k]) for k = 0, 1, ..., count - 1 (i.e. they have the signature of a BatchKernel)
+ * for f = tan, cot, sec, and csc.
+ *
+ * tangent(x), cotangent(x), secant(x), and cosecant(x) evaluate two Taylor series and then divide. These kernels instead
+ * reduce x to r in [-Pi / 4, Pi / 4] (x = n * (Pi / 2) + r) and evaluate minimax approximations of tan(r), sin(r), and cos(r)
+ * on that interval only, and they compute every reciprocal with reciprocalWithoutDivision, so their inner loops contain
+ * no division instruction and the compiler can vectorize them.
+ *
+ * r is carried with its rounding error r_low, so the results stay within about two units in the last place of the exact
+ * values (or about one and a half with fused multiply-add instructions) everywhere in [(-1 * MAXIMUM_x), MAXIMUM_x], including
+ * next to the poles (where tangent(x) and the others lose accuracy because they divide two rounded series).
+ *
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * Store tan(x[k]) in y[k] for k = 0, 1, ..., count - 1.
+ */
+BATCH_TARGETS void tangentBatch(const double * x, double * y, long long count)
+{
+    evaluateWithFixUp("tangentBatch", x, y, count, tangentWithoutDivision, isSpecial, isWithinMaximum, 1.0, tangentUnchecked);
+}
+
+/**
+ * Store cot(x[k]) in y[k] for k = 0, 1, ..., count - 1 (where cot(x[k]) = 1 / x[k] if |x[k]| is below SMALLEST_NORMAL_DOUBLE).
+ */
+BATCH_TARGETS void cotangentBatch(const double * x, double * y, long long count)
+{
+    evaluateWithFixUp("cotangentBatch", x, y, count, cotangentWithoutDivision, isSpecial, isWithinMaximum, 1.0, cotangentUnchecked);
+}
+
+/**
+ * Store sec(x[k]) in y[k] for k = 0, 1, ..., count - 1.
+ */
+BATCH_TARGETS void secantBatch(const double * x, double * y, long long count)
+{
+    evaluateWithFixUp("secantBatch", x, y, count, secantWithoutDivision, isSpecial, isWithinMaximum, 1.0, secantUnchecked);
+}
+
+/**
+ * Store csc(x[k]) in y[k] for k = 0, 1, ..., count - 1 (where csc(x[k]) = 1 / x[k] if |x[k]| is below SMALLEST_NORMAL_DOUBLE).
+ */
+BATCH_TARGETS void cosecantBatch(const double * x, double * y, long long count)
+{
+    evaluateWithFixUp("cosecantBatch", x, y, count, cosecantWithoutDivision, isSpecial, isWithinMaximum, 1.0, cosecantUnchecked);
+}
+
+/**
+ * Print the message of evaluateWithFixUp which counts the out_of_range values of x[k] which function_name reset to reset_value
+ * to the command line terminal.
+ */
+void printOutOfRangeMessage(const char * function_name, long long out_of_range, double reset_value)
+{
+    std::cout << "\n\n" << out_of_range << " of the numbers, x[k], in " << function_name << "(x, y, count) were out of range. Hence, each of those values of x[k] has been reset to " << reset_value << ".";
+}
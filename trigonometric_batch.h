@@ -0,0 +1,244 @@
+/**
+ * file: trigonometric_batch.h
+ * type: C++ (header file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+#ifndef TRIGONOMETRIC_BATCH_H
+#define TRIGONOMETRIC_BATCH_H
+
+/** preprocessing directives */
+#include <bit> // std::bit_cast
+#include <cstdint> // std::uint64_t, std::uint32_t
+#include <cmath> // std::fma, FP_FAST_FMA
+#include <type_traits> // std::is_constant_evaluated
+#include "trigonometric_functions.h" // MAXIMUM_x, PI_OVER_TWO_HIGH, TWO_OVER_PI
+#include "double_double.h" // twoSum
+#include "exponential_kernels.h" // WHOLE_NUMBER_SHIFTER
+#define PI_OVER_TWO_SECOND 6.07710050630396597660e-11 // constant which represents the second 33 bits of Pi / 2 (after PI_OVER_TWO_HIGH)
+#define PI_OVER_TWO_THIRD 2.02226624871116645580e-21 // constant which represents the third 33 bits of Pi / 2
+#define PI_OVER_TWO_THIRD_TAIL 8.47842766036889956997e-32 // constant which represents Pi / 2 - PI_OVER_TWO_HIGH - PI_OVER_TWO_SECOND - PI_OVER_TWO_THIRD
+
+/**
+ * A batch kernel which is marked with BATCH_TARGETS is compiled three times (for AVX-512, for AVX2 with fused multiply-add, and for the
+ * instruction set of the build) on x86-64 machines whose C library can select one of those versions when the program starts (GCC and Clang on
+ * GNU/Linux), so its loops use the widest vectors (and the gather instructions which table lookups need) of the machine which runs it. flatten
+ * inlines the kernels and evaluateWithFixUp into each version (a version which called a function that is not inlined would run the baseline
+ * code of that function). Elsewhere (or if the whole build already targets AVX2, e.g. with KARBYTES_MATH_NATIVE), it is compiled once.
+ */
+#if defined(__GNUC__) && defined(__x86_64__) && defined(__gnu_linux__) && !defined(__AVX2__)
+#define BATCH_TARGETS __attribute__((target_clones("arch=x86-64-v4", "arch=x86-64-v3", "default"), flatten))
+#else
+#define BATCH_TARGETS
+#endif
+
+/** function prototypes */
+constexpr double reciprocalWithoutDivision(double d);
+inline double reduceByPiOverTwo(double x, double & r_low, std::uint64_t & quadrant);
+inline double reducedSine(double r, double r_low);
+inline double reducedCosine(double r, double r_low);
+void tangentBatch(const double * x, double * y, long long count);
+void cotangentBatch(const double * x, double * y, long long count);
+void secantBatch(const double * x, double * y, long long count);
+void cosecantBatch(const double * x, double * y, long long count);
+inline double selectedBy(std::uint64_t condition, double if_true, double if_false);
+inline double negatedIf(std::uint64_t negate, double value);
+inline std::uint64_t magnitudeAbove(double x, double bound);
+inline float selectedBy(std::uint32_t condition, float if_true, float if_false);
+inline float negatedIf(std::uint32_t negate, float value);
+inline std::uint32_t magnitudeAbove(float x, float bound);
+template <typename Real, typename Kernel, typename IsSpecial, typename InRange, typename Unchecked> void evaluateWithFixUp(const char * function_name, const Real * x, Real * y, long long count, Kernel kernel, IsSpecial is_special, InRange in_range, Real reset_value, Unchecked unchecked);
+void printOutOfRangeMessage(const char * function_name, long long out_of_range, double reset_value);
+
+/**
+ * Return 1 / d without a division instruction (so that a loop of reciprocals is limited by the throughput of multiplications
+ * instead of by the throughput of the hardware divider, which is several times smaller).
+ *
+ * d = m * 2 ^ e (where m is in [1, 2)) is split by its bits. The estimate
+ *
+ * 1 / m ≈ (1632 - 1696 * m + 768 * m ^ 2 - 128 * m ^ 3) / 577
+ *
+ * (i.e. the cubic whose relative error is the scaled Chebyshev polynomial T_4(2 * m - 3) / 577) is at most 1 / 577 off,
+ * and each Newton step y = y + y * (1 - m * y) squares that relative error, so three steps reach
+ * (1 / 577) ^ 8 (which is far below the rounding error of a double). The sign and the exponent -e are then put back by bits.
+ * (The steps are written out instead of looped, so that the compiler can vectorize the loops which call this function.)
+ *
+ * The result is within about one unit in the last place of 1 / d (and is usually the correctly rounded value if the
+ * machine has fused multiply-add instructions).
+ *
+ * d is assumed to be a normal double whose magnitude is smaller than 2 ^ 1023 (zero, subnormal numbers, and infinity
+ * are not handled, because checking them would cost a branch per element; the batch kernels handle them separately).
+ */
+constexpr double reciprocalWithoutDivision(double d)
+{
+    std::uint64_t bits = std::bit_cast<std::uint64_t>(d);
+    std::uint64_t exponent = (bits >> 52) & 0x7FF;
+    double m = std::bit_cast<double>((bits & 0x000FFFFFFFFFFFFFULL) | 0x3FF0000000000000ULL);
+    double scale = std::bit_cast<double>(((2046 - exponent) << 52) | (bits & 0x8000000000000000ULL));
+
+    double y = (1632.0 / 577.0) + m * ((-1696.0 / 577.0) + m * ((768.0 / 577.0) + m * (-128.0 / 577.0)));
+#ifdef FP_FAST_FMA
+    if (!std::is_constant_evaluated())
+    {
+        y = std::fma(y, std::fma(-m, y, 1.0), y);
+        y = std::fma(y, std::fma(-m, y, 1.0), y);
+        y = std::fma(y, std::fma(-m, y, 1.0), y);
+        return y * scale;
+    }
+#endif
+    y = y + y * (1.0 - m * y);
+    y = y + y * (1.0 - m * y);
+    y = y + y * (1.0 - m * y);
+    return y * scale;
+}
+
+/**
+ * The coefficients of the minimax polynomials sin(r) ≈ r + r * z * (S[0] + z * S[1] + ...) and
+ * cos(r) ≈ 1 - z / 2 + z ^ 2 * (C[0] + z * C[1] + ...) on [-Pi / 4, Pi / 4] (from fdlibm), whose errors are below one unit in the last place.
+ */
+inline constexpr double SINE_S[6] = { -1.66666666666666324348e-01, 8.33333333332248946124e-03, -1.98412698298579493134e-04, 2.75573137070700676789e-06, -2.50507602534068634195e-08, 1.58969099521155010221e-10 };
+inline constexpr double COSINE_C[6] = { 4.16666666666666019037e-02, -1.38888888888741095749e-03, 2.48015872894767294178e-05, -2.75573143513906633035e-07, 2.08757232129817482790e-09, -1.13596475577881948265e-11 };
+
+/**
+ * Write x = n * (Pi / 2) + r (where r is in [-Pi / 4, Pi / 4]) and return r rounded to a double. Store the rounding error
+ * of r in r_low and n modulo 4 in quadrant.
+ *
+ * n is rounded with WHOLE_NUMBER_SHIFTER (instead of a conversion to an integer), so that the loops which call this function
+ * can be vectorized. Pi / 2 is split into three 33-bit parts and one 53-bit tail (as in the fdlibm reduction) and each
+ * product of n with a 33-bit part is exact for every |x| <= MAXIMUM_x, so r stays accurate to its last bit even if x is
+ * the double which is nearest to a multiple of Pi / 2 (where r is about 1e-17 and a two-part Pi / 2 leaves only ten correct digits).
+ */
+inline double reduceByPiOverTwo(double x, double & r_low, std::uint64_t & quadrant)
+{
+    double shifted = x * TWO_OVER_PI + WHOLE_NUMBER_SHIFTER;
+    quadrant = std::bit_cast<std::uint64_t>(shifted) & 3;
+    double n = shifted - WHOLE_NUMBER_SHIFTER;
+
+    // x - n * PI_OVER_TWO_HIGH is exact, and the two other exact products are subtracted with twoSum (so that no rounding error is lost).
+    double first_error = 0.0, second_error = 0.0;
+    double r = twoSum(x - n * PI_OVER_TWO_HIGH, -n * PI_OVER_TWO_SECOND, first_error);
+    r = twoSum(r, -n * PI_OVER_TWO_THIRD, second_error);
+    double error = (first_error + second_error) - n * PI_OVER_TWO_THIRD_TAIL;
+
+    double reduced = r + error;
+    r_low = (r - reduced) + error;
+    return reduced;
+}
+
+/**
+ * Return sin(r + r_low) for r in [-Pi / 4, Pi / 4] (where r_low is added to first order: sin(r + r_low) ≈ sin(r) + r_low * cos(r)).
+ */
+inline double reducedSine(double r, double r_low)
+{
+    double z = r * r;
+    double s = SINE_S[1] + z * (SINE_S[2] + z * (SINE_S[3] + z * (SINE_S[4] + z * SINE_S[5])));
+    return r + ((z * r) * (SINE_S[0] + z * s) + r_low * (1.0 - 0.5 * z));
+}
+
+/**
+ * Return cos(r + r_low) for r in [-Pi / 4, Pi / 4] (where r_low is added to first order: cos(r + r_low) ≈ cos(r) - r_low * sin(r)).
+ *
+ * 1 - z / 2 is split so that its rounding error is added back.
+ */
+inline double reducedCosine(double r, double r_low)
+{
+    double z = r * r;
+    double c = z * (COSINE_C[0] + z * (COSINE_C[1] + z * (COSINE_C[2] + z * (COSINE_C[3] + z * (COSINE_C[4] + z * COSINE_C[5])))));
+    double half_z = 0.5 * z;
+    double w = 1.0 - half_z;
+    return w + (((1.0 - w) - half_z) + (z * c - r * r_low));
+}
+
+/**
+ * Return if_true if condition is 1 and if_false if condition is 0.
+ *
+ * The result is blended with bit operations (instead of with ?:), because the compiler would otherwise move the arithmetic
+ * which only one of the two values needs into a branch, and a loop with a branch is not vectorized.
+ */
+inline double selectedBy(std::uint64_t condition, double if_true, double if_false)
+{
+    std::uint64_t mask = 0 - condition;
+    return std::bit_cast<double>((std::bit_cast<std::uint64_t>(if_true) & mask) | (std::bit_cast<std::uint64_t>(if_false) & ~mask));
+}
+
+/**
+ * Return -value if negate is 1 and value if negate is 0 (by flipping the sign bit).
+ */
+inline double negatedIf(std::uint64_t negate, double value)
+{
+    return std::bit_cast<double>(std::bit_cast<std::uint64_t>(value) ^ (negate << 63));
+}
+
+/**
+ * Return 1 if |x| is larger than the nonnegative bound (or if x is "not a number") and 0 otherwise.
+ *
+ * The bits of nonnegative doubles are ordered like their values, so the comparison is the sign bit of an integer subtraction
+ * (which, unlike the result of a floating-point comparison, can be added to an integer count in a vectorized loop on every
+ * x86-64 machine).
+ */
+inline std::uint64_t magnitudeAbove(double x, double bound)
+{
+    return (std::bit_cast<std::uint64_t>(bound) - (std::bit_cast<std::uint64_t>(x) & 0x7FFFFFFFFFFFFFFFULL)) >> 63;
+}
+
+/**
+ * The float versions of selectedBy, negatedIf, and magnitudeAbove (for the kernels of float_kernels.h, whose loops process twice as
+ * many floats as doubles per vector register).
+ */
+inline float selectedBy(std::uint32_t condition, float if_true, float if_false)
+{
+    std::uint32_t mask = 0 - condition;
+    return std::bit_cast<float>((std::bit_cast<std::uint32_t>(if_true) & mask) | (std::bit_cast<std::uint32_t>(if_false) & ~mask));
+}
+
+inline float negatedIf(std::uint32_t negate, float value)
+{
+    return std::bit_cast<float>(std::bit_cast<std::uint32_t>(value) ^ (negate << 31));
+}
+
+inline std::uint32_t magnitudeAbove(float x, float bound)
+{
+    return (std::bit_cast<std::uint32_t>(bound) - (std::bit_cast<std::uint32_t>(x) & 0x7FFFFFFFU)) >> 31;
+}
+
+/**
+ * Store kernel(x[k]) in y[k] for k = 0, 1, ..., count - 1 and then fix the values of the special x[k] (i.e. those for which
+ * is_special(x[k]) is 1, which include every x[k] that is out of range and "not a number"):
+ *
+ * Each x[k] for which in_range(x[k]) is false is reset to reset_value (as in the single-value functions), and one message which
+ * counts those values is printed per call (instead of one message per value). y[k] = unchecked(x[k]) for the other special x[k].
+ *
+ * The main loop only records (with a bitwise or) whether any value is special, so it has no branch and the compiler can vectorize it (if
+ * kernel and is_special are inline and branch-free). The second loop only runs if some value is special. (The batch kernels of hyperbolic_functions.cpp,
+ * logarithm.cpp, float_kernels.cpp, and trigonometric_batch.cpp share this structure.)
+ *
+ * (The message is printed by printOutOfRangeMessage of trigonometric_batch.cpp, so that this header does not include iostream.)
+ *
+ * Real is double or float (and is_special returns a std::uint64_t or a std::uint32_t, respectively, so that the flag of the main loop is as
+ * wide as its elements).
+ */
+template <typename Real, typename Kernel, typename IsSpecial, typename InRange, typename Unchecked> void evaluateWithFixUp(const char * function_name, const Real * x, Real * y, long long count, Kernel kernel, IsSpecial is_special, InRange in_range, Real reset_value, Unchecked unchecked)
+{
+    decltype(is_special(x[0])) special = 0;
+    long long out_of_range = 0;
+    for (long long k = 0; k < count; k += 1)
+    {
+        special |= is_special(x[k]);
+        y[k] = kernel(x[k]);
+    }
+    for (long long k = 0; (special > 0) && (k < count); k += 1)
+    {
+        if (!is_special(x[k])) continue;
+        if (!in_range(x[k]) && (x[k] == x[k]))
+        {
+            y[k] = unchecked(reset_value);
+            out_of_range += 1;
+        }
+        else y[k] = unchecked(x[k]);
+    }
+    if (out_of_range > 0) printOutOfRangeMessage(function_name, out_of_range, reset_value);
+}
+
+#endif // TRIGONOMETRIC_BATCH_H
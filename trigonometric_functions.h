@@ -0,0 +1,635 @@
+/**
+ * file: trigonometric_functions.h
+ * type: C++ (header file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+#ifndef TRIGONOMETRIC_FUNCTIONS_H
+#define TRIGONOMETRIC_FUNCTIONS_H
+
+/** preprocessing directives */
+#include <iostream> // standard output (std::cout)
+#include <string> // std::string
+#define MAXIMUM_i 10000 // constant which represents maximum number of iterations in Leibniz series
+#define MAXIMUM_t 10000 // constant which represents maximum number of terms in Taylor series
+#define MAXIMUM_x 10000 // constant which represents maximum value of x
+#define DEFAULT_SEQUENCE_RESEED_INTERVAL 1024 // constant which represents how many recurrence steps a SineCosineSequence takes between re-seeds
+#define PI_OVER_TWO_HIGH 1.57079632673412561417e+00 // constant which represents the first 33 bits of Pi / 2
+#define PI_OVER_TWO_LOW 6.07710050650619224932e-11 // constant which represents Pi / 2 - PI_OVER_TWO_HIGH
+#define TWO_OVER_PI 6.36619772367581382433e-01 // constant which represents 2 / Pi
+
+/** function prototypes */
+constexpr double floorOf(double x);
+constexpr double computePi(int iterations);
+constexpr double sine(double x);
+constexpr double cosine(double x);
+constexpr double tangent(double x);
+constexpr double cotangent(double x);
+constexpr double secant(double x);
+constexpr double cosecant(double x);
+constexpr double arctangent(double x);
+constexpr double arcsine(double x);
+constexpr double arccosine(double x);
+constexpr void sineAndCosine(double x, double & sine_of_x, double & cosine_of_x);
+void generateSineCosineSequence(double x0, double d, long long count, double * sine_output, double * cosine_output, long long reseed_interval = DEFAULT_SEQUENCE_RESEED_INTERVAL);
+bool writeTrigonometricTable(const std::string & file_name, const double * x, long long count);
+
+/**
+ * A SineCosineSequence generates sin(x0 + k * d) and cos(x0 + k * d) for k = 0, 1, 2, ... using the Chebyshev
+ * (angle-addition) recurrence
+ *
+ * sin(x + d) = 2 * cos(d) * sin(x) - sin(x - d)
+ * cos(x + d) = 2 * cos(d) * cos(x) - cos(x - d)
+ *
+ * (i.e. one multiply-add per value per step) instead of evaluating the Taylor series for every element.
+ *
+ * Every reseed_interval steps, the recurrence is re-seeded from sineAndCosine(x0 + k * d) so that the rounding error
+ * which the recurrence accumulates stays bounded (the absolute error grows roughly like steps * 1e-16 / |sin(d)|, so
+ * small steps d call for shorter reseed intervals).
+ */
+class SineCosineSequence
+{
+public:
+    SineCosineSequence(double x0, double d, long long reseed_interval = DEFAULT_SEQUENCE_RESEED_INTERVAL);
+    long long index() const { return k; }
+    double sine() const { return sine_current; }
+    double cosine() const { return cosine_current; }
+    void advance();
+
+private:
+    void seed();
+
+    double x0, d, two_cosine_of_d, sine_of_d, cosine_of_d;
+    long long reseed_interval, k = 0, steps_since_seed = 0;
+    double sine_current = 0.0, sine_previous = 0.0, cosine_current = 1.0, cosine_previous = 1.0;
+};
+
+/**
+ * The kernels below are defined in this header (instead of in trigonometric_functions.cpp) and are constexpr, so that the compiler
+ * can evaluate them wherever their result initializes a constexpr variable (e.g. a lookup table or a constant such as Pi is then
+ * stored in the program file and costs nothing at startup), while calls with run-time arguments compile to ordinary code.
+ *
+ * (The out-of-range branches print a message to std::cout, so an out-of-range argument is a compile-time error in a constant expression.)
+ */
+
+/**
+ * Return the largest whole number which is no larger than x (i.e. std::floor(x), which is not constexpr before C++23).
+ *
+ * Every double whose magnitude is at least 2 ^ 52 (as well as infinity and "not a number") is already returned unchanged.
+ */
+constexpr double floorOf(double x)
+{
+    if (!((x > -4503599627370496.0) && (x < 4503599627370496.0))) return x;
+    double whole = static_cast<double>(static_cast<long long>(x));
+    return (whole > x) ? whole - 1 : whole;
+}
+
+/**
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * This function computes the approximate value of Pi using the Leibniz series.
+ * 
+ * Pi ≈ 4 * (1 - (1 / 3) + (1 / 5) - (1 / 7) + (1 / 9) - ...)
+ * 
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * Pi is a mathematical constant that is the ratio of a circle's circumference to 
+ * its diameter (which is approximately equal to 3.14159).
+ * 
+ * For more information on how to compute the approximate value of Pi
+ * (using a Monte Carlo dart-throwing simulation in JavaScript), visit
+ * the tutorial web page at the following Uniform Resource Locator:
+ * 
+ * https://karlinaobject.wordpress.com/pi_approximation/
+ * 
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * iterations is assumed to be a nonnegative integer no larger than MAXIMUM_iteratons.
+ * 
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ */
+constexpr double computePi(int iterations) 
+{
+    int i = 0;
+    double pi = 0.0;
+    double sign = 1.0; // alternates between positive and negative
+
+    // Set iterations to 1 if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((iterations < 0) || (iterations > MAXIMUM_i)) 
+    {
+        iterations = 1;
+        std::cout << "\n\nThe number of iterations for the Leibniz series in computePi(iterations) was out of range. Hence, iterations has been reset to 1.";
+    }
+
+    for (i = 0; i < iterations; i += 1) 
+    {
+        pi += sign / (2.0 * i + 1.0); // add next term in the series
+        sign = -sign; // alternate the sign for each term
+    }
+
+    pi *= 4.0; // multiply by 4 to get Pi
+    return pi;
+}
+
+/**
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * This function uses the Taylor series to compute the approximate value of sine of x (which is also expressed as sin(x)).
+ * 
+ * The value returned by this function is no smaller than -1 and no larger than 1:
+ * 
+ * -1 <= sin(x) <= 1
+ * 
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * The sine of an angle, x, in a right triangle is defined as the ratio of the length of 
+ * the side opposite the angle to the length of the hypotenuse (the longest side of the triangle):
+ * 
+ * sin(x) = opposite / hypotenuse
+ * 
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * Note that an angle measurement in degrees can be converted to radians using the following formula:
+ * 
+ * radians = degrees * (Pi / 180)
+ * 
+ * If x is 30 degrees, then the right triangle it is the interior angle measurement of is a triangle
+ * whose side opposite of x is 1 and whose hypotenuse is 2.
+ * 
+ * Hence, sine of 30 degrees can be computed as follows:
+ * 
+ * 30 degrees = Pi / 6 radians ≈ 0.5236
+ * 
+ * sin(0.5236) = 1 / 2 = 0.5
+ *
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * x is an angle measurement in radians and can theoretically be any real number (but is constrained to be in [(-1 * MAXIMUM_x), MAXIMUM_x]).
+ * 
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ */
+constexpr double sine(double x) 
+{
+    // Set x to 1 if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((x < (-1 * MAXIMUM_x)) || (x > MAXIMUM_x)) 
+    {
+        x = 1;
+        std::cout << "\n\nThe number of radians, x, in sine(x) was out of range. Hence, x has been reset to 1.";
+    }
+
+    int i = 0;
+    const int terms = MAXIMUM_t; // number of terms in the Taylor series
+    double result = 0.0;
+    double term = x; // first term: ((x ^ 1) / 1!)
+    int sign = 1; // alternating signs for each term
+    for (i = 1; i <= terms; i += 1) 
+    {
+        result += sign * term;
+        sign *= -1; // alternating sign
+        term *= x * x / (2 * i * (2 * i + 1)); // update term for the next iteration
+        if (term == 0) break; // every remaining term is zero (so the remaining iterations would not change result)
+    }
+    return result;
+}
+
+/**
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * This function uses the Taylor series to compute the approximate value of cosine of x (which is also expressed as cos(x)).
+ * 
+ * The value returned by this function is no smaller than -1 and no larger than 1:
+ * 
+ * -1 <= cos(x) <= 1
+ * 
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * The cosine of an angle, x, in a right triangle is defined as the ratio of the length of 
+ * the side adjacent to the angle to the length of the hypotenuse (the longest side of the triangle):
+ * 
+ * cos(x) = adjacent / hypotenuse
+ * 
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * Note that an angle measurement in degrees can be converted to radians using the following formula:
+ * 
+ * radians = degrees * (Pi / 180)
+ * 
+ * If x is 60 degrees, then the right triangle it is the interior angle measurement of is a triangle
+ * whose side adjacent to x is 1 and whose hypotenuse is 2.
+ * 
+ * Hence, cosine of 60 degrees can be computed as follows:
+ * 
+ * 60 degrees = Pi / 3 radians ≈ 1.047
+ * 
+ * cos(1.047) = 1 / 2 = 0.5
+ * 
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * x is an angle measurement in radians and can theoretically be any real number (but is constrained to be in [(-1 * MAXIMUM_x), MAXIMUM_x]).
+ *
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ */
+constexpr double cosine(double x) 
+{
+    // Set x to 1 if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((x < (-1 * MAXIMUM_x)) || (x > MAXIMUM_x)) 
+    {
+        x = 1;
+        std::cout << "\n\nThe number of radians, x, in cosine(x) was out of range. Hence, x has been reset to 1.";
+    }
+
+    int i = 0;
+    const int terms = MAXIMUM_t; // number of terms in the Taylor series
+    double result = 1.0; // first term: ((x ^ 0) / 0!)
+    double term = 1.0; 
+    int sign = -1; // alternating signs for each term
+    for (i = 1; i <= terms; i += 1) 
+    {
+        term *= x * x / (2 * i * (2 * i - 1)); // update term for the next iteration
+        result += sign * term;
+        sign *= -1; // alternating sign
+        if (term == 0) break; // every remaining term is zero (so the remaining iterations would not change result)
+    }
+    return result;
+}
+
+/**
+ *-----------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * This function computes the approximate value of tangent of x (which is also expressed as tan(x)).
+ * 
+ * The value returned by this function can theoretically be any real number:
+ * 
+ * tan(x) ∈ (-INFINITY, INFINITY)
+ * 
+ *-----------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * The tangent of an angle, x, in a right triangle is defined as the ratio of the length of the side opposite 
+ * the angle to the length of the adjacent side:
+ * 
+ * tan(x) = opposite / adjacent
+ * 
+ *-----------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * x is an angle measurement in radians such that, theoretically speaking,
+ * 
+ * x = (((2 * n) + 1) * Pi) / 2 
+ * 
+ * where n is any integer
+ * 
+ * (but, in this program function, x is allowed to be any integer in [(-1 * MAXIMUM_x), MAXIMUM_x]).
+ * 
+ * If x is within [(-1 * MAXIMUM_x), MAXIMUM_x] but 
+ * 
+ * x != (((2 * n) + 1) * Pi) / 2 
+ * 
+ * where n is theoretically any integer,
+ * 
+ * then the output value returned by this function will be "not a number".
+ * 
+ * For example, if x = Pi /2, then tan(x) = "not a number".
+ *
+ *-----------------------------------------------------------------------------------------------------------------------------------
+ */
+constexpr double tangent(double x) 
+{
+    // Set x to 1 if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((x < (-1 * MAXIMUM_x)) || (x > MAXIMUM_x)) 
+    {
+        x = 1;
+        std::cout << "\n\nThe number of radians, x, in tangent(x) was out of range. Hence, x has been reset to 1.";
+    }
+
+    return sine(x) / cosine(x);
+}
+
+/**
+ *-----------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * This function returns the reciprocal of the tangent function:
+ * 
+ * cotangent(x) = cot(x) = 1 / tan(x)
+ * 
+ *------------------------------------------------------------------------------------------------------------------------------------
+ *
+ * The value returned by this function can theoretically be any real number:
+ * 
+ * cot(x) ∈ (-INFINITY, INFINITY)
+ * 
+ *------------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * x is an angle measurement in radians such that, theoretically speaking,
+ * 
+ * sin(x) != 0
+ * 
+ * (i.e. 
+ * 
+ * x != (Pi * n) 
+ * 
+ * where n is any integer)
+ * 
+ * (but, in this program function, x is allowed to be any integer in [(-1 * MAXIMUM_x), MAXIMUM_x]).
+ * 
+ * If x is within [(-1 * MAXIMUM_x), MAXIMUM_x] but also
+ * 
+ * x = Pi * n 
+ * 
+ * where n is any integer
+ * 
+ * then the output value returned by this function will be "not a number".
+ * 
+ * For example, if x = Pi, then cot(x) = "not a number".
+ * 
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ */
+constexpr double cotangent(double x) 
+{
+    // Set x to 1 if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((x < (-1 * MAXIMUM_x)) || (x > MAXIMUM_x)) 
+    {
+        x = 1;
+        std::cout << "\n\nThe number of radians, x, in cotangent(x) was out of range. Hence, x has been reset to 1.";
+    }
+
+    return 1.0 / tangent(x);
+}
+
+/**
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * This function returns the reciprocal of the cosine function:
+ * 
+ * secant(x) = sec(x) = 1 / cos(x)
+ *
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * The value returned by this function can theoretically be any real number less than or equal to -1 
+ * or else any real number greater than or equal to 1:
+ * 
+ * sec(x) ∈ (-INFINITY, -1] ∪ [1, INFINITY)
+ * 
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * x is an angle measurement in radians such that, theoretically speaking,
+ * 
+ * cos(x) != 0
+ * 
+ * (i.e. 
+ * 
+ * x != (((2 * n) + 1) * Pi) / 2
+ * 
+ * where n is any integer)
+ * 
+ * (but, in this program function, x is allowed to be any integer in [(-1 * MAXIMUM_x), MAXIMUM_x]).
+ * 
+ * If x is within [(-1 * MAXIMUM_x), MAXIMUM_x] but also
+ * 
+ * x = (((2 * n) + 1) * Pi) / 2
+ * 
+ * where n is any integer
+ * 
+ * then the output value returned by this function will be "not a number".
+ * 
+ * For example, if x = Pi / 2, then cot(x) = "not a number".
+ *
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ */
+constexpr double secant(double x) 
+{
+    // Set x to 1 if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((x < (-1 * MAXIMUM_x)) || (x > MAXIMUM_x)) 
+    {
+        x = 1;
+        std::cout << "\n\nThe number of radians, x, in secant(x) was out of range. Hence, x has been reset to 1.";
+    }
+
+    return 1.0 / cosine(x);
+}
+
+/**
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * This function returns the reciprocal of the sine function:
+ * 
+ * cosecant(x) = cos(x) = 1 / sin(x)
+ *
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * The value returned by this function can theoretically be any real number less than or equal to -1 
+ * or else any real number greater than or equal to 1:
+ * 
+ * csc(x) ∈ (-INFINITY, -1] ∪ [1, INFINITY)
+ * 
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * x is an angle measurement in radians such that, theoretically speaking,
+ * 
+ * sin(x) != 0
+ * 
+ * (i.e. 
+ * 
+ * x != (Pi * n) 
+ * 
+ * where n is any integer)
+ * 
+ * (but, in this program function, x is allowed to be any integer in [(-1 * MAXIMUM_x), MAXIMUM_x]).
+ * 
+ * If x is within [(-1 * MAXIMUM_x), MAXIMUM_x] but also
+ * 
+ * x = Pi * n 
+ * 
+ * where n is any integer
+ * 
+ * then the output value returned by this function will be "not a number".
+ * 
+ * For example, if x = Pi, then csc(x) = "not a number".
+ * 
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ */
+constexpr double cosecant(double x) 
+{
+    // Set x to 1 if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((x < (-1 * MAXIMUM_x)) || (x > MAXIMUM_x)) 
+    {
+        x = 1;
+        std::cout << "\n\nThe number of radians, x, in cosecant(x) was out of range. Hence, x has been reset to 1.";
+    }
+
+    return 1.0 / sine(x);
+}
+
+/**
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * This function returns the inverse of the cosine function using the Taylor series:
+ * 
+ * arctangent(x) = atan(x) = tan ^ -1 (x) != 1 / tan(x) = (tan(x)) ^ -1
+ * 
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ *
+ * The value returned by this function can theoretically be any real number less than or equal to (-1 * (Pi / 2))
+ * or any real number greater than or equal to (Pi / 2):
+ * 
+ * atan(x) ∈ [(-1 * (Pi / 2)), (Pi / 2)]
+ * 
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * x is an angle measurement in radians and can theoretically be any real number (but is constrained to be in [(-1 * MAXIMUM_x), MAXIMUM_x]).
+ * 
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ */
+constexpr double arctangent(double x) 
+{
+    // Set x to 1 if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((x < (-1 * MAXIMUM_x)) || (x > MAXIMUM_x)) 
+    {
+        x = 1;
+        std::cout << "\n\nThe number of radians, x, in arctangent(x) was out of range. Hence, x has been reset to 1.";
+    }
+
+    int i = 0;
+    const int terms = MAXIMUM_t; // number of terms in the series
+    double result = 0.0;
+    double term = x; // first term
+    int sign = 1; // alternating signs for each term
+    for (i = 0; i < terms; i += 1) 
+    {
+        result += sign * term;
+        sign *= -1; // alternating sign
+        term *= x * x * (2 * i + 1) / (2 * i + 3); // update term for the next iteration
+        if (term == 0) break; // every remaining term is zero (so the remaining iterations would not change result)
+    }
+    return result;
+}
+
+/**
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * This function returns the inverse of the sine function using the Taylor series:
+ * 
+ * arcsine(x) = asin(x) = sin ^ -1 (x) != 1 / sin(x) = (sin(x)) ^ -1
+ * 
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ *
+ * The value returned by this function can theoretically be any real number less than or equal to (-1 * (Pi / 2))
+ * or any real number greater than or equal to (Pi / 2):
+ * 
+ * asin(x) ∈ [(-1 * (Pi / 2)), (Pi / 2)]
+ * 
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * x is an angle measurement in radians and is only valid if
+ * 
+ * x ∈ [-1, 1]
+ * 
+ * where x is a real number
+ * 
+ * (but, in this program, x can be in [(-1 * MAXIMUM_x), MAXIMUM_x]).
+ * 
+ * If x is out of range of [-1, 1], then asin(x) = "not a number".
+ * 
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ */
+constexpr double arcsine(double x) 
+{
+    // Set x to 1 if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((x < (-1 * MAXIMUM_x)) || (x > MAXIMUM_x)) 
+    {
+        x = 1;
+        std::cout << "\n\nThe number of radians, x, in arcsine(x) was out of range. Hence, x has been reset to 1.";
+    }
+
+    const int terms = MAXIMUM_t;
+    double result = x;
+    double term = x;
+    for (int i = 1; i < terms; ++i) 
+    {
+        term *= (x * x * (2 * i - 1)) / (2 * i);
+        result += term / (2 * i + 1);
+        if (term == 0) break; // every remaining term is zero (so the remaining iterations would not change result)
+    }
+    return result;
+}
+
+/**
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * This function returns the inverse of the cosine function using the following formula: acos(x) = pi/2 - asin(x)
+ * 
+ * arccosine(x) = acos(x) = cos ^ -1 (x) != 1 / cos(x) = (cos(x)) ^ -1
+ * 
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * The value returned by this function can theoretically be any real number less than or equal to 0
+ * or any real number greater than or equal to Pi:
+ * 
+ * acos(x) ∈ [0, Pi]
+ * 
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * x is an angle measurement in radians and is only valid if
+ * 
+ * x ∈ [-1, 1]
+ * 
+ * where x is a real number
+ * 
+ * (but, in this program, x can be in [(-1 * MAXIMUM_x), MAXIMUM_x]).
+ * 
+ * If x is out of range of [-1, 1], then acos(x) = "not a number".
+ * 
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ */
+constexpr double arccosine(double x) 
+{
+    // Set x to 1 if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((x < (-1 * MAXIMUM_x)) || (x > MAXIMUM_x)) 
+    {
+        x = 1;
+        std::cout << "\n\nThe number of radians, x, in arccosine(x) was out of range. Hence, x has been reset to 1.";
+    }
+
+    constexpr double pi = computePi(MAXIMUM_i); // the Leibniz series is summed once by the compiler (instead of once per call)
+    return pi / 2 - arcsine(x);  
+}
+
+/**
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * This function stores sin(x) in sine_of_x and cos(x) in cosine_of_x.
+ * 
+ * Unlike sine(x) and cosine(x) (whose Taylor series lose every correct digit once x is larger than about 40 in magnitude),
+ * this function first reduces x to 
+ * 
+ * r = x - (n * (Pi / 2)) where n is the integer nearest to x / (Pi / 2) (so that r ∈ [(-1 * (Pi / 4)), (Pi / 4)])
+ * 
+ * (using a two-part representation of Pi / 2 so that the subtraction stays accurate) and then uses the following identities:
+ * 
+ * n mod 4 = 0 --> sin(x) = sin(r), cos(x) = cos(r)
+ * n mod 4 = 1 --> sin(x) = cos(r), cos(x) = -sin(r)
+ * n mod 4 = 2 --> sin(x) = -sin(r), cos(x) = -cos(r)
+ * n mod 4 = 3 --> sin(x) = -cos(r), cos(x) = sin(r)
+ * 
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ * 
+ * x is an angle measurement in radians and can be any real number whose magnitude is no larger than about 1.6 * 10 ^ 6
+ * (i.e. 2 ^ 20 * (Pi / 2), beyond which n * PI_OVER_TWO_HIGH is no longer computed exactly; e.g. sin(10 ^ 9) is off by about 6e-8).
+ * 
+ *----------------------------------------------------------------------------------------------------------------------------------------------
+ */
+constexpr void sineAndCosine(double x, double & sine_of_x, double & cosine_of_x)
+{
+    double n = floorOf(x * TWO_OVER_PI + 0.5);
+    double r = (x - n * PI_OVER_TWO_HIGH) - n * PI_OVER_TWO_LOW;
+    double sine_of_r = sine(r), cosine_of_r = cosine(r);
+    switch (static_cast<long long>(n) & 3)
+    {
+        case 0: sine_of_x = sine_of_r; cosine_of_x = cosine_of_r; break;
+        case 1: sine_of_x = cosine_of_r; cosine_of_x = -sine_of_r; break;
+        case 2: sine_of_x = -sine_of_r; cosine_of_x = -cosine_of_r; break;
+        default: sine_of_x = -cosine_of_r; cosine_of_x = sine_of_r; break;
+    }
+}
+
+#endif // TRIGONOMETRIC_FUNCTIONS_H
@@ -0,0 +1,128 @@
+/**
+ * file: trigonometric_functions_main.cpp
+ * type: C++ (source file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+/** preprocessing directives */
+#include <iostream> // standard input (std::cin), standard output (std::cout)
+#include "trigonometric_functions.h" // computePi, sine, cosine, tangent, cotangent, secant, cosecant, arctangent, arcsine, arccosine
+#include "tee_output.h" // TeeOutput
+
+/** program entry point */
+int main() 
+{
+
+    // Define one double type variable for storing a floating-point number value.
+    double x;
+
+    // Declare a variable for storing the program user's answer of whether or not to continue inputting values.
+    int input_additional_values = 1;
+
+    /**
+     * If the file named trigonometric_functions_output.txt does not already exist 
+     * inside of the same file directory as the program, 
+     * create a new file named trigonometric_functions_output.txt in that directory.
+     * 
+     * Open the plain-text file named trigonometric_functions_output.txt
+     * and set that file to be overwritten with program data.
+     * 
+     * Every value which is printed through output is formatted only once (as the shortest decimal number which converts back 
+     * to exactly the same double) and is then copied to the command line terminal and to the (buffered) file output stream.
+     */
+    TeeOutput output("trigonometric_functions_output.txt");
+
+    // Print an opening message to the command line terminal.
+    output.console << "\n\n--------------------------------";
+    output.console << "\nStart Of Program";
+    output.console << "\n--------------------------------";
+
+    // Print an opening message to the file output stream.
+    output.file << "--------------------------------";
+    output.file << "\nStart Of Program";
+    output.file << "\n--------------------------------";
+
+    // Print "This C++ program computes sine, cosine, tangent, cotangent, secant, cosecant, arctangent, arcsine, and arccosine of some angle measurement in radians, x.
+    output << "\n\nThis C++ program computes sine, cosine, tangent, cotangent, secant, cosecant, arctangent, arcsine, and arccosine of some angle measurement in radians, x.";
+
+    // Execute the code inside of the while loop block at least once (and until the program user inputs a value specifying to exit the program).
+    while (input_additional_values != 0)
+    {
+        // Print a horizontal divider line to the command line terminal and to the file output stream.
+        output << "\n\n--------------------------------";
+
+        // Prompt the user to enter an input value for x (and print that prompt to the command line terminal and to the file output stream).
+        output << "\n\nEnter a real number of radians, x, to input into trigonometric functions which is no smaller than " << (-1 * MAXIMUM_x) << " and no larger than " << MAXIMUM_x << ": ";
+
+        // Scan the command line terminal for the most recent keyboard input value. Store that value in x.
+        std::cin >> x;
+
+        // Print "The value which was entered for x is {x}." to the command line terminal and to the file output stream.
+        output.console << "\nThe value which was entered for x is " << x << ".";
+        output.file << "\n\nThe value which was entered for x is " << x << ".";
+
+        // Print a horizontal divider line to the command line terminal and to the file output stream.
+        output << "\n\n--------------------------------";
+
+        // Print the value of sine of x to the command line terminal and to the output file.
+        output << "\n\nsine(x) = " << sine(x) << ".";
+
+        // Print the value of cosine of x to the command line terminal and to the output file.
+        output << "\n\ncosine(x) = " << cosine(x) << ".";
+
+        // Print the value of tangent of x to the command line terminal and to the output file.
+        output << "\n\ntangent(x) = " << tangent(x) << ".";
+
+        // Print a horizontal divider line to the command line terminal and to the file output stream.
+        output << "\n\n--------------------------------";
+
+        // Print the value of cotangent of x to the command line terminal and to the output file.
+        output << "\n\ncotangent(x) = " << cotangent(x) << ".";
+
+        // Print the value of secant of x to the command line terminal and to the output file.
+        output << "\n\nsecant(x) = " << secant(x) << ".";
+
+        // Print the value of cosecant of x to the command line terminal and to the output file.
+        output << "\n\ncosecant(x) = " << secant(x) << ".";
+
+        // Print a horizontal divider line to the command line terminal and to the file output stream.
+        output << "\n\n--------------------------------";
+
+        // Print the value of arctangent of x to the command line terminal and to the output file.
+        output << "\n\narctangent(x) = " << arctangent(x) << ".";
+
+        // Print the value of arcsine of x to the command line terminal and to the output file.
+        output << "\n\narcsine(x) = " << arcsine(x) << ".";
+
+        // Print the value of arccosine of x to the command line terminal and to the output file.
+        output << "\n\narccosine(x) = " << arccosine(x) << ".";
+
+        // Print a horizontal divider line to the command line terminal and to the file output stream.
+        output << "\n\n--------------------------------";
+
+        // Ask the user whether or not to continue inputing values.
+        output.console << "\n\nWould you like to continue inputting program values? (Enter 1 if YES. Enter 0 if NO): ";
+
+        // Scan the command line terminal for the most recent keyboard input value.
+        std::cin >> input_additional_values;
+
+    }
+
+    // Print a closing message to the command line terminal.
+    output.console << "\n\n--------------------------------";
+    output.console << "\nEnd Of Program";
+    output.console << "\n--------------------------------\n\n";
+
+    // Print a closing message to the file output stream.
+    output.file << "\n\n--------------------------------";
+    output.file << "\nEnd Of Program";
+    output.file << "\n--------------------------------";
+
+    // Write the remaining buffered program data to the file output stream and close that file.
+    output.close();
+
+    // Exit the program.
+    return 0; 
+}
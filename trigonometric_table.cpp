@@ -0,0 +1,345 @@
+/**
+ * file: trigonometric_table.cpp
+ * type: C++ (source file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+/** preprocessing directives */
+#include <iostream> // standard output (std::cout)
+#include <fstream> // file output
+#include <cmath> // std::floor, std::fmod, std::isfinite
+#include <cstdint> // std::uint32_t, std::uint64_t
+#include <cstdio> // std::rename, std::remove
+#include <cstdlib> // std::aligned_alloc, std::free
+#include <cstring> // std::memcmp, std::memcpy
+#include <utility> // std::move
+#include "trigonometric_functions.h" // sineAndCosine, MAXIMUM_x
+#include "trigonometric_batch.h" // reduceByPiOverTwo
+#include "trigonometric_table.h" // SineCosineTable
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h> // open
+#include <sys/mman.h> // mmap, munmap
+#include <sys/stat.h> // fstat
+#include <unistd.h> // close, getpid
+#define TRIGONOMETRIC_TABLE_HAS_MMAP 1
+#endif
+#define CACHE_LINE_SIZE 64 // constant which represents the number of bytes in one cache line
+#define TRIGONOMETRIC_TABLE_FILE_VERSION 1 // constant which represents the version of the table file layout
+
+/**
+ * Define a struct-type variable named TableFileHeader which occupies the first cache line of a table file
+ * (so that the (sin, cos) pairs which follow it are cache-line-aligned inside of a page-aligned memory mapping).
+ */
+struct TableFileHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t resolution;
+    std::uint64_t value_count;
+    char padding[CACHE_LINE_SIZE - 24];
+};
+
+static_assert(sizeof(TableFileHeader) == CACHE_LINE_SIZE, "TableFileHeader is required to occupy exactly one cache line.");
+
+static const char TABLE_FILE_MAGIC[8] = { 'K', 'A', 'R', 'B', 'T', 'R', 'I', 'G' };
+
+/**
+ * Define a struct-type variable named SineCosineValues which stores the (sin, cos) pairs of a table of resolution N
+ * (aligned to a cache line, as the tables which the constructor allocates are).
+ */
+template <int N> struct SineCosineValues {
+    alignas(CACHE_LINE_SIZE) double values[2 * (N + 1)];
+};
+
+/**
+ * Return the (sin, cos) pairs of a table of resolution N, computed exactly as the constructor computes them
+ * (so that the compiler can compute them if the result initializes a constexpr variable).
+ */
+template <int N> constexpr SineCosineValues<N> makeSineCosineValues()
+{
+    SineCosineValues<N> table = {};
+    for (long long k = 0; k <= N; k += 1)
+    {
+        double angle = (2 * TRIGONOMETRIC_TABLE_PI) * (static_cast<double>(k) / N);
+        sineAndCosine(angle, table.values[2 * k], table.values[2 * k + 1]);
+    }
+    return table;
+}
+
+// The table of the default resolution is computed at compile time (so that constructing it costs nothing at startup).
+static constexpr SineCosineValues<DEFAULT_TRIGONOMETRIC_TABLE_RESOLUTION> DEFAULT_SINE_COSINE_VALUES = makeSineCosineValues<DEFAULT_TRIGONOMETRIC_TABLE_RESOLUTION>();
+
+/**
+ * Build a table of sin(x) and cos(x) for the resolution + 1 angles x = k * (2 * Pi) / resolution where k = 0, 1, ..., resolution.
+ *
+ * Each entry is computed by sineAndCosine() (which reduces the angle to [-Pi / 4, Pi / 4], where the Taylor series in
+ * sine() and cosine() are most accurate). The table of DEFAULT_TRIGONOMETRIC_TABLE_RESOLUTION was computed by the compiler,
+ * so a table of that resolution is not computed again (and not copied): it refers to the values stored in the program file.
+ *
+ * If resolution is out of range (or if the memory for the table cannot be allocated), resolution is reset to DEFAULT_TRIGONOMETRIC_TABLE_RESOLUTION.
+ */
+SineCosineTable::SineCosineTable(int resolution)
+{
+    // Set resolution to the default value if the function input value is out or range. Then print a message about that change to the command line terminal.
+    if ((resolution < MINIMUM_TRIGONOMETRIC_TABLE_RESOLUTION) || (resolution > MAXIMUM_TRIGONOMETRIC_TABLE_RESOLUTION))
+    {
+        resolution = DEFAULT_TRIGONOMETRIC_TABLE_RESOLUTION;
+        std::cout << "\n\nThe resolution of the SineCosineTable was out of range. Hence, resolution has been reset to " << DEFAULT_TRIGONOMETRIC_TABLE_RESOLUTION << ".";
+    }
+
+    setResolution(resolution);
+    if (resolution == DEFAULT_TRIGONOMETRIC_TABLE_RESOLUTION)
+    {
+        values = DEFAULT_SINE_COSINE_VALUES.values;
+        return;
+    }
+
+    // Round the allocation up to a whole number of cache lines (which std::aligned_alloc requires).
+    std::size_t bytes = 2 * sizeof(double) * (static_cast<std::size_t>(resolution) + 1);
+    bytes = ((bytes + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE) * CACHE_LINE_SIZE;
+    owned_values = static_cast<double *>(std::aligned_alloc(CACHE_LINE_SIZE, bytes));
+
+    // If the memory could not be allocated, use the (compile-time) table of the default resolution instead. Then print a message about that change to the command line terminal.
+    if (owned_values == nullptr)
+    {
+        setResolution(DEFAULT_TRIGONOMETRIC_TABLE_RESOLUTION);
+        values = DEFAULT_SINE_COSINE_VALUES.values;
+        std::cout << "\n\nThe memory for a SineCosineTable of resolution " << resolution << " could not be allocated. Hence, resolution has been reset to " << DEFAULT_TRIGONOMETRIC_TABLE_RESOLUTION << ".";
+        return;
+    }
+    values = owned_values;
+
+    for (long long k = 0; k <= resolution; k += 1)
+    {
+        double angle = (2 * TRIGONOMETRIC_TABLE_PI) * (static_cast<double>(k) / resolution);
+        sineAndCosine(angle, owned_values[2 * k], owned_values[2 * k + 1]);
+    }
+}
+
+SineCosineTable::~SineCosineTable()
+{
+    release();
+}
+
+SineCosineTable::SineCosineTable(SineCosineTable && other) noexcept
+{
+    *this = std::move(other);
+}
+
+SineCosineTable & SineCosineTable::operator=(SineCosineTable && other) noexcept
+{
+    if (this == &other) return *this;
+    release();
+    setResolution(other.table_resolution);
+    values = other.values;
+    owned_values = other.owned_values;
+    mapping = other.mapping;
+    mapping_length = other.mapping_length;
+    other.setResolution(0);
+    other.values = nullptr;
+    other.owned_values = nullptr;
+    other.mapping = nullptr;
+    other.mapping_length = 0;
+    return *this;
+}
+
+/**
+ * Store resolution and the grid spacing which follows from it.
+ */
+void SineCosineTable::setResolution(int resolution)
+{
+    table_resolution = resolution;
+    step_length = (resolution > 0) ? ((2 * TRIGONOMETRIC_TABLE_PI) / resolution) : 0.0;
+    inverse_step_length = (resolution > 0) ? (resolution / (2 * TRIGONOMETRIC_TABLE_PI)) : 0.0;
+}
+
+/**
+ * Free the memory (or unmap the file) which stores the table.
+ */
+void SineCosineTable::release()
+{
+    std::free(owned_values);
+#if defined(TRIGONOMETRIC_TABLE_HAS_MMAP)
+    if (mapping != nullptr) munmap(mapping, mapping_length);
+#endif
+    owned_values = nullptr;
+    mapping = nullptr;
+    mapping_length = 0;
+    values = nullptr;
+}
+
+/**
+ * Write the table (preceded by a one-cache-line header) to the file named file_name.
+ *
+ * The file is first written under a temporary name and then renamed so that other processes which map
+ * the same file name never observe a partially written table.
+ *
+ * Return true if the file was written. Otherwise, return false.
+ */
+bool SineCosineTable::writeFile(const std::string & file_name) const
+{
+    TableFileHeader header = {};
+    std::memcpy(header.magic, TABLE_FILE_MAGIC, sizeof(header.magic));
+    header.version = TRIGONOMETRIC_TABLE_FILE_VERSION;
+    header.resolution = static_cast<std::uint32_t>(table_resolution);
+    header.value_count = 2 * (static_cast<std::uint64_t>(table_resolution) + 1);
+
+#if defined(TRIGONOMETRIC_TABLE_HAS_MMAP)
+    std::string temporary_file_name = file_name + ".tmp" + std::to_string(getpid());
+#else
+    std::string temporary_file_name = file_name + ".tmp";
+#endif
+
+    std::ofstream file(temporary_file_name, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(values), static_cast<std::streamsize>(header.value_count * sizeof(double)));
+    file.close();
+
+    if (!file)
+    {
+        std::remove(temporary_file_name.c_str());
+        return false;
+    }
+    return std::rename(temporary_file_name.c_str(), file_name.c_str()) == 0;
+}
+
+/**
+ * Return a table whose values live inside of a read-only, shared memory mapping of the file named file_name.
+ *
+ * If that file does not exist (or stores a table of some other resolution), the table is built, written to that file,
+ * and then mapped (so that subsequent processes only need to map it).
+ *
+ * If the file cannot be written or mapped (or if the platform does not support memory mapping), a message is printed to the
+ * command line terminal and a table built in (private) memory is returned instead.
+ */
+SineCosineTable SineCosineTable::mapFile(const std::string & file_name, int resolution)
+{
+    if ((resolution < MINIMUM_TRIGONOMETRIC_TABLE_RESOLUTION) || (resolution > MAXIMUM_TRIGONOMETRIC_TABLE_RESOLUTION)) return SineCosineTable(resolution);
+
+#if defined(TRIGONOMETRIC_TABLE_HAS_MMAP)
+    const std::size_t expected_length = sizeof(TableFileHeader) + 2 * sizeof(double) * (static_cast<std::size_t>(resolution) + 1);
+
+    // Try to map an existing table file. If that fails, build the table, write the file, and try once more.
+    for (int attempt = 0; attempt < 2; attempt += 1)
+    {
+        int descriptor = open(file_name.c_str(), O_RDONLY);
+        if (descriptor >= 0)
+        {
+            struct stat status;
+            void * address = MAP_FAILED;
+            if ((fstat(descriptor, &status) == 0) && (static_cast<std::size_t>(status.st_size) == expected_length))
+            {
+                address = mmap(nullptr, expected_length, PROT_READ, MAP_SHARED, descriptor, 0);
+            }
+            close(descriptor);
+
+            if (address != MAP_FAILED)
+            {
+                const TableFileHeader * header = static_cast<const TableFileHeader *>(address);
+                if ((std::memcmp(header->magic, TABLE_FILE_MAGIC, sizeof(header->magic)) == 0) && (header->version == TRIGONOMETRIC_TABLE_FILE_VERSION) && (header->resolution == static_cast<std::uint32_t>(resolution)))
+                {
+                    SineCosineTable table(UnbuiltTable{});
+                    table.setResolution(resolution);
+                    table.values = reinterpret_cast<const double *>(static_cast<const char *>(address) + sizeof(TableFileHeader));
+                    table.mapping = address;
+                    table.mapping_length = expected_length;
+                    return table;
+                }
+                munmap(address, expected_length);
+            }
+        }
+
+        if (attempt == 0)
+        {
+            SineCosineTable table(resolution);
+            if (!table.writeFile(file_name)) break;
+        }
+    }
+
+    std::cout << "\n\nThe SineCosineTable file " << file_name << " could not be mapped. Hence, the table has been built in private memory instead.";
+#else
+    std::cout << "\n\nMemory mapping is not supported on this platform. Hence, the SineCosineTable has been built in private memory instead.";
+#endif
+    return SineCosineTable(resolution);
+}
+
+/**
+ * Return the upper bound on the absolute error of sine(x) and cosine(x) which are answered by cubic Hermite interpolation:
+ *
+ * |error| <= (h ^ 4) / 384 * max|f''''(x)| = (h ^ 4) / 384 (because the fourth derivative of sin and cos is no larger than 1 in magnitude).
+ *
+ * (The bound holds for every x in [(-1 * MAXIMUM_x), MAXIMUM_x], whose reduction by locate() is exact to the last bit of r, up to the
+ * rounding errors of the table entries and of the interpolation, which add about 4e-16. Larger arguments add a placement error which grows with |x|.)
+ */
+double SineCosineTable::maximumInterpolationError() const
+{
+    double h = step();
+    return (h * h * h * h) / 384;
+}
+
+/**
+ * Return i modulo resolution (as a value in [0, resolution)).
+ */
+long long SineCosineTable::wrapIndex(long long i) const
+{
+    i %= table_resolution;
+    return (i < 0) ? (i + table_resolution) : i;
+}
+
+/**
+ * Determine the table interval, [i * h, (i + 1) * h], which contains x (after x is reduced into one period)
+ * and the position, u in [0, 1), of x inside of that interval.
+ *
+ * For x in [(-1 * MAXIMUM_x), MAXIMUM_x], x is first written as x = n * (Pi / 2) + r by reduceByPiOverTwo (whose three-part Pi / 2 keeps r accurate
+ * to its last bit). n * (Pi / 2) is (n modulo 4) * (resolution / 4) steps of the table (which is exact in a double), so only the small r is scaled
+ * by 1 / h. (Scaling x itself would round x * (1 / h) to about 16 digits of a number near 10 ^ 7, i.e. would misplace u by about 1e-9 and add
+ * about 1e-12 to the interpolation error at |x| near MAXIMUM_x.) Larger arguments are scaled directly, so their error grows with |x|.
+ */
+void SineCosineTable::locate(double x, long long & i, double & u) const
+{
+    double t = 0.0;
+    if ((x >= (-1 * MAXIMUM_x)) && (x <= MAXIMUM_x))
+    {
+        double r_low = 0.0;
+        std::uint64_t quadrant = 0;
+        double r = reduceByPiOverTwo(x, r_low, quadrant);
+        t = static_cast<double>(quadrant) * (0.25 * table_resolution) + (r + r_low) * inverse_step_length;
+    }
+    else t = x * inverse_step_length;
+    if (!std::isfinite(t)) t = 0;
+
+    // Only arguments whose grid position does not fit inside of a long long need the (slower) floating-point remainder.
+    if ((t >= 4.0e18) || (t <= -4.0e18)) t = std::fmod(t, static_cast<double>(table_resolution));
+    double f = std::floor(t);
+    i = wrapIndex(static_cast<long long>(f));
+    u = t - f;
+}
+
+/**
+ * Return sin(x) by cubic Hermite interpolation between the two table entries which surround x.
+ */
+double SineCosineTable::sine(double x) const
+{
+    long long i = 0;
+    double u = 0.0;
+    locate(x, i, u);
+    const double * entry = values + 2 * i; // { sin(i * h), cos(i * h), sin((i + 1) * h), cos((i + 1) * h) }
+    double h = step_length, v = 1 - u;
+    double h00 = (1 + 2 * u) * v * v, h10 = u * v * v, h01 = u * u * (3 - 2 * u), h11 = -u * u * v;
+    return h00 * entry[0] + h10 * h * entry[1] + h01 * entry[2] + h11 * h * entry[3];
+}
+
+/**
+ * Return cos(x) by cubic Hermite interpolation between the two table entries which surround x.
+ */
+double SineCosineTable::cosine(double x) const
+{
+    long long i = 0;
+    double u = 0.0;
+    locate(x, i, u);
+    const double * entry = values + 2 * i; // { sin(i * h), cos(i * h), sin((i + 1) * h), cos((i + 1) * h) }
+    double h = step_length, v = 1 - u;
+    double h00 = (1 + 2 * u) * v * v, h10 = u * v * v, h01 = u * u * (3 - 2 * u), h11 = -u * u * v;
+    return h00 * entry[1] - h10 * h * entry[0] + h01 * entry[3] - h11 * h * entry[2];
+}
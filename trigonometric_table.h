@@ -0,0 +1,76 @@
+/**
+ * file: trigonometric_table.h
+ * type: C++ (header file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+#ifndef TRIGONOMETRIC_TABLE_H
+#define TRIGONOMETRIC_TABLE_H
+
+/** preprocessing directives */
+#include <cstddef> // std::size_t
+#include <string> // std::string
+#define TRIGONOMETRIC_TABLE_PI 3.141592653589793238462643383279502884 // constant which represents Pi (to more digits than a double can store)
+#define MINIMUM_TRIGONOMETRIC_TABLE_RESOLUTION 4 // constant which represents the minimum number of table entries per period (2 * Pi)
+#define MAXIMUM_TRIGONOMETRIC_TABLE_RESOLUTION 16777216 // constant which represents the maximum number of table entries per period (2 * Pi)
+#define DEFAULT_TRIGONOMETRIC_TABLE_RESOLUTION 4096 // constant which represents the default number of table entries per period (2 * Pi)
+
+/**
+ * A SineCosineTable stores sin(x) and cos(x) at resolution equally spaced angles of one period, [0, 2 * Pi),
+ * so that hot loops over fixed angle grids (e.g. FFT twiddle factors or rotation tables) can look those values up
+ * instead of evaluating the 10000-term Taylor series in sine() and cosine() for every query.
+ *
+ * The table is built once (using sineAndCosine(), which evaluates sine() and cosine() on [-Pi / 4, Pi / 4], at compile time for the default resolution)
+ * and is stored in a cache-line-aligned array of interleaved (sin, cos) pairs so that both neighbours of any query share
+ * (at most) two cache lines.
+ *
+ * Angles which are not on the grid are answered by cubic Hermite interpolation (because cos is the derivative of sin and
+ * -sin is the derivative of cos, the table already stores the slopes which that interpolation needs). The absolute
+ * interpolation error is no larger than h^4 / 384 where h = (2 * Pi) / resolution (i.e. about 1.4e-14 for the default
+ * resolution of 4096) for every x in [(-1 * MAXIMUM_x), MAXIMUM_x] (which is reduced by Pi / 2 in three parts before the table is indexed).
+ *
+ * A table can also be written to a file and memory-mapped (read-only and shared) so that many processes use one copy.
+ */
+class SineCosineTable
+{
+public:
+    explicit SineCosineTable(int resolution = DEFAULT_TRIGONOMETRIC_TABLE_RESOLUTION);
+    ~SineCosineTable();
+    SineCosineTable(SineCosineTable && other) noexcept;
+    SineCosineTable & operator=(SineCosineTable && other) noexcept;
+    SineCosineTable(const SineCosineTable &) = delete;
+    SineCosineTable & operator=(const SineCosineTable &) = delete;
+
+    static SineCosineTable mapFile(const std::string & file_name, int resolution = DEFAULT_TRIGONOMETRIC_TABLE_RESOLUTION);
+    bool writeFile(const std::string & file_name) const;
+
+    int resolution() const { return table_resolution; }
+    bool isMapped() const { return mapping != nullptr; }
+    double step() const { return step_length; }
+    double maximumInterpolationError() const;
+
+    double sineAtIndex(long long i) const { return values[2 * wrapIndex(i)]; }
+    double cosineAtIndex(long long i) const { return values[2 * wrapIndex(i) + 1]; }
+    double sine(double x) const;
+    double cosine(double x) const;
+
+private:
+    struct UnbuiltTable {};
+    explicit SineCosineTable(UnbuiltTable) {}
+    void release();
+    long long wrapIndex(long long i) const;
+    void locate(double x, long long & i, double & u) const;
+    void setResolution(int resolution);
+
+    int table_resolution = 0;
+    double step_length = 0.0; // (2 * Pi) / table_resolution
+    double inverse_step_length = 0.0; // table_resolution / (2 * Pi) (stored so that queries do not divide)
+    const double * values = nullptr; // (sin, cos) pairs for the resolution + 1 angles k * step() where k = 0, 1, ..., resolution
+    double * owned_values = nullptr; // values allocated by this object (nullptr if values lives inside of a memory-mapped file or of the compile-time table)
+    void * mapping = nullptr; // start of the memory-mapped file (nullptr if the table was built in memory)
+    std::size_t mapping_length = 0;
+};
+
+#endif // TRIGONOMETRIC_TABLE_H
@@ -0,0 +1,381 @@
+/**
+ * file: validate_math_kernels.cpp
+ * type: C++ (source file)
+ * date: 18_OCTOBER_2026
+ * author: karbytes
+ * license: PUBLIC_DOMAIN
+ */
+
+/**
+ * This program measures how many of the digits which the kernels in libkarbytes_math return are actually correct.
+ *
+ * For each kernel, a (reproducible) pseudo-random sweep of arguments over some input range is evaluated both by the kernel
+ * and by a long double precision reference function from the C++ standard library. Then the following values are reported
+ * side by side:
+ *
+ * max_ulp: the largest error in units in the last place (of a double) over the sweep,
+ * mean_abs_error: the mean absolute error over the sweep,
+ * max_rel_error: the largest relative error over the sweep,
+ * digits: the number of correct significant decimal digits which are guaranteed by max_rel_error (i.e. -log10(max_rel_error)),
+ * non_finite: the number of arguments for which the kernel returned infinity or "not a number" while the reference was finite,
+ * calls_per_second: the throughput of the kernel over the sweep.
+ *
+ * Usage:
+ *
+ * validate_math_kernels [--samples=N] [--filter=SUBSTRING[|SUBSTRING...]] [--max-rel-error=E] [--out=FILE.json]
+ *
+ * --filter selects the kernels whose names contain at least one of the substrings which are separated by |.
+ *
+ * If --max-rel-error is given, the program exits with status 1 (after printing the table) if any selected kernel has a max_rel_error
+ * above E or returned a non-finite value for a finite reference (so that ctest can run it as a pass/fail check; see CMakeLists.txt).
+ */
+
+/** preprocessing directives */
+#include <iostream> // standard output (std::cout)
+#include <fstream> // file output
+#include <iomanip> // std::setw
+#include <chrono> // std::chrono::steady_clock
+#include <cmath> // std::sin, std::log, std::nextafter, std::isfinite, ...
+#include <cstdlib> // std::atoll, std::atof
+#include <cstring> // std::strncmp
+#include <functional> // std::function
+#include <limits> // std::numeric_limits
+#include <random> // std::mt19937_64
+#include <string> // std::string
+#include <vector> // std::vector
+#include "trigonometric_functions.h" // computePi, sine, cosine, tangent, arctangent, arcsine, arccosine, MAXIMUM_x
+#include "trigonometric_table.h" // SineCosineTable
+#include "trigonometric_batch.h" // tangentBatch, cotangentBatch, secantBatch, cosecantBatch, reciprocalWithoutDivision
+#include "logarithm.h" // ln, power_of_e_to_x, power, logarithm, logarithmBaseTwo, logarithmBaseTen, logarithmOfOnePlus, powerOfTwoToX, powerOfEToXMinusOne
+#include "exponential_kernels.h" // exponentialKernel, exponentialMinusOneKernel, logarithmKernel, logarithmOfOnePlusKernel
+#include "hyperbolic_functions.h" // hyperbolicSine, hyperbolicCosine, hyperbolicTangent, inverseHyperbolicSine, ... (and their batch forms)
+#include "accuracy_tiers.h" // tieredLn, tieredPowerOfEToX, tieredPower, tieredSine, tieredCosine, tieredArctangent, tieredLogarithm
+#include "float_kernels.h" // sineFloatBatch, cosineFloatBatch, lnFloatBatch, powerOfEToXFloatBatch, powerFloatBatch
+#include "fundamental_theorem_of_calculus.h" // Function, computeRiemannSum, integral, derivative, generate_array_of_functions
+#include "gauss_legendre.h" // integrateGaussLegendre
+#include "tanh_sinh.h" // integrateTanhSinh
+#include "chebyshev.h" // ChebyshevExpansion
+#include "root_finding.h" // findRootBrent, findRootNewtonDual
+#include "big_float.h" // BigFloat
+#include "double_double.h" // DoubleDouble
+#include "interval.h" // Interval
+#define DEFAULT_SAMPLES 1000000 // constant which represents the default number of arguments in each sweep
+#define RANDOM_SEED 20241021 // constant which represents the seed of the argument generator (so that runs are reproducible)
+
+/**
+ * Define a struct-type variable named ValidationCase which stores one kernel under test
+ * where name identifies the kernel and the input range,
+ * where kernel is the function under test,
+ * where reference is the high-precision function which kernel is compared to,
+ * where minimum and maximum are the end-points of the input range,
+ * and where samples_divisor divides the number of samples (for kernels which take microseconds per call).
+ */
+struct ValidationCase {
+    std::string name;
+    std::function<double(double)> kernel;
+    std::function<long double(long double)> reference;
+    double minimum;
+    double maximum;
+    long long samples_divisor;
+};
+
+/**
+ * Define a struct-type variable named ValidationResult which stores the error statistics of one ValidationCase.
+ */
+struct ValidationResult {
+    std::string name;
+    long long samples;
+    double max_ulp;
+    double max_ulp_argument;
+    double mean_abs_error;
+    double max_rel_error;
+    long long non_finite;
+    double calls_per_second;
+};
+
+/** function prototypes */
+bool matchesFilter(const std::string & name, const std::string & filter);
+double unitInTheLastPlace(long double reference);
+ValidationResult validate(const ValidationCase & validation_case, long long samples);
+void writeJson(const std::vector<ValidationResult> & results, std::ofstream & file);
+
+/**
+ * Return true if name contains at least one of the substrings of filter (which are separated by |), or if filter is empty.
+ */
+bool matchesFilter(const std::string & name, const std::string & filter)
+{
+    std::size_t start = 0;
+    while (true)
+    {
+        std::size_t end = filter.find('|', start);
+        if (name.find(filter.substr(start, end - start)) != std::string::npos) return true;
+        if (end == std::string::npos) return false;
+        start = end + 1;
+    }
+}
+
+/**
+ * Return the distance between the double nearest to reference and the next larger double (in magnitude).
+ */
+double unitInTheLastPlace(long double reference)
+{
+    double magnitude = std::fabs(static_cast<double>(reference));
+    if (magnitude < std::numeric_limits<double>::min()) return std::numeric_limits<double>::denorm_min();
+    return std::nextafter(magnitude, std::numeric_limits<double>::infinity()) - magnitude;
+}
+
+/**
+ * Evaluate validation_case.kernel on samples reproducible pseudo-random arguments in [minimum, maximum]
+ * (the end-points themselves are always included) and compare each result to validation_case.reference.
+ */
+ValidationResult validate(const ValidationCase & validation_case, long long samples)
+{
+    samples = std::max(2LL, samples / validation_case.samples_divisor);
+
+    // Generate the arguments before timing so that the random number generator is not part of the throughput.
+    std::mt19937_64 generator(RANDOM_SEED);
+    std::uniform_real_distribution<double> distribution(validation_case.minimum, validation_case.maximum);
+    std::vector<double> arguments(samples), results(samples);
+    arguments[0] = validation_case.minimum;
+    arguments[1] = validation_case.maximum;
+    for (long long i = 2; i < samples; i += 1) arguments[i] = distribution(generator);
+
+    // Time the kernel over the whole sweep.
+    auto start = std::chrono::steady_clock::now();
+    for (long long i = 0; i < samples; i += 1) results[i] = validation_case.kernel(arguments[i]);
+    auto stop = std::chrono::steady_clock::now();
+    double elapsed_seconds = std::chrono::duration<double>(stop - start).count();
+
+    ValidationResult result = { validation_case.name, samples, 0.0, validation_case.minimum, 0.0, 0.0, 0, samples / elapsed_seconds };
+    long long finite_samples = 0;
+    long double sum_of_abs_errors = 0.0L;
+
+    for (long long i = 0; i < samples; i += 1)
+    {
+        long double reference = validation_case.reference(arguments[i]);
+        if (!std::isfinite(reference)) continue;
+        if (!std::isfinite(results[i]))
+        {
+            result.non_finite += 1;
+            continue;
+        }
+        long double abs_error = std::fabs(static_cast<long double>(results[i]) - reference);
+        double ulp_error = static_cast<double>(abs_error / unitInTheLastPlace(reference));
+        if (ulp_error > result.max_ulp)
+        {
+            result.max_ulp = ulp_error;
+            result.max_ulp_argument = arguments[i];
+        }
+        if (reference != 0.0L) result.max_rel_error = std::max(result.max_rel_error, static_cast<double>(abs_error / std::fabs(reference)));
+        sum_of_abs_errors += abs_error;
+        finite_samples += 1;
+    }
+
+    result.mean_abs_error = (finite_samples > 0) ? static_cast<double>(sum_of_abs_errors / finite_samples) : 0.0;
+    return result;
+}
+
+/**
+ * Write the validation results to the file output stream as a JSON document (one kernel per line so that diffs stay readable).
+ */
+void writeJson(const std::vector<ValidationResult> & results, std::ofstream & file)
+{
+    file.precision(6);
+    file << "{\n  \"validations\": [\n";
+    for (std::size_t i = 0; i < results.size(); i += 1)
+    {
+        file << "    {\"name\": \"" << results[i].name << "\", \"samples\": " << results[i].samples
+             << ", \"max_ulp\": " << results[i].max_ulp << ", \"max_ulp_argument\": " << results[i].max_ulp_argument
+             << ", \"mean_abs_error\": " << results[i].mean_abs_error << ", \"max_rel_error\": " << results[i].max_rel_error
+             << ", \"non_finite\": " << results[i].non_finite << ", \"calls_per_second\": " << results[i].calls_per_second << "}";
+        file << ((i + 1 < results.size()) ? ",\n" : "\n");
+    }
+    file << "  ]\n}\n";
+}
+
+/** program entry point */
+int main(int argc, char ** argv)
+{
+    // Declare the command line options (and their default values).
+    std::string filter = "", output_file_name = "";
+    long long samples = DEFAULT_SAMPLES;
+    double maximum_rel_error = -1.0;
+
+    // Parse the command line options.
+    for (int i = 1; i < argc; i += 1)
+    {
+        if (std::strncmp(argv[i], "--samples=", 10) == 0) samples = std::atoll(argv[i] + 10);
+        else if (std::strncmp(argv[i], "--filter=", 9) == 0) filter = argv[i] + 9;
+        else if (std::strncmp(argv[i], "--max-rel-error=", 16) == 0) maximum_rel_error = std::atof(argv[i] + 16);
+        else if (std::strncmp(argv[i], "--out=", 6) == 0) output_file_name = argv[i] + 6;
+        else
+        {
+            std::cout << "\nUsage: " << argv[0] << " [--samples=N] [--filter=SUBSTRING[|SUBSTRING...]] [--max-rel-error=E] [--out=FILE.json]\n";
+            return 1;
+        }
+    }
+
+    const std::array<Function, 6> functions = generate_array_of_functions();
+    const Function integ = integral(functions[2], 0.0, 1.0);
+    const Function sqrt_integ = integral(functions[4], 0.0, 10.0);
+    const Function func_prime = derivative(functions[2]);
+    const long double pi = 3.141592653589793238462643383279502884L;
+    const SineCosineTable table(DEFAULT_TRIGONOMETRIC_TABLE_RESOLUTION);
+
+    /**
+     * The series kernels (sine, cosine, arctangent, ...) always evaluate MAXIMUM_t terms (which takes microseconds per call),
+     * so their sweeps use fewer samples than the sweeps of the constant-time kernels.
+     */
+    const ChebyshevExpansion expansion(functions[2], -10.0, 10.0);
+    const Function chebyshev_integ = integral(expansion, functions[2]);
+    const Function chebyshev_prime = derivative(expansion, functions[2]);
+    const std::vector<ValidationCase> validation_cases = {
+        { "sine[-pi,pi]", [](double x) { return sine(x); }, [](long double x) { return std::sin(x); }, -3.14159, 3.14159, 100 },
+        { "sine[-40,40]", [](double x) { return sine(x); }, [](long double x) { return std::sin(x); }, -40.0, 40.0, 100 },
+        { "sine[-MAXIMUM_x,MAXIMUM_x]", [](double x) { return sine(x); }, [](long double x) { return std::sin(x); }, -MAXIMUM_x, MAXIMUM_x, 100 },
+        { "sineAndCosine:sine[-MAXIMUM_x,MAXIMUM_x]", [](double x) { double s = 0.0, c = 0.0; sineAndCosine(x, s, c); return s; }, [](long double x) { return std::sin(x); }, -MAXIMUM_x, MAXIMUM_x, 100 },
+        { "cosine[-pi,pi]", [](double x) { return cosine(x); }, [](long double x) { return std::cos(x); }, -3.14159, 3.14159, 100 },
+        { "cosine[-MAXIMUM_x,MAXIMUM_x]", [](double x) { return cosine(x); }, [](long double x) { return std::cos(x); }, -MAXIMUM_x, MAXIMUM_x, 100 },
+        { "SineCosineTable::sine[-MAXIMUM_x,MAXIMUM_x]", [&table](double x) { return table.sine(x); }, [](long double x) { return std::sin(x); }, -MAXIMUM_x, MAXIMUM_x, 1 },
+        { "SineCosineTable::cosine[-MAXIMUM_x,MAXIMUM_x]", [&table](double x) { return table.cosine(x); }, [](long double x) { return std::cos(x); }, -MAXIMUM_x, MAXIMUM_x, 1 },
+        { "SineCosineSequence(-MAXIMUM_x,0.01):sine(k)", [](double x) { static std::vector<double> sequence(2000001); static bool generated = false; if (!generated) { generateSineCosineSequence(-MAXIMUM_x, 0.01, 2000001, sequence.data(), nullptr); generated = true; } return sequence[static_cast<long long>((x + MAXIMUM_x) / 0.01 + 0.5)]; }, [](long double x) { return std::sin(static_cast<long double>(-MAXIMUM_x + std::floor((x + MAXIMUM_x) / 0.01 + 0.5) * 0.01)); }, -MAXIMUM_x, MAXIMUM_x, 1 },
+        { "tangent[-1.5,1.5]", [](double x) { return tangent(x); }, [](long double x) { return std::tan(x); }, -1.5, 1.5, 100 },
+        { "tangentBatch[-MAXIMUM_x,MAXIMUM_x]", [](double x) { double y = 0.0; tangentBatch(&x, &y, 1); return y; }, [](long double x) { return std::tan(x); }, -MAXIMUM_x, MAXIMUM_x, 1 },
+        { "cotangentBatch[-MAXIMUM_x,MAXIMUM_x]", [](double x) { double y = 0.0; cotangentBatch(&x, &y, 1); return y; }, [](long double x) { return 1.0L / std::tan(x); }, -MAXIMUM_x, MAXIMUM_x, 1 },
+        { "secantBatch[-MAXIMUM_x,MAXIMUM_x]", [](double x) { double y = 0.0; secantBatch(&x, &y, 1); return y; }, [](long double x) { return 1.0L / std::cos(x); }, -MAXIMUM_x, MAXIMUM_x, 1 },
+        { "cosecantBatch[-MAXIMUM_x,MAXIMUM_x]", [](double x) { double y = 0.0; cosecantBatch(&x, &y, 1); return y; }, [](long double x) { return 1.0L / std::sin(x); }, -MAXIMUM_x, MAXIMUM_x, 1 },
+        { "reciprocalWithoutDivision[1e-3,MAXIMUM_x]", [](double x) { return reciprocalWithoutDivision(x); }, [](long double x) { return 1.0L / x; }, 1e-3, MAXIMUM_x, 1 },
+        { "arctangent[-0.9,0.9]", [](double x) { return arctangent(x); }, [](long double x) { return std::atan(x); }, -0.9, 0.9, 100 },
+        { "arctangent[-1,1]", [](double x) { return arctangent(x); }, [](long double x) { return std::atan(x); }, -1.0, 1.0, 100 },
+        { "arcsine[-1,1]", [](double x) { return arcsine(x); }, [](long double x) { return std::asin(x); }, -1.0, 1.0, 100 },
+        { "arccosine[-1,1]", [](double x) { return arccosine(x); }, [](long double x) { return std::acos(x); }, -1.0, 1.0, 100 },
+        { "computePi(MAXIMUM_i)", [](double) { return computePi(MAXIMUM_i); }, [pi](long double) { return pi; }, 0.0, 1.0, 100 },
+        { "ln[1e-3,MAXIMUM_x]", [](double x) { return static_cast<double>(ln(static_cast<float>(x))); }, [](long double x) { return std::log(x); }, 1e-3, MAXIMUM_x, 1 },
+        { "power_of_e_to_x[-700,700]", [](double x) { return power_of_e_to_x(x); }, [](long double x) { return std::exp(x); }, -700.0, 700.0, 10 },
+        { "power(x,2.5)[1e-3,MAXIMUM_x]", [](double x) { return power(x, 2.5); }, [](long double x) { return std::pow(x, 2.5L); }, 1e-3, MAXIMUM_x, 1 },
+        { "logarithm(x,10)[1e-3,MAXIMUM_x]", [](double x) { return logarithm(x, 10.0); }, [](long double x) { return std::log10(x); }, 1e-3, MAXIMUM_x, 1 },
+        { "exponentialKernel[-708,708]", [](double x) { return exponentialKernel(x); }, [](long double x) { return std::exp(x); }, -708.0, 708.0, 1 },
+        { "exponentialMinusOneKernel[-1,1]", [](double x) { return exponentialMinusOneKernel(x); }, [](long double x) { return std::expm1(x); }, -1.0, 1.0, 1 },
+        { "logarithmKernel[1e-3,MAXIMUM_x]", [](double x) { return logarithmKernel(x); }, [](long double x) { return std::log(x); }, 1e-3, MAXIMUM_x, 1 },
+        { "logarithmOfOnePlusKernel[0,1]", [](double x) { return logarithmOfOnePlusKernel(x); }, [](long double x) { return std::log1p(x); }, 0.0, 1.0, 1 },
+        { "logarithm(x,2)[0.5,2]", [](double x) { return logarithm(x, 2.0); }, [](long double x) { return std::log2(x); }, 0.5, 2.0, 1 },
+        { "logarithmBaseTwo[0.5,2]", [](double x) { return logarithmBaseTwo(x); }, [](long double x) { return std::log2(x); }, 0.5, 2.0, 1 },
+        { "logarithmBaseTwo[1e-300,MAXIMUM_x]", [](double x) { return logarithmBaseTwo(x); }, [](long double x) { return std::log2(x); }, 1e-300, MAXIMUM_x, 1 },
+        { "logarithmBaseTen[1e-3,MAXIMUM_x]", [](double x) { return logarithmBaseTen(x); }, [](long double x) { return std::log10(x); }, 1e-3, MAXIMUM_x, 1 },
+        { "logarithmBaseTen[0.5,2]", [](double x) { return logarithmBaseTen(x); }, [](long double x) { return std::log10(x); }, 0.5, 2.0, 1 },
+        { "logarithmOfOnePlus[-0.999,1]", [](double x) { return logarithmOfOnePlus(x); }, [](long double x) { return std::log1p(x); }, -0.999, 1.0, 1 },
+        { "logarithmOfOnePlus[-1e-6,1e-6]", [](double x) { return logarithmOfOnePlus(x); }, [](long double x) { return std::log1p(x); }, -1e-6, 1e-6, 1 },
+        { "powerOfTwoToX[-1022,1023]", [](double x) { return powerOfTwoToX(x); }, [](long double x) { return std::exp2(x); }, -1022.0, 1023.0, 1 },
+        { "powerOfEToXMinusOne[-1e-6,1e-6]", [](double x) { return powerOfEToXMinusOne(x); }, [](long double x) { return std::expm1(x); }, -1e-6, 1e-6, 1 },
+        { "powerOfEToXMinusOne[-700,709]", [](double x) { return powerOfEToXMinusOne(x); }, [](long double x) { return std::expm1(x); }, -700.0, 709.0, 1 },
+        { "logarithmBaseTwoBatch[1e-3,MAXIMUM_x]", [](double x) { double y = 0.0; logarithmBaseTwoBatch(&x, &y, 1); return y; }, [](long double x) { return std::log2(x); }, 1e-3, MAXIMUM_x, 1 },
+        { "logarithmOfOnePlusBatch[-0.999,1]", [](double x) { double y = 0.0; logarithmOfOnePlusBatch(&x, &y, 1); return y; }, [](long double x) { return std::log1p(x); }, -0.999, 1.0, 1 },
+        { "powerOfTwoToXBatch[-1022,1023]", [](double x) { double y = 0.0; powerOfTwoToXBatch(&x, &y, 1); return y; }, [](long double x) { return std::exp2(x); }, -1022.0, 1023.0, 1 },
+        { "hyperbolicSine[-1,1]", [](double x) { return hyperbolicSine(x); }, [](long double x) { return std::sinh(x); }, -1.0, 1.0, 1 },
+        { "hyperbolicSine[-710,710]", [](double x) { return hyperbolicSine(x); }, [](long double x) { return std::sinh(x); }, -710.0, 710.0, 1 },
+        { "hyperbolicCosine[-710,710]", [](double x) { return hyperbolicCosine(x); }, [](long double x) { return std::cosh(x); }, -710.0, 710.0, 1 },
+        { "hyperbolicTangent[-1,1]", [](double x) { return hyperbolicTangent(x); }, [](long double x) { return std::tanh(x); }, -1.0, 1.0, 1 },
+        { "hyperbolicTangent[-30,30]", [](double x) { return hyperbolicTangent(x); }, [](long double x) { return std::tanh(x); }, -30.0, 30.0, 1 },
+        { "inverseHyperbolicSine[-MAXIMUM_x,MAXIMUM_x]", [](double x) { return inverseHyperbolicSine(x); }, [](long double x) { return std::asinh(x); }, -MAXIMUM_x, MAXIMUM_x, 1 },
+        { "inverseHyperbolicCosine[1,2]", [](double x) { return inverseHyperbolicCosine(x); }, [](long double x) { return std::acosh(x); }, 1.0, 2.0, 1 },
+        { "inverseHyperbolicCosine[1,MAXIMUM_x]", [](double x) { return inverseHyperbolicCosine(x); }, [](long double x) { return std::acosh(x); }, 1.0, MAXIMUM_x, 1 },
+        { "inverseHyperbolicTangent[-0.999999,0.999999]", [](double x) { return inverseHyperbolicTangent(x); }, [](long double x) { return std::atanh(x); }, -0.999999, 0.999999, 1 },
+        { "hyperbolicSineAndCosineBatch:cosh[-710,710]", [](double x) { double s = 0.0, c = 0.0; hyperbolicSineAndCosineBatch(&x, &s, &c, 1); return c; }, [](long double x) { return std::cosh(x); }, -710.0, 710.0, 1 },
+        { "hyperbolicTangentBatch[-30,30]", [](double x) { double y = 0.0; hyperbolicTangentBatch(&x, &y, 1); return y; }, [](long double x) { return std::tanh(x); }, -30.0, 30.0, 1 },
+        { "inverseHyperbolicTangentBatch[-0.999999,0.999999]", [](double x) { double y = 0.0; inverseHyperbolicTangentBatch(&x, &y, 1); return y; }, [](long double x) { return std::atanh(x); }, -0.999999, 0.999999, 1 },
+        { "tieredLn<ACCURACY_APPROXIMATE>[1e-3,MAXIMUM_x]", [](double x) { return tieredLn<ACCURACY_APPROXIMATE>(x); }, [](long double x) { return std::log(x); }, 1e-3, MAXIMUM_x, 1 },
+        { "tieredLn<ACCURACY_MEDIUM>[1e-3,MAXIMUM_x]", [](double x) { return tieredLn<ACCURACY_MEDIUM>(x); }, [](long double x) { return std::log(x); }, 1e-3, MAXIMUM_x, 1 },
+        { "tieredLn<ACCURACY_FULL>[1e-3,MAXIMUM_x]", [](double x) { return tieredLn<ACCURACY_FULL>(x); }, [](long double x) { return std::log(x); }, 1e-3, MAXIMUM_x, 1 },
+        { "tieredPowerOfEToX<ACCURACY_APPROXIMATE>[-700,700]", [](double x) { return tieredPowerOfEToX<ACCURACY_APPROXIMATE>(x); }, [](long double x) { return std::exp(x); }, -700.0, 700.0, 1 },
+        { "tieredPowerOfEToX<ACCURACY_MEDIUM>[-700,700]", [](double x) { return tieredPowerOfEToX<ACCURACY_MEDIUM>(x); }, [](long double x) { return std::exp(x); }, -700.0, 700.0, 1 },
+        { "tieredPowerOfEToX<ACCURACY_FULL>[-700,700]", [](double x) { return tieredPowerOfEToX<ACCURACY_FULL>(x); }, [](long double x) { return std::exp(x); }, -700.0, 700.0, 1 },
+        { "tieredPower<ACCURACY_APPROXIMATE>(x,2.5)[1e-3,MAXIMUM_x]", [](double x) { return tieredPower<ACCURACY_APPROXIMATE>(x, 2.5); }, [](long double x) { return std::pow(x, 2.5L); }, 1e-3, MAXIMUM_x, 1 },
+        { "tieredPower<ACCURACY_MEDIUM>(x,2.5)[1e-3,MAXIMUM_x]", [](double x) { return tieredPower<ACCURACY_MEDIUM>(x, 2.5); }, [](long double x) { return std::pow(x, 2.5L); }, 1e-3, MAXIMUM_x, 1 },
+        { "tieredPower<ACCURACY_FULL>(x,2.5)[1e-3,MAXIMUM_x]", [](double x) { return tieredPower<ACCURACY_FULL>(x, 2.5); }, [](long double x) { return std::pow(x, 2.5L); }, 1e-3, MAXIMUM_x, 1 },
+        { "tieredSine<ACCURACY_APPROXIMATE>[-MAXIMUM_x,MAXIMUM_x]", [](double x) { return tieredSine<ACCURACY_APPROXIMATE>(x); }, [](long double x) { return std::sin(x); }, -MAXIMUM_x, MAXIMUM_x, 1 },
+        { "tieredSine<ACCURACY_MEDIUM>[-MAXIMUM_x,MAXIMUM_x]", [](double x) { return tieredSine<ACCURACY_MEDIUM>(x); }, [](long double x) { return std::sin(x); }, -MAXIMUM_x, MAXIMUM_x, 1 },
+        { "tieredSine<ACCURACY_FULL>[-MAXIMUM_x,MAXIMUM_x]", [](double x) { return tieredSine<ACCURACY_FULL>(x); }, [](long double x) { return std::sin(x); }, -MAXIMUM_x, MAXIMUM_x, 1 },
+        { "tieredCosine<ACCURACY_APPROXIMATE>[-MAXIMUM_x,MAXIMUM_x]", [](double x) { return tieredCosine<ACCURACY_APPROXIMATE>(x); }, [](long double x) { return std::cos(x); }, -MAXIMUM_x, MAXIMUM_x, 1 },
+        { "tieredCosine<ACCURACY_MEDIUM>[-MAXIMUM_x,MAXIMUM_x]", [](double x) { return tieredCosine<ACCURACY_MEDIUM>(x); }, [](long double x) { return std::cos(x); }, -MAXIMUM_x, MAXIMUM_x, 1 },
+        { "tieredCosine<ACCURACY_FULL>[-MAXIMUM_x,MAXIMUM_x]", [](double x) { return tieredCosine<ACCURACY_FULL>(x); }, [](long double x) { return std::cos(x); }, -MAXIMUM_x, MAXIMUM_x, 1 },
+        { "tieredArctangent<ACCURACY_APPROXIMATE>[-MAXIMUM_x,MAXIMUM_x]", [](double x) { return tieredArctangent<ACCURACY_APPROXIMATE>(x); }, [](long double x) { return std::atan(x); }, -MAXIMUM_x, MAXIMUM_x, 1 },
+        { "tieredArctangent<ACCURACY_MEDIUM>[-MAXIMUM_x,MAXIMUM_x]", [](double x) { return tieredArctangent<ACCURACY_MEDIUM>(x); }, [](long double x) { return std::atan(x); }, -MAXIMUM_x, MAXIMUM_x, 1 },
+        { "tieredArctangent<ACCURACY_FULL>[-MAXIMUM_x,MAXIMUM_x]", [](double x) { return tieredArctangent<ACCURACY_FULL>(x); }, [](long double x) { return std::atan(x); }, -MAXIMUM_x, MAXIMUM_x, 1 },
+        { "tieredLogarithm<ACCURACY_APPROXIMATE>(x,3)[1e-3,MAXIMUM_x]", [](double x) { return tieredLogarithm<ACCURACY_APPROXIMATE>(x, 3.0); }, [](long double x) { return std::log(x) / std::log(3.0L); }, 1e-3, MAXIMUM_x, 1 },
+        { "tieredLogarithm<ACCURACY_MEDIUM>(x,3)[1e-3,MAXIMUM_x]", [](double x) { return tieredLogarithm<ACCURACY_MEDIUM>(x, 3.0); }, [](long double x) { return std::log(x) / std::log(3.0L); }, 1e-3, MAXIMUM_x, 1 },
+        { "tieredLogarithm<ACCURACY_FULL>(x,3)[1e-3,MAXIMUM_x]", [](double x) { return tieredLogarithm<ACCURACY_FULL>(x, 3.0); }, [](long double x) { return std::log(x) / std::log(3.0L); }, 1e-3, MAXIMUM_x, 1 },
+        { "sineFloatBatch[-MAXIMUM_x,MAXIMUM_x]", [](double x) { float y = 0.0f, value = static_cast<float>(x); sineFloatBatch(&value, &y, 1); return y; }, [](long double x) { return std::sin(static_cast<long double>(static_cast<float>(x))); }, -MAXIMUM_x, MAXIMUM_x, 1 },
+        { "cosineFloatBatch[-MAXIMUM_x,MAXIMUM_x]", [](double x) { float y = 0.0f, value = static_cast<float>(x); cosineFloatBatch(&value, &y, 1); return y; }, [](long double x) { return std::cos(static_cast<long double>(static_cast<float>(x))); }, -MAXIMUM_x, MAXIMUM_x, 1 },
+        { "lnFloatBatch[1e-3,MAXIMUM_x]", [](double x) { float y = 0.0f, value = static_cast<float>(x); lnFloatBatch(&value, &y, 1); return y; }, [](long double x) { return std::log(static_cast<long double>(static_cast<float>(x))); }, 1e-3, MAXIMUM_x, 1 },
+        { "powerOfEToXFloatBatch[-88,88]", [](double x) { float y = 0.0f, value = static_cast<float>(x); powerOfEToXFloatBatch(&value, &y, 1); return y; }, [](long double x) { return std::exp(static_cast<long double>(static_cast<float>(x))); }, -88.0, 88.0, 1 },
+        { "powerFloatBatch(x,2.2)[1e-3,MAXIMUM_x]", [](double x) { float y = 0.0f, value = static_cast<float>(x); powerFloatBatch(&value, 2.2f, &y, 1); return y; }, [](long double x) { return std::pow(static_cast<long double>(static_cast<float>(x)), static_cast<long double>(2.2f)); }, 1e-3, MAXIMUM_x, 1 },
+        { "powerFloatBatch(1.5,x)[-200,200]", [](double x) { float y = 0.0f, base = 1.5f; powerFloatBatch(&base, static_cast<float>(x), &y, 1); return y; }, [](long double x) { return std::pow(1.5L, static_cast<long double>(static_cast<float>(x))); }, -200.0, 200.0, 1 },
+        { "computeRiemannSum(sin,0,b,1000,midpoint)[0.01,10]", [&functions](double b) { return computeRiemannSum(functions[2], 0.0, b, 1000, "midpoint"); }, [](long double b) { return 1.0L - std::cos(b); }, 0.01, 10.0, 100 },
+        { "integral(sin,0)(x)[0.01,10]", [&integ](double x) { return integ(x); }, [](long double x) { return 1.0L - std::cos(x); }, 0.01, 10.0, 100 },
+        { "integral(sqrt,0)(x)[0.01,10]", [&sqrt_integ](double x) { return sqrt_integ(x); }, [](long double x) { return 2.0L / 3.0L * x * std::sqrt(x); }, 0.01, 10.0, 100 },
+        { "integrateGaussLegendre(exp,0,b,20)[-10,10]", [](double b) { return integrateGaussLegendre([](double x) { return std::exp(x); }, 0.0, b); }, [](long double b) { return std::exp(b) - 1.0L; }, -10.0, 10.0, 100 },
+        { "integrateGaussLegendre(sqrt,0,b,20,4)[0.01,10]", [&functions](double b) { return integrateGaussLegendre(functions[4], 0.0, b, 20, 4); }, [](long double b) { return 2.0L / 3.0L * b * std::sqrt(b); }, 0.01, 10.0, 100 },
+        { "integrateTanhSinh(sqrt,0,b)[0.01,10]", [&functions](double b) { return integrateTanhSinh(functions[4], 0.0, b).estimate; }, [](long double b) { return 2.0L / 3.0L * b * std::sqrt(b); }, 0.01, 10.0, 100 },
+        { "integrateTanhSinh(exp(-x^2/b^2),-inf,inf)[0.1,10]", [](double b) { return integrateTanhSinh([b](double x) { return std::exp(-x * x / (b * b)); }, -INFINITY, INFINITY).estimate; }, [](long double b) { return b * std::sqrt(3.14159265358979323846264338327950288L); }, 0.1, 10.0, 100 },
+        { "integral(ChebyshevExpansion(sin,-10,10))(x)[-10,10]", [&chebyshev_integ](double x) { return chebyshev_integ(x); }, [](long double x) { return std::cos(10.0L) - std::cos(x); }, -10.0, 10.0, 1 },
+        { "derivative(ChebyshevExpansion(sin,-10,10))(x)[-10,10]", [&chebyshev_prime](double x) { return chebyshev_prime(x); }, [](long double x) { return std::cos(x); }, -10.0, 10.0, 1 },
+        { "findRootBrent(sine(x)-y)[-0.99,0.99]", [](double y) { return findRootBrent([y](double x) { return sine(x) - y; }, -1.5707963, 1.5707963).root; }, [](long double y) { return std::asin(y); }, -0.99, 0.99, 100 },
+        { "findRootNewtonDual(x^3-y)[1e-3,1000]", [](double y) { return findRootNewtonDual([y](auto x) { return x * x * x - y; }, 0.0, 100.0).root; }, [](long double y) { return std::cbrt(y); }, 1e-3, 1000.0, 10 },
+        { "derivative(sin)(x)[-10,10]", [&func_prime](double x) { return func_prime(x); }, [](long double x) { return std::cos(x); }, -10.0, 10.0, 1 },
+        { "ln(BigFloat)[1e-3,MAXIMUM_x]", [](double x) { return ln(BigFloat(x)).toDouble(); }, [](long double x) { return std::log(x); }, 1e-3, MAXIMUM_x, 1000 },
+        { "sine(BigFloat)[-MAXIMUM_x,MAXIMUM_x]", [](double x) { return sine(BigFloat(x)).toDouble(); }, [](long double x) { return std::sin(x); }, -MAXIMUM_x, MAXIMUM_x, 1000 },
+        { "sine(DoubleDouble)[-MAXIMUM_x,MAXIMUM_x]", [](double x) { return sine(DoubleDouble(x)).toDouble(); }, [](long double x) { return std::sin(x); }, -MAXIMUM_x, MAXIMUM_x, 1 },
+        { "cosine(DoubleDouble)[-MAXIMUM_x,MAXIMUM_x]", [](double x) { return cosine(DoubleDouble(x)).toDouble(); }, [](long double x) { return std::cos(x); }, -MAXIMUM_x, MAXIMUM_x, 1 },
+        { "arctangent(DoubleDouble)[-MAXIMUM_x,MAXIMUM_x]", [](double x) { return arctangent(DoubleDouble(x)).toDouble(); }, [](long double x) { return std::atan(x); }, -MAXIMUM_x, MAXIMUM_x, 1 },
+        { "ln(DoubleDouble)[1e-3,MAXIMUM_x]", [](double x) { return ln(DoubleDouble(x)).toDouble(); }, [](long double x) { return std::log(x); }, 1e-3, MAXIMUM_x, 1 },
+        { "power_of_e_to_x(DoubleDouble)[-700,700]", [](double x) { return power_of_e_to_x(DoubleDouble(x)).toDouble(); }, [](long double x) { return std::exp(x); }, -700.0, 700.0, 1 },
+        { "sine(Interval).midpoint[-MAXIMUM_x,MAXIMUM_x]", [](double x) { return sine(Interval(x)).midpoint(); }, [](long double x) { return std::sin(x); }, -MAXIMUM_x, MAXIMUM_x, 1 },
+        { "ln(Interval).midpoint[1e-3,MAXIMUM_x]", [](double x) { return ln(Interval(x)).midpoint(); }, [](long double x) { return std::log(x); }, 1e-3, MAXIMUM_x, 1 }
+    };
+
+    std::vector<ValidationResult> results;
+    for (const ValidationCase & validation_case : validation_cases)
+    {
+        if (!matchesFilter(validation_case.name, filter)) continue;
+        results.push_back(validate(validation_case, samples));
+    }
+
+    // Print the results to the command line terminal as a table.
+    std::cout.precision(3);
+    std::cout << std::left << std::setw(52) << "kernel" << std::right << std::setw(10) << "samples" << std::setw(12) << "max_ulp" << std::setw(12) << "mean_abs" << std::setw(12) << "max_rel" << std::setw(8) << "digits" << std::setw(12) << "non_finite" << std::setw(12) << "calls/s" << "\n";
+    for (const ValidationResult & result : results)
+    {
+        double digits = (result.max_rel_error > 0.0) ? std::max(0.0, -std::log10(result.max_rel_error)) : 17.0;
+        std::cout << std::left << std::setw(52) << result.name << std::right << std::setw(10) << result.samples << std::setw(12) << result.max_ulp << std::setw(12) << result.mean_abs_error
+                  << std::setw(12) << result.max_rel_error << std::setw(8) << digits << std::setw(12) << result.non_finite << std::setw(12) << result.calls_per_second << "\n";
+    }
+
+    // Write the results to the JSON file (if one was requested).
+    if (!output_file_name.empty())
+    {
+        std::ofstream file(output_file_name);
+        writeJson(results, file);
+        file.close();
+    }
+
+    // Report every kernel which exceeds the requested error bound (if one was requested).
+    int exit_status = 0;
+    if (maximum_rel_error >= 0.0)
+    {
+        for (const ValidationResult & result : results)
+        {
+            if ((result.max_rel_error <= maximum_rel_error) && (result.non_finite == 0)) continue;
+            std::cout << "\nFAILED: " << result.name << " (max_rel_error " << result.max_rel_error << ", non_finite " << result.non_finite << ", bound " << maximum_rel_error << ")";
+            exit_status = 1;
+        }
+        if (results.empty())
+        {
+            std::cout << "\nFAILED: no kernel matches the filter.";
+            exit_status = 1;
+        }
+        std::cout << "\n";
+    }
+
+    // Exit the program.
+    return exit_status;
+}